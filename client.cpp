@@ -5,7 +5,12 @@ int main()
 {
     auto clientStubPtr = std::make_unique<anechka::ClientStub>();
 
-    clientStubPtr->RequestRecursiveDirIndexing("../vault/")->print();
+    auto indexing = clientStubPtr->RequestRecursiveDirIndexing("../vault/");
+    indexing->print();
+    if (indexing->getOk())
+    {
+        clientStubPtr->AwaitJob(indexing->getJobid(), 100)->print();
+    }
     clientStubPtr->RequestTokenSearchWithContext("America")->print();
     clientStubPtr->RequestTokenDeletion("orange")->print();
     clientStubPtr->RequestTokenDeletion("apple")->print();
@@ -1,4 +1,6 @@
 #include "../server/server.h"
+#include "../server/coordinator.h"
+#include <fstream>
 
 void shouldQuit()
 {
@@ -35,7 +37,28 @@ int main(int argc, char** argv)
 
     const std::string config = argv[1];
 
-    net::stub::ServerStubPtr server = std::make_unique<anechka::Anechka>(config);
+    /**
+    * a config listing backends turns the process into a coordinator in front of them
+    */
+    bool isCoordinator = false;
+    {
+        std::ifstream file(config);
+        if (!file.fail())
+        {
+            const Json json = Json::parse(file);
+            isCoordinator = json.contains("backends") && !json.at("backends").empty();
+        }
+    }
+
+    net::stub::ServerStubPtr server;
+    if (isCoordinator)
+    {
+        server = std::make_unique<anechka::Coordinator>(config);
+    }
+    else
+    {
+        server = std::make_unique<anechka::Anechka>(config);
+    }
     release_assert(server->run(), "Server failed to launch");
     shouldQuit();
     server->shutDown();
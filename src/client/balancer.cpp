@@ -0,0 +1,97 @@
+#include "balancer.h"
+
+namespace anechka
+{
+    BalancedClient::BalancedClient(const Backend& primary, const std::vector<Backend>& replicas)
+        : m_primary(primary.host, primary.port)
+    {
+        for (const Backend& replica: replicas)
+        {
+            m_replicas.emplace_back(replica.host, replica.port);
+        }
+    }
+
+    void BalancedClient::setTimeout(size_t timeoutMs)
+    {
+        m_primary.setTimeout(timeoutMs);
+        for (auto& replica: m_replicas)
+        {
+            replica.setTimeout(timeoutMs);
+        }
+    }
+
+    net::InsertResponse::ResponsePtr BalancedClient::RequestTxtFileIndexing(const std::string& path)
+    {
+        return m_primary.RequestTxtFileIndexing(path);
+    }
+
+    net::InsertResponse::ResponsePtr BalancedClient::RequestRecursiveDirIndexing(const std::string& path)
+    {
+        return m_primary.RequestRecursiveDirIndexing(path);
+    }
+
+    net::JobStatusResponse::ResponsePtr BalancedClient::RequestJobStatus(uint64_t jobId)
+    {
+        return m_primary.RequestJobStatus(jobId);
+    }
+
+    net::JobStatusResponse::ResponsePtr BalancedClient::RequestJobCancel(uint64_t jobId)
+    {
+        return m_primary.RequestJobCancel(jobId);
+    }
+
+    net::EraseResponse::ResponsePtr BalancedClient::RequestTokenDeletion(const std::string& token)
+    {
+        return m_primary.RequestTokenDeletion(token);
+    }
+
+    net::EraseResponse::ResponsePtr BalancedClient::RequestDocumentDeletion(const std::string& path)
+    {
+        return m_primary.RequestDocumentDeletion(path);
+    }
+
+    net::InsertResponse::ResponsePtr BalancedClient::RequestDocumentReindex(const std::string& path)
+    {
+        return m_primary.RequestDocumentReindex(path);
+    }
+
+    net::SearchResponse::ResponsePtr BalancedClient::RequestTokenSearch(const std::string& token, uint64_t limit,
+                                                                        const std::string& cursor)
+    {
+        return readPage(cursor, [&token, limit](ClientStub& stub, const std::string& stubCursor) {
+            return stub.RequestTokenSearch(token, limit, stubCursor);
+        });
+    }
+
+    net::ContextSearchResponse::ResponsePtr BalancedClient::RequestTokenSearchWithContext(const std::string& token,
+                                                                                          uint64_t limit,
+                                                                                          const std::string& cursor)
+    {
+        return readPage(cursor, [&token, limit](ClientStub& stub, const std::string& stubCursor) {
+            return stub.RequestTokenSearchWithContext(token, limit, stubCursor);
+        });
+    }
+
+    net::SearchQueryResponse::ResponsePtr BalancedClient::RequestQuerySearch(const std::string& query, uint64_t limit,
+                                                                             const std::string& cursor, bool ranked)
+    {
+        return readPage(cursor, [&query, limit, ranked](ClientStub& stub, const std::string& stubCursor) {
+            return stub.RequestQuerySearch(query, limit, stubCursor, ranked);
+        });
+    }
+
+    net::QueryStatsResponse::ResponsePtr BalancedClient::RequestQueryStats(const std::string& query)
+    {
+        return read([&query](ClientStub& stub) {
+            return stub.RequestQueryStats(query);
+        });
+    }
+
+    net::TermExpansionResponse::ResponsePtr BalancedClient::RequestTermExpansion(const std::string& pattern,
+                                                                                 uint64_t limit, uint64_t maxEdits)
+    {
+        return read([&pattern, limit, maxEdits](ClientStub& stub) {
+            return stub.RequestTermExpansion(pattern, limit, maxEdits);
+        });
+    }
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "client.h"
+
+namespace anechka
+{
+    class BalancedClient
+    {
+        /**
+        * BalancedClient spreads read requests over the replicas of a primary in round-robin order. A replica
+        * failing to answer is skipped, the primary serves reads only when none of the replicas does.
+        * Requests mutating the index always go to the primary. Like ClientStub, an instance is meant to be
+        * used by one thread at a time.
+        */
+    public:
+        BalancedClient(const Backend& primary, const std::vector<Backend>& replicas);
+        void setTimeout(size_t timeoutMs);
+
+        net::InsertResponse::ResponsePtr RequestTxtFileIndexing(const std::string& path);
+        net::InsertResponse::ResponsePtr RequestRecursiveDirIndexing(const std::string& path);
+        /**
+        * jobs run on the primary, which is asked about them
+        */
+        net::JobStatusResponse::ResponsePtr RequestJobStatus(uint64_t jobId);
+        net::JobStatusResponse::ResponsePtr RequestJobCancel(uint64_t jobId);
+        net::EraseResponse::ResponsePtr RequestTokenDeletion(const std::string& token);
+        net::EraseResponse::ResponsePtr RequestDocumentDeletion(const std::string& path);
+        net::InsertResponse::ResponsePtr RequestDocumentReindex(const std::string& path);
+        net::SearchResponse::ResponsePtr RequestTokenSearch(const std::string& token, uint64_t limit = 0,
+                                                            const std::string& cursor = "");
+        net::ContextSearchResponse::ResponsePtr RequestTokenSearchWithContext(const std::string& token,
+                                                                              uint64_t limit = 0,
+                                                                              const std::string& cursor = "");
+        net::SearchQueryResponse::ResponsePtr RequestQuerySearch(const std::string& query, uint64_t limit = 0,
+                                                                 const std::string& cursor = "", bool ranked = true);
+        net::QueryStatsResponse::ResponsePtr RequestQueryStats(const std::string& query);
+        /**
+        * maxEdits 0 expands pattern as a wildcard pattern, a positive one looks for tokens close to it
+        */
+        net::TermExpansionResponse::ResponsePtr RequestTermExpansion(const std::string& pattern, uint64_t limit = 0,
+                                                                     uint64_t maxEdits = 0);
+
+    private:
+        template<typename Call>
+        auto read(Call&& call)
+        {
+            size_t servedBy;
+            return read(std::forward<Call>(call), servedBy);
+        }
+
+        template<typename Call>
+        auto read(Call&& call, size_t& servedBy)
+        {
+            /**
+            * servedBy is the index of the replica that answered, the replica count stands for the primary
+            */
+            const size_t first = m_next++;
+            for (size_t i = 0; i < m_replicas.size(); i++)
+            {
+                servedBy = (first + i) % m_replicas.size();
+                auto responsePtr = call(m_replicas[servedBy]);
+                if (responsePtr->getStatus() == net::ProtocolStatus::OK)
+                {
+                    return responsePtr;
+                }
+            }
+            servedBy = m_replicas.size();
+            return call(m_primary);
+        }
+
+        template<typename Call>
+        auto readPage(const std::string& cursor, Call&& call)
+        {
+            /**
+            * Cursors refer to DocIds, which differ between the primary and its replicas, so the pages
+            * following the first one are read from the server that served it. Its index is put in front of
+            * the cursors handed out, e.g. "1/<cursor of the server>"
+            */
+            size_t servedBy = m_replicas.size();
+            const size_t sep = cursor.find('/');
+            if (cursor.empty())
+            {
+                auto responsePtr = read([&call](ClientStub& stub) {
+                    return call(stub, "");
+                }, servedBy);
+                pin(responsePtr, servedBy);
+                return responsePtr;
+            }
+            if (sep != std::string::npos && sep > 0 && cursor.find_first_not_of("0123456789") == sep)
+            {
+                servedBy = std::min<size_t>(std::stoull(cursor.substr(0, sep)), m_replicas.size());
+            }
+            ClientStub& stub = servedBy < m_replicas.size() ? m_replicas[servedBy] : m_primary;
+            auto responsePtr = call(stub, sep != std::string::npos ? cursor.substr(sep + 1) : cursor);
+            pin(responsePtr, servedBy);
+            return responsePtr;
+        }
+
+        template<typename ResponsePtr>
+        static void pin(const ResponsePtr& responsePtr, size_t servedBy)
+        {
+            const std::string prefix = std::to_string(servedBy) + '/';
+            if (!responsePtr->getNextcursor().empty())
+            {
+                responsePtr->getNextcursor() = prefix + responsePtr->getNextcursor();
+            }
+            if constexpr (std::is_same_v<ResponsePtr, net::SearchQueryResponse::ResponsePtr>)
+            {
+                for (auto& cursor: responsePtr->getCursors())
+                {
+                    cursor = prefix + cursor;
+                }
+            }
+        }
+
+    private:
+        ClientStub m_primary;
+        std::vector<ClientStub> m_replicas;
+        size_t m_next{0};
+    };
+}
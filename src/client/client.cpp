@@ -1,4 +1,5 @@
 #include "client.h"
+#include <thread>
 
 namespace anechka
 {
@@ -7,6 +8,11 @@ namespace anechka
     {
     }
 
+    ClientStub::ClientStub(const std::string& host, int port)
+        : AbstractClientStub(host, port)
+    {
+    }
+
     net::InsertResponse::ResponsePtr ClientStub::RequestTxtFileIndexing(const std::string& path)
     {
         auto requestPtr = std::make_shared<net::Path::Path>();
@@ -29,12 +35,51 @@ namespace anechka
         return responsePtr;
     }
 
-    net::SearchResponse::ResponsePtr ClientStub::RequestTokenSearch(const std::string& token)
+    net::JobStatusResponse::ResponsePtr ClientStub::RequestJobStatus(uint64_t jobId)
     {
-        auto requestPtr = std::make_shared<net::BasicToken::BasicToken>();
+        auto requestPtr = std::make_shared<net::JobRequest::JobRequest>();
+        auto responsePtr = std::make_shared<net::JobStatusResponse::JobStatusResponse>();
+
+        requestPtr->getJobid() = jobId;
+        execute("RequestJobStatus", requestPtr, responsePtr);
+
+        return responsePtr;
+    }
+
+    net::JobStatusResponse::ResponsePtr ClientStub::RequestJobCancel(uint64_t jobId)
+    {
+        auto requestPtr = std::make_shared<net::JobRequest::JobRequest>();
+        auto responsePtr = std::make_shared<net::JobStatusResponse::JobStatusResponse>();
+
+        requestPtr->getJobid() = jobId;
+        execute("RequestJobCancel", requestPtr, responsePtr);
+
+        return responsePtr;
+    }
+
+    net::JobStatusResponse::ResponsePtr ClientStub::AwaitJob(uint64_t jobId, size_t pollMs)
+    {
+        while (true)
+        {
+            auto responsePtr = RequestJobStatus(jobId);
+            const std::string& state = responsePtr->getState();
+            if (!responsePtr->getOk() || (state != "queued" && state != "running" && state != "cancelling"))
+            {
+                return responsePtr;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(pollMs));
+        }
+    }
+
+    net::SearchResponse::ResponsePtr ClientStub::RequestTokenSearch(const std::string& token, uint64_t limit,
+                                                                    const std::string& cursor)
+    {
+        auto requestPtr = std::make_shared<net::TokenSearchRequest::TokenSearchRequest>();
         auto responsePtr = std::make_shared<net::SearchResponse::SearchResponse>();
 
         requestPtr->getToken() = token;
+        requestPtr->getLimit() = limit;
+        requestPtr->getCursor() = cursor;
         execute("RequestTokenSearch", requestPtr, responsePtr);
 
         return responsePtr;
@@ -51,25 +96,127 @@ namespace anechka
         return responsePtr;
     }
 
-    net::ContextSearchResponse::ResponsePtr ClientStub::RequestTokenSearchWithContext(const std::string& token)
+    net::EraseResponse::ResponsePtr ClientStub::RequestDocumentDeletion(const std::string& path)
     {
-        auto requestPtr = std::make_shared<net::BasicToken::BasicToken>();
+        auto requestPtr = std::make_shared<net::Path::Path>();
+        auto responsePtr = std::make_shared<net::EraseResponse::EraseResponse>();
+
+        requestPtr->getPath() = path;
+        execute("RequestDocumentDeletion", requestPtr, responsePtr);
+
+        return responsePtr;
+    }
+
+    net::InsertResponse::ResponsePtr ClientStub::RequestDocumentReindex(const std::string& path)
+    {
+        auto requestPtr = std::make_shared<net::Path::Path>();
+        auto responsePtr = std::make_shared<net::InsertResponse::InsertResponse>();
+
+        requestPtr->getPath() = path;
+        execute("RequestDocumentReindex", requestPtr, responsePtr);
+
+        return responsePtr;
+    }
+
+    net::ContextSearchResponse::ResponsePtr ClientStub::RequestTokenSearchWithContext(const std::string& token,
+                                                                                      uint64_t limit,
+                                                                                      const std::string& cursor)
+    {
+        auto requestPtr = std::make_shared<net::TokenSearchRequest::TokenSearchRequest>();
         auto responsePtr = std::make_shared<net::ContextSearchResponse::ContextSearchResponse>();
 
         requestPtr->getToken() = token;
+        requestPtr->getLimit() = limit;
+        requestPtr->getCursor() = cursor;
         execute("RequestTokenSearchWithContext", requestPtr, responsePtr);
 
         return responsePtr;
     }
 
-    net::SearchQueryResponse::ResponsePtr ClientStub::RequestQuerySearch(const std::string& query)
+    net::SearchQueryResponse::ResponsePtr ClientStub::RequestQuerySearch(const std::string& query, uint64_t limit,
+                                                                         const std::string& cursor, bool ranked)
     {
         auto requestPtr = std::make_shared<net::SearchQueryRequest::SearchQueryRequest>();
         auto responsePtr = std::make_shared<net::SearchQueryResponse::SearchQueryResponse>();
 
         requestPtr->getQuery() = query;
+        requestPtr->getLimit() = limit;
+        requestPtr->getCursor() = cursor;
+        requestPtr->getRanked() = ranked;
         execute("RequestQuerySearch", requestPtr, responsePtr);
 
         return responsePtr;
     }
+
+    net::QueryStatsResponse::ResponsePtr ClientStub::RequestQueryStats(const std::string& query)
+    {
+        auto requestPtr = std::make_shared<net::SearchQueryRequest::SearchQueryRequest>();
+        auto responsePtr = std::make_shared<net::QueryStatsResponse::QueryStatsResponse>();
+
+        requestPtr->getQuery() = query;
+        requestPtr->getLimit() = 0;
+        requestPtr->getRanked() = true;
+        execute("RequestQueryStats", requestPtr, responsePtr);
+
+        return responsePtr;
+    }
+
+    net::TermExpansionResponse::ResponsePtr ClientStub::RequestTermExpansion(const std::string& pattern,
+                                                                             uint64_t limit, uint64_t maxEdits)
+    {
+        auto requestPtr = std::make_shared<net::TermExpansionRequest::TermExpansionRequest>();
+        auto responsePtr = std::make_shared<net::TermExpansionResponse::TermExpansionResponse>();
+
+        requestPtr->getPattern() = pattern;
+        requestPtr->getLimit() = limit;
+        requestPtr->getMaxedits() = maxEdits;
+        execute("RequestTermExpansion", requestPtr, responsePtr);
+
+        return responsePtr;
+    }
+
+    net::SearchQueryResponse::ResponsePtr ClientStub::RequestGlobalQuerySearch(
+        const std::shared_ptr<net::GlobalQueryRequest::GlobalQueryRequest>& requestPtr)
+    {
+        auto responsePtr = std::make_shared<net::SearchQueryResponse::SearchQueryResponse>();
+        execute("RequestGlobalQuerySearch", requestPtr, responsePtr);
+
+        return responsePtr;
+    }
+
+    net::MutationsResponse::ResponsePtr ClientStub::RequestMutations(uint64_t fromSeq, uint64_t limit)
+    {
+        auto requestPtr = std::make_shared<net::ReplicationRequest::ReplicationRequest>();
+        auto responsePtr = std::make_shared<net::MutationsResponse::MutationsResponse>();
+
+        requestPtr->getFromseq() = fromSeq;
+        requestPtr->getLimit() = limit;
+        execute("RequestMutations", requestPtr, responsePtr);
+
+        return responsePtr;
+    }
+
+    net::SnapshotResponse::ResponsePtr ClientStub::RequestSnapshot()
+    {
+        auto requestPtr = std::make_shared<net::ReplicationRequest::ReplicationRequest>();
+        auto responsePtr = std::make_shared<net::SnapshotResponse::SnapshotResponse>();
+
+        requestPtr->getFromseq() = 0;
+        requestPtr->getLimit() = 0;
+        execute("RequestSnapshot", requestPtr, responsePtr);
+
+        return responsePtr;
+    }
+
+    net::ReplicationStatusResponse::ResponsePtr ClientStub::RequestReplicationStatus()
+    {
+        auto requestPtr = std::make_shared<net::ReplicationRequest::ReplicationRequest>();
+        auto responsePtr = std::make_shared<net::ReplicationStatusResponse::ReplicationStatusResponse>();
+
+        requestPtr->getFromseq() = 0;
+        requestPtr->getLimit() = 0;
+        execute("RequestReplicationStatus", requestPtr, responsePtr);
+
+        return responsePtr;
+    }
 }
\ No newline at end of file
@@ -5,17 +5,56 @@
 
 namespace anechka
 {
+    struct Backend
+    {
+        std::string host;
+        int port;
+    };
+
     class ClientStub: public net::stub::AbstractClientStub
     {
     public:
         explicit ClientStub(int port = 4444);
+        ClientStub(const std::string& host, int port);
         virtual ~ClientStub() = default;
 
         net::InsertResponse::ResponsePtr RequestTxtFileIndexing(const std::string& path);
+        /**
+        * returns as soon as the indexing job has started, its jobId is to be passed to RequestJobStatus
+        */
         net::InsertResponse::ResponsePtr RequestRecursiveDirIndexing(const std::string& path);
-        net::SearchResponse::ResponsePtr RequestTokenSearch(const std::string& token);
+        net::JobStatusResponse::ResponsePtr RequestJobStatus(uint64_t jobId);
+        net::JobStatusResponse::ResponsePtr RequestJobCancel(uint64_t jobId);
+        /**
+        * polls the status of the job every pollMs until it is over, returns the last status received
+        */
+        net::JobStatusResponse::ResponsePtr AwaitJob(uint64_t jobId, size_t pollMs = 50);
+        /**
+        * limit 0 asks for the default page size, cursor is the nextCursor of the previous page
+        */
+        net::SearchResponse::ResponsePtr RequestTokenSearch(const std::string& token, uint64_t limit = 0,
+                                                            const std::string& cursor = "");
         net::EraseResponse::ResponsePtr RequestTokenDeletion(const std::string& token);
-        net::ContextSearchResponse::ResponsePtr RequestTokenSearchWithContext(const std::string& token);
-        net::SearchQueryResponse::ResponsePtr RequestQuerySearch(const std::string& query);
+        net::EraseResponse::ResponsePtr RequestDocumentDeletion(const std::string& path);
+        net::InsertResponse::ResponsePtr RequestDocumentReindex(const std::string& path);
+        net::ContextSearchResponse::ResponsePtr RequestTokenSearchWithContext(const std::string& token,
+                                                                              uint64_t limit = 0,
+                                                                              const std::string& cursor = "");
+        /**
+        * unless ranked, matches come in index order without being scored
+        */
+        net::SearchQueryResponse::ResponsePtr RequestQuerySearch(const std::string& query, uint64_t limit = 0,
+                                                                 const std::string& cursor = "", bool ranked = true);
+        net::QueryStatsResponse::ResponsePtr RequestQueryStats(const std::string& query);
+        /**
+        * maxEdits 0 expands pattern as a wildcard pattern, a positive one looks for tokens close to it
+        */
+        net::TermExpansionResponse::ResponsePtr RequestTermExpansion(const std::string& pattern, uint64_t limit = 0,
+                                                                     uint64_t maxEdits = 0);
+        net::SearchQueryResponse::ResponsePtr RequestGlobalQuerySearch(
+            const std::shared_ptr<net::GlobalQueryRequest::GlobalQueryRequest>& requestPtr);
+        net::MutationsResponse::ResponsePtr RequestMutations(uint64_t fromSeq, uint64_t limit);
+        net::SnapshotResponse::ResponsePtr RequestSnapshot();
+        net::ReplicationStatusResponse::ResponsePtr RequestReplicationStatus();
     };
 }
\ No newline at end of file
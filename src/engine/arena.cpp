@@ -0,0 +1,41 @@
+#include "arena.h"
+#include <algorithm>
+
+namespace core
+{
+    Arena::Stripe::Stripe(size_t initialBlockSize)
+        : m_resource(initialBlockSize)
+    {
+    }
+
+    void* Arena::Stripe::do_allocate(size_t bytes, size_t alignment)
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        return m_resource.allocate(bytes, alignment);
+    }
+
+    void Arena::Stripe::do_deallocate(void*, size_t, size_t)
+    {
+        /**
+        * memory is released all at once with the arena
+        */
+    }
+
+    bool Arena::Stripe::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+    {
+        return this == &other;
+    }
+
+    Arena::Arena(size_t stripeCount, size_t initialBlockSize)
+    {
+        for (size_t i = 0; i < std::max<size_t>(stripeCount, 1); i++)
+        {
+            m_stripes.push_back(std::make_unique<Stripe>(initialBlockSize));
+        }
+    }
+
+    std::pmr::memory_resource* Arena::resource(size_t hint)
+    {
+        return m_stripes[hint % m_stripes.size()].get();
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+namespace core
+{
+    class Arena
+    {
+        /**
+        * Arena backs structures that are built up piece by piece and released all at once, such as the
+        * in-memory buffer of a shard. Memory is carved out of growing blocks by monotonic resources and
+        * returned in bulk when the arena is destroyed, deallocations are no-ops. Writers are spread over
+        * stripes, each a monotonic resource behind its own lock, a structure picks its stripe with a hint
+        * and keeps allocating from it, e.g. a growing vector.
+        */
+    public:
+        explicit Arena(size_t stripeCount = 16, size_t initialBlockSize = size_t{1} << 14);
+        Arena(const Arena& other) = delete;
+        Arena& operator=(const Arena& other) = delete;
+        std::pmr::memory_resource* resource(size_t hint);
+
+        template<typename T, typename... Args>
+        T* make(size_t hint, Args&&... args)
+        {
+            /**
+            * the object is expected to be destroyed by its owner before the arena goes away
+            */
+            std::pmr::memory_resource* stripe = resource(hint);
+            return new (stripe->allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        }
+
+    private:
+        class Stripe : public std::pmr::memory_resource
+        {
+        public:
+            explicit Stripe(size_t initialBlockSize);
+
+        private:
+            void* do_allocate(size_t bytes, size_t alignment) override;
+            void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+        private:
+            std::mutex m_mtx;
+            std::pmr::monotonic_buffer_resource m_resource;
+        };
+
+        std::vector<std::unique_ptr<Stripe>> m_stripes;
+    };
+}
@@ -0,0 +1,258 @@
+#include "dir_watcher.h"
+#include <filesystem>
+#include <stdexcept>
+#include <vector>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace core
+{
+    static constexpr uint32_t WatchMask = IN_CREATE | IN_CLOSE_WRITE | IN_MODIFY | IN_DELETE |
+                                          IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF;
+    static constexpr std::chrono::milliseconds MaxTick{100};
+
+    DirWatcher::DirWatcher(Callback&& callback, size_t coalesceMs)
+        : m_callback(std::move(callback))
+        , m_coalesce(coalesceMs)
+    {
+        m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (m_fd < 0)
+        {
+            throw std::runtime_error("Failed to initialize inotify");
+        }
+        m_thread = std::thread(&DirWatcher::run, this);
+    }
+
+    DirWatcher::~DirWatcher()
+    {
+        m_isDone = true;
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+        close(m_fd);
+    }
+
+    bool DirWatcher::watch(const std::string& strPath)
+    {
+        const std::filesystem::path dirPath = std::filesystem::u8path(strPath);
+        std::error_code err;
+        if (!std::filesystem::is_directory(dirPath, err))
+        {
+            return false;
+        }
+        if (!addWatch(dirPath.string()))
+        {
+            return false;
+        }
+        for (const auto& dirEntry: std::filesystem::recursive_directory_iterator(dirPath, err))
+        {
+            if (dirEntry.is_directory(err))
+            {
+                addWatch(dirEntry.path().string());
+            }
+            else if (dirEntry.is_regular_file(err))
+            {
+                std::unique_lock<std::mutex> lock(m_watchMtx);
+                m_files.insert(dirEntry.path().string());
+            }
+        }
+        return true;
+    }
+
+    size_t DirWatcher::watchCount() const
+    {
+        std::unique_lock<std::mutex> lock(m_watchMtx);
+        return m_watches.size();
+    }
+
+    bool DirWatcher::addWatch(const std::string& dir)
+    {
+        const int wd = inotify_add_watch(m_fd, dir.c_str(), WatchMask);
+        if (wd < 0)
+        {
+            return false;
+        }
+        std::unique_lock<std::mutex> lock(m_watchMtx);
+        m_watches[wd] = dir;
+        return true;
+    }
+
+    void DirWatcher::forgetDir(const std::string& dir)
+    {
+        const std::string prefix = dir + '/';
+        const auto isUnder = [&dir, &prefix](const std::string& path) {
+            return path == dir || path.compare(0, prefix.size(), prefix) == 0;
+        };
+
+        std::vector<std::string> removed;
+        {
+            std::unique_lock<std::mutex> lock(m_watchMtx);
+            for (auto it = m_watches.begin(); it != m_watches.end();)
+            {
+                if (isUnder(it->second))
+                {
+                    /**
+                    * the watch of a moved directory outlives the move, IN_IGNORED of a removed one finds nothing
+                    */
+                    inotify_rm_watch(m_fd, it->first);
+                    it = m_watches.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+            for (auto it = m_files.lower_bound(prefix); it != m_files.end() && isUnder(*it);)
+            {
+                removed.push_back(*it);
+                it = m_files.erase(it);
+            }
+        }
+        for (const std::string& path: removed)
+        {
+            note(path, WatchEvent::Remove);
+        }
+    }
+
+    void DirWatcher::run()
+    {
+        pollfd pfd{m_fd, POLLIN, 0};
+        const int tick = (int)std::min(m_coalesce, MaxTick).count();
+        while (!m_isDone)
+        {
+            const int ready = poll(&pfd, 1, tick);
+            if (ready > 0 && (pfd.revents & POLLIN))
+            {
+                readEvents();
+            }
+            flush();
+        }
+    }
+
+    void DirWatcher::readEvents()
+    {
+        alignas(inotify_event) char buffer[4096];
+        while (true)
+        {
+            const ssize_t len = read(m_fd, buffer, sizeof(buffer));
+            if (len <= 0)
+            {
+                return;
+            }
+
+            for (char* ptr = buffer; ptr < buffer + len;)
+            {
+                const auto* event = reinterpret_cast<const inotify_event*>(ptr);
+                ptr += sizeof(inotify_event) + event->len;
+
+                std::string dir;
+                {
+                    std::unique_lock<std::mutex> lock(m_watchMtx);
+                    auto it = m_watches.find(event->wd);
+                    if (it == m_watches.end())
+                    {
+                        continue;
+                    }
+                    if (event->mask & IN_IGNORED)
+                    {
+                        m_watches.erase(it);
+                        continue;
+                    }
+                    dir = it->second;
+                }
+                if (event->mask & (IN_DELETE_SELF | IN_MOVE_SELF))
+                {
+                    /**
+                    * a watched directory gone without an event in its parent, e.g. the root of a tree. A watch
+                    * belongs to the inode, so one moved within the trees is already registered at its new path
+                    */
+                    std::error_code err;
+                    if ((event->mask & IN_DELETE_SELF) || !std::filesystem::is_directory(dir, err))
+                    {
+                        forgetDir(dir);
+                    }
+                    continue;
+                }
+                if (event->len == 0)
+                {
+                    continue;
+                }
+
+                const std::string path = (std::filesystem::path(dir) / event->name).string();
+                if (event->mask & IN_ISDIR)
+                {
+                    if (event->mask & (IN_CREATE | IN_MOVED_TO))
+                    {
+                        /**
+                        * Files may land in a fresh directory before its watch is registered,
+                        * so whatever is already there is reported right away
+                        */
+                        watch(path);
+                        std::error_code err;
+                        for (const auto& dirEntry: std::filesystem::recursive_directory_iterator(path, err))
+                        {
+                            if (dirEntry.is_regular_file(err))
+                            {
+                                note(dirEntry.path().string(), WatchEvent::Upsert);
+                            }
+                        }
+                    }
+                    else if (event->mask & (IN_DELETE | IN_MOVED_FROM))
+                    {
+                        forgetDir(path);
+                    }
+                    continue;
+                }
+
+                if (event->mask & (IN_DELETE | IN_MOVED_FROM))
+                {
+                    note(path, WatchEvent::Remove);
+                }
+                else if (event->mask & (IN_CREATE | IN_CLOSE_WRITE | IN_MODIFY | IN_MOVED_TO))
+                {
+                    note(path, WatchEvent::Upsert);
+                }
+            }
+        }
+    }
+
+    void DirWatcher::note(const std::string& path, WatchEvent event)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_watchMtx);
+            if (event == WatchEvent::Upsert)
+            {
+                m_files.insert(path);
+            }
+            else
+            {
+                m_files.erase(path);
+            }
+        }
+        m_pending[path] = PendingEvent{event, std::chrono::steady_clock::now()};
+    }
+
+    void DirWatcher::flush()
+    {
+        const auto now = std::chrono::steady_clock::now();
+        std::vector<std::pair<std::string, WatchEvent>> due;
+        for (auto it = m_pending.begin(); it != m_pending.end();)
+        {
+            if (now - it->second.lastSeen >= m_coalesce)
+            {
+                due.emplace_back(it->first, it->second.event);
+                it = m_pending.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        for (auto&& [path, event]: due)
+        {
+            m_callback(path, event);
+        }
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+namespace core
+{
+    enum class WatchEvent : int8_t
+    {
+        Upsert = 0,
+        Remove = 1,
+    };
+
+    class DirWatcher
+    {
+        /**
+        * DirWatcher registers inotify watches on directory trees and reports file level changes through
+        * the callback. Bursts of events targeting the same file (e.g. create followed by several writes)
+        * are coalesced: a file is reported only once it has been quiet for the coalescing window, and only
+        * the last observed event is delivered.
+        *
+        * The files seen under the watched trees are kept track of, so a directory moved out of a tree or
+        * deleted along with it is reported as the removal of every file it held, and its watches are dropped.
+        */
+    public:
+        using Callback = std::function<void(const std::string& path, WatchEvent event)>;
+
+        DirWatcher(Callback&& callback, size_t coalesceMs);
+        ~DirWatcher();
+        DirWatcher(const DirWatcher& other) = delete;
+        DirWatcher& operator=(const DirWatcher& other) = delete;
+        bool watch(const std::string& strPath);
+        size_t watchCount() const;
+
+    private:
+        struct PendingEvent
+        {
+            WatchEvent event;
+            std::chrono::steady_clock::time_point lastSeen;
+        };
+
+        bool addWatch(const std::string& dir);
+        void forgetDir(const std::string& dir);
+        void run();
+        void readEvents();
+        void note(const std::string& path, WatchEvent event);
+        void flush();
+
+    private:
+        int m_fd{-1};
+        Callback m_callback;
+        std::chrono::milliseconds m_coalesce;
+        mutable std::mutex m_watchMtx;
+        std::unordered_map<int, std::string> m_watches;
+        /**
+        * ordered, so the files under a directory make a range
+        */
+        std::set<std::string> m_files;
+        std::unordered_map<std::string, PendingEvent> m_pending;
+        std::atomic<bool> m_isDone{false};
+        std::thread m_thread;
+    };
+
+    using DirWatcherPtr = std::unique_ptr<DirWatcher>;
+}
@@ -1,97 +1,273 @@
 #include "doc_trace.h"
+#include <algorithm>
+#include <limits>
 
 namespace core
 {
+    static constexpr DocId InvalidDocId = std::numeric_limits<DocId>::max();
+
     void to_json(Json& json, const DocStat& docStat)
     {
-        json = Json {{"tokenCount", docStat.tokenCount}};
+        json = Json {{"tokenCount", docStat.tokenCount}, {"mtime", docStat.mtime}};
     }
 
     void from_json(const Json& json, DocStat& docStat)
     {
         json.at("tokenCount").get_to(docStat.tokenCount);
+        if (json.contains("mtime"))
+        {
+            json.at("mtime").get_to(docStat.mtime);
+        }
+    }
+
+    DocTrace::DocTrace(size_t reserve, DocId firstId, DocId idStride)
+        : m_idStride(idStride)
+        , m_nextId(firstId)
+        , m_ids(reserve)
+        , m_paths(reserve)
+        , m_stats(reserve)
+        , m_refs(reserve)
+    {
     }
 
-    static float approxRollingAverage(size_t size, float avg, float newSample)
+    DocId DocTrace::addOrGet(const std::string& path, DocStat&& docStat, bool& isNew)
     {
-        avg -= avg / size;
-        avg += newSample / size;
+        isNew = false;
+        bool found = false;
+        DocId docId = getId(path, found);
+        if (found)
+        {
+            return docId;
+        }
+
+        const DocId fresh = m_nextId.fetch_add(m_idStride);
+        m_tokenCounts.store(fresh / m_idStride, (uint32_t)std::min<size_t>(docStat.tokenCount, UINT32_MAX));
+        m_paths.insert(fresh, path);
+        m_stats.insert(fresh, docStat);
+        m_refs.insert(fresh, 0);
 
-        return avg;
+        m_ids.mutate(path, [&](const auto& it, bool iterValid, bool& shouldErase) {
+            shouldErase = false;
+            if (iterValid)
+            {
+                docId = it->second;
+                return docId;
+            }
+            isNew = true;
+            docId = fresh;
+            return fresh;
+        });
+
+        if (!isNew)
+        {
+            /**
+            * Another thread has registered the same path in the meantime, the spare id is never published
+            */
+            m_tombstones.set(fresh);
+            m_refs.erase(fresh);
+            m_stats.erase(fresh);
+            m_tokenCounts.store(fresh / m_idStride, 0);
+            m_paths.erase(fresh);
+            return docId;
+        }
+
+        m_totalTokenCount += docStat.tokenCount;
+        return docId;
     }
 
-    DocTrace::DocTrace(size_t reserve)
-        : m_trace(reserve)
-        , m_stats(reserve)
+    DocId DocTrace::addOrIncrement(const std::string& path, DocStat&& docStat)
     {
+        bool isNew;
+        const DocId docId = addOrGet(path, std::move(docStat), isNew);
+        increment(docId);
+        return docId;
     }
 
-    std::string_view DocTrace::addOrIncrement(const std::string& path, DocStat&& docStat)
+    void DocTrace::increment(DocId docId)
     {
-        std::string_view hook;
-        auto callback = [&hook](const auto& it, bool iterValid, bool& shouldErase) {
-            shouldErase = false;
+        m_refs.mutate(docId, [](const auto& it, bool iterValid, bool& shouldErase) {
+            shouldErase = !iterValid;
             if (iterValid)
             {
                 it->second++;
-                hook = it->first;
             }
-            return 0;
-        };
+            return size_t{0};
+        });
+    }
 
-        m_trace.mutate(path, callback);
-        if (hook.empty())
+    void DocTrace::decrement(DocId docId)
+    {
+        bool isDrained = false;
+        m_refs.mutate(docId, [&isDrained](const auto& it, bool iterValid, bool& shouldErase) {
+            shouldErase = !iterValid;
+            if (iterValid && it->second > 0)
+            {
+                it->second--;
+                isDrained = it->second == 0;
+            }
+            return size_t{0};
+        });
+        if (isDrained)
         {
-            m_trace.mutate(path, callback);
-            m_stats.insert(hook, docStat);
-            m_avgTokenCount = approxRollingAverage(m_trace.size(), m_avgTokenCount, (float)docStat.tokenCount);
+            if (!isAlive(docId))
+            {
+                m_tombstoneCount--;
+                m_tombstoneTokenCount -= m_stats.get(docId).tokenCount;
+            }
+            forget(docId);
         }
-
-        return hook;
     }
 
     void DocTrace::eraseOrDecrement(const std::string& path)
     {
-        m_trace.mutate(path, [](const auto& it, bool iterValid, bool& shouldErase) {
-            shouldErase = false;
+        bool found = false;
+        const DocId docId = getId(path, found);
+        if (found)
+        {
+            decrement(docId);
+        }
+    }
+
+    bool DocTrace::remove(const std::string& path)
+    {
+        bool isRemoved = false;
+        DocId docId = InvalidDocId;
+        m_ids.mutate(path, [&](const auto& it, bool iterValid, bool& shouldErase) {
+            shouldErase = true;
             if (iterValid)
             {
-                it->second--;
-                if (it->second == 0)
-                {
-                    shouldErase = true;
-                }
+                isRemoved = true;
+                docId = it->second;
             }
-            return 0;
+            return docId;
+        });
+        if (!isRemoved)
+        {
+            return false;
+        }
+
+        const size_t tokenCount = m_stats.get(docId).tokenCount;
+        m_totalTokenCount -= tokenCount;
+        m_tombstones.set(docId);
+        if (m_refs.get(docId) == 0)
+        {
+            /**
+            * nothing references the document, there is nothing to compact either
+            */
+            forget(docId);
+        }
+        else
+        {
+            m_tombstoneCount++;
+            m_tombstoneTokenCount += tokenCount;
+        }
+        return true;
+    }
+
+    void DocTrace::forget(DocId docId)
+    {
+        const std::string path = m_paths.get(docId);
+        bool isRegistered = false;
+        m_ids.mutate(path, [docId, &isRegistered](const auto& it, bool iterValid, bool& shouldErase) {
+            isRegistered = iterValid && it->second == docId;
+            shouldErase = !iterValid || isRegistered;
+            return docId;
         });
-        if (!m_trace.contains(path))
+        if (isRegistered)
         {
-            m_stats.erase(path);
+            m_totalTokenCount -= m_stats.get(docId).tokenCount;
         }
+        m_refs.erase(docId);
+        m_stats.erase(docId);
+        m_tokenCounts.store(docId / m_idStride, 0);
+        m_paths.erase(docId);
+    }
+
+    bool DocTrace::isAlive(DocId docId) const
+    {
+        return !m_tombstones.test(docId);
+    }
+
+    DocId DocTrace::getId(const std::string& path, bool& found) const
+    {
+        const DocId docId = m_ids.get(path, InvalidDocId);
+        found = docId != InvalidDocId;
+        return docId;
+    }
+
+    std::string DocTrace::getPath(DocId docId) const
+    {
+        return m_paths.get(docId);
+    }
+
+    DocStat DocTrace::getStat(DocId docId) const
+    {
+        return m_stats.get(docId, DocStat{0});
     }
 
     size_t DocTrace::getRefCount(const std::string& path) const
     {
-        return m_trace.get(path);
+        bool found = false;
+        const DocId docId = getId(path, found);
+        return found ? m_refs.get(docId) : 0;
     }
 
     size_t DocTrace::getTokenCount(const std::string& path) const
     {
-        return m_stats.get(path).tokenCount;
+        bool found = false;
+        const DocId docId = getId(path, found);
+        return found ? getTokenCount(docId) : 0;
+    }
+
+    size_t DocTrace::getTokenCount(DocId docId) const
+    {
+        return m_tokenCounts.load(docId / m_idStride);
     }
 
     float DocTrace::getAvgTokenCount() const
     {
-        return m_avgTokenCount;
+        const size_t docs = m_ids.size();
+        return docs > 0 ? (float)m_totalTokenCount / docs : 0.0f;
+    }
+
+    size_t DocTrace::getTotalTokenCount() const
+    {
+        return m_totalTokenCount;
+    }
+
+    size_t DocTrace::getTombstoneCount() const
+    {
+        return m_tombstoneCount;
+    }
+
+    size_t DocTrace::getTombstoneTokenCount() const
+    {
+        return m_tombstoneTokenCount;
     }
 
     size_t DocTrace::size() const
     {
-        return m_trace.size();
+        return m_ids.size();
+    }
+
+    std::vector<std::string> DocTrace::paths() const
+    {
+        std::vector<std::string> paths;
+        paths.reserve(m_ids.size());
+        for (auto&& [path, _]: m_ids.iterate())
+        {
+            paths.push_back(path);
+        }
+        return paths;
     }
 
     Json DocTrace::serialize() const
     {
-        return m_stats.serialize();
+        Json trace = Json::object();
+        for (auto&& [path, docId]: m_ids.iterate())
+        {
+            trace[path] = getStat(docId);
+        }
+        return trace;
     }
-}
\ No newline at end of file
+}
@@ -1,12 +1,17 @@
 #pragma once
 
 #include "umap.h"
+#include "bitmap.h"
+#include "atomic_array.h"
 
 namespace core
 {
+    using DocId = uint32_t;
+
     struct DocStat
     {
         size_t tokenCount;
+        int64_t mtime{0};
     };
 
     void to_json(Json& json, const DocStat& docStat);
@@ -16,22 +21,63 @@ namespace core
     {
         /**
         * DocTrace is responsible for keeping track of currently indexed documents and their statistics
-        * (e.g the number of tokens in a particular document). Documents are reference-counted and those
-        * not in use are deleted using eraseOrDecrement.
+        * (e.g the number of tokens in a particular document). Every indexed version of a document is
+        * assigned its own DocId, postings refer to documents by id. Documents are reference-counted
+        * by the parts of the index holding their postings and those not in use are deleted using
+        * eraseOrDecrement/decrement.
+        *
+        * Ids are handed out as firstId + k * idStride, which lets several traces share one id space.
+        *
+        * Removing a document only detaches its path and marks the id as a tombstone, so the call is O(1).
+        * Postings of tombstones are filtered at query time until they are merged away, the tombstone
+        * count only covers documents whose postings are still around.
         */
     public:
-        explicit DocTrace(size_t reserve);
-        std::string_view addOrIncrement(const std::string& path, DocStat&& docStat);
+        explicit DocTrace(size_t reserve, DocId firstId = 0, DocId idStride = 1);
+        DocId addOrGet(const std::string& path, DocStat&& docStat, bool& isNew);
+        DocId addOrIncrement(const std::string& path, DocStat&& docStat);
+        void increment(DocId docId);
+        void decrement(DocId docId);
         void eraseOrDecrement(const std::string& path);
+        bool remove(const std::string& path);
+        bool isAlive(DocId docId) const;
+        DocId getId(const std::string& path, bool& found) const;
+        std::string getPath(DocId docId) const;
+        DocStat getStat(DocId docId) const;
         size_t getRefCount(const std::string& path) const;
         size_t getTokenCount(const std::string& path) const;
+        size_t getTokenCount(DocId docId) const;
         float getAvgTokenCount() const;
+        size_t getTotalTokenCount() const;
+        size_t getTombstoneCount() const;
+        /**
+        * the sum of token counts of the tombstones, see getTombstoneCount
+        */
+        size_t getTombstoneTokenCount() const;
         size_t size() const;
+        std::vector<std::string> paths() const;
         Json serialize() const;
 
     private:
-        std::atomic<float> m_avgTokenCount{0.0f};
-        SUMap<std::string, size_t> m_trace;
-        SUMap<std::string_view, DocStat> m_stats;
+        void forget(DocId docId);
+
+    private:
+        /**
+        * the sum of token counts of registered documents, kept up to date on add and remove
+        */
+        std::atomic<size_t> m_totalTokenCount{0};
+        const DocId m_idStride;
+        std::atomic<DocId> m_nextId;
+        std::atomic<size_t> m_tombstoneCount{0};
+        std::atomic<size_t> m_tombstoneTokenCount{0};
+        SUMap<std::string, DocId> m_ids;
+        SUMap<DocId, std::string> m_paths;
+        SUMap<DocId, DocStat> m_stats;
+        SUMap<DocId, size_t> m_refs;
+        utils::AtomicBitmap m_tombstones;
+        /**
+        * token counts by docId / idStride, read by scoring for every matched document without a lock
+        */
+        utils::AtomicArray<uint32_t> m_tokenCounts;
     };
 }
@@ -1,19 +1,85 @@
 #include "engine.h"
 #include "../mmap/mmap.h"
+#include "../mmap/uring_reader.h"
+#include "unicode.h"
+#include "routing.h"
 #include <filesystem>
 #include <fstream>
 #include <chrono>
+#include <tuple>
 
 namespace core
 {
-    static auto tokenize(const std::unique_ptr<const MMapASCII>& mmap, bool toLowercase=false)
+    /**
+    * the files a reader reads through io_uring at once
+    */
+    static constexpr size_t UringBatch = 16;
+
+    static std::vector<TokenView> viewsOf(const DocTokens& tokens)
+    {
+        std::vector<TokenView> views;
+        views.reserve(tokens.size());
+        for (const auto& [token, pos]: tokens)
+        {
+            views.emplace_back(token, pos);
+        }
+        return views;
+    }
+
+    static std::unordered_map<std::string, DocTokens> regroupByDocument(const Json& dump)
     {
-        return detail::tokenizeRange(mmap->begin(), mmap->end(), toLowercase);
+        /**
+        * the dump is keyed by token, postings are regrouped by document to be indexed a document at a time
+        */
+        std::unordered_map<std::string, DocTokens> docs;
+        for (auto&& [token, info]: dump.items())
+        {
+            for (auto& it: info)
+            {
+                docs[it.at(0).get<std::string>()].emplace_back(token, it.at(1).get<size_t>());
+            }
+        }
+        return docs;
     }
 
-    static auto tokenize(const std::string& query, bool toLowercase=false)
+    static void writeText(Json& mutation, std::string_view text)
     {
-        return detail::tokenizeRange(query.begin(), query.end(), toLowercase);
+        /**
+        * JSON strings hold UTF-8, a text that is not valid UTF-8 is logged a byte per code point instead
+        */
+        if (unicode::isValid(text))
+        {
+            mutation["text"] = std::string(text);
+            return;
+        }
+        std::string bytes;
+        bytes.reserve(text.size());
+        for (const char ch: text)
+        {
+            unicode::encode(static_cast<unsigned char>(ch), bytes);
+        }
+        mutation["bytes"] = std::move(bytes);
+    }
+
+    static std::string readText(const Json& mutation)
+    {
+        if (mutation.contains("text"))
+        {
+            return mutation.at("text").get<std::string>();
+        }
+        const std::string bytes = mutation.at("bytes").get<std::string>();
+        std::string text;
+        text.reserve(bytes.size());
+        for (size_t i = 0; i < bytes.size();)
+        {
+            char32_t cp;
+            if (!unicode::decode(bytes.data(), bytes.size(), i, cp) || cp > 0xFF)
+            {
+                throw std::invalid_argument("Malformed bytes of a logged text");
+            }
+            text += static_cast<char>(cp);
+        }
+        return text;
     }
 
     cache::Cache::Cache(size_t reserve, float maxLF)
@@ -74,10 +140,26 @@ namespace core
         m_params = params;
         const size_t queues = params.threads / 3 > 0 ? params.threads / 3 : 1;
 
-        m_storage = std::make_shared<Shard>(params.maxLF, params.size, params.docs);
+        /**
+        * shards share the vocabulary to a large degree but split the documents, so they share the interner
+        * as well and a token is stored once per engine. Their tables reserve a share of the expected
+        * vocabulary as they do of the documents and grow from there, reserving all of it in every shard
+        * would take memory proportional to the shard count up front
+        */
+        const size_t shards = params.shards > 0 ? params.shards : 1;
+        const SegmentPolicy policy{params.segmentBufferPostings, params.mergeFactor, params.compactionRatio};
+        const auto terms = std::make_shared<TermInterner>();
+        for (size_t i = 0; i < shards; i++)
+        {
+            m_shards.push_back(std::make_shared<Shard>(params.maxLF, params.size / shards + 1,
+                                                       params.docs / shards + 1, policy, i, shards, terms));
+        }
+        m_isMaintaining = std::make_unique<std::atomic<bool>[]>(shards);
         m_cache = std::make_shared<cache::Cache>((sizeof(CacheType::All) / 8) * 2, params.maxLF);
+        m_replicationLog = std::make_unique<ReplicationLog>(params.replicationLogBytes);
         m_pool = std::make_unique<ThreadPool>(queues, params.threads, true);
-        m_semantics = SemanticParams{params.toLowercase};
+        m_jobs = std::make_unique<IndexJobs>(params.maxInFlightFiles);
+        m_semantics = SemanticParams{params.toLowercase, params.nfcTokens};
 
         initCache(params.size * params.cacheSize);
     }
@@ -91,146 +173,741 @@ namespace core
     }
 
     bool SearchEngine::indexDir(const std::string& strPath)
+    {
+        uint64_t jobId;
+        if (!startIndexing(strPath, jobId))
+        {
+            return false;
+        }
+        const IndexJobPtr job = m_jobs->find(jobId);
+        if (job)
+        {
+            job->wait();
+        }
+        return true;
+    }
+
+    bool SearchEngine::startIndexing(const std::string& strPath, uint64_t& jobId)
     {
         const std::filesystem::path dirPath = std::filesystem::u8path(strPath);
-        if (!std::filesystem::exists(dirPath))
+        std::error_code err;
+        if (!std::filesystem::exists(dirPath, err))
         {
             return false;
         }
 
-        std::vector<WaitableFuture> futures;
-        for (const auto& dirEntry: std::filesystem::recursive_directory_iterator(strPath))
+        /**
+        * readers mostly wait for the disk, tokenizers keep as many threads busy as the pool has,
+        * and every shard gets a merger of its own
+        */
+        IndexPipeline pipeline;
+        pipeline.read = [this](IndexedFile& file) {
+            return readFile(file);
+        };
+        pipeline.tokenize = [this](IndexedFile& file) {
+            return tokenizeFile(file);
+        };
+        pipeline.merge = [this](IndexedFile& file) {
+            return mergeFile(file);
+        };
+        pipeline.route = [this](const IndexedFile& file) {
+            return shardIdx(file.path);
+        };
+        if (m_params.uringReader)
         {
-            std::filesystem::path path = dirEntry.path();
-            if (path.extension() == ".txt")
-            {
-                futures.push_back(m_pool->submitTask(
-                    [this, path = std::move(path)] {
-                        indexTxtFile(std::move(path.relative_path()));
+            /**
+            * every reader sets up a ring of its own, readers of a kernel without io_uring map every file
+            */
+            pipeline.batchRead = [this]() -> IndexPipeline::BatchStage {
+                std::shared_ptr<UringReader> reader;
+                try
+                {
+                    reader = std::make_shared<UringReader>(UringBatch);
+                }
+                catch (const std::exception& err)
+                {
+                    return nullptr;
+                }
+                return [this, reader](std::vector<IndexedFile>& files, std::vector<StageResult>& results) {
+                    readFiles(*reader, files, results);
+                };
+            };
+            pipeline.readBatch = UringBatch;
+        }
+        pipeline.readers = m_params.indexReaders;
+        pipeline.tokenizers = m_params.threads;
+        pipeline.mergers = m_shards.size();
+        jobId = m_jobs->start(dirPath, std::move(pipeline));
+        return true;
+    }
+
+    bool SearchEngine::jobStatus(uint64_t jobId, IndexJobStatus& status) const
+    {
+        return m_jobs->status(jobId, status);
+    }
+
+    bool SearchEngine::cancelJob(uint64_t jobId, IndexJobStatus& status)
+    {
+        return m_jobs->cancel(jobId, status);
+    }
+
+    bool SearchEngine::watchDir(const std::string& strPath)
+    {
+        std::unique_lock<std::mutex> lock(m_watcherMtx);
+        if (!m_watcher)
+        {
+            auto callback = [this](const std::string& path, WatchEvent event) {
+                if (std::filesystem::path(path).extension() != ".txt")
+                {
+                    return;
+                }
+                m_pool->submitTask(
+                    [this, path, event] {
+                        applyWatchEvent(path, event);
                     },
-                    true));
+                    false, TaskPriority::Background);
+            };
+            try
+            {
+                m_watcher = std::make_unique<DirWatcher>(std::move(callback), m_params.watchCoalesceMs);
+            }
+            catch (const std::exception& err)
+            {
+                return false;
             }
         }
-        return true;
+        return m_watcher->watch(strPath);
+    }
+
+    void SearchEngine::applyWatchEvent(const std::string& path, WatchEvent event)
+    {
+        switch (event)
+        {
+            case WatchEvent::Upsert:
+                indexTxtFile(std::string{path});
+                break;
+            case WatchEvent::Remove:
+                deleteDocument(path);
+                break;
+        }
     }
 
     bool SearchEngine::indexTxtFile(std::string&& strPath)
     {
-        const std::filesystem::path path = std::filesystem::u8path(strPath);
+        IndexedFile file(std::move(strPath), 0);
+        StageResult result = readFile(file);
+        if (result == StageResult::Next)
+        {
+            result = tokenizeFile(file);
+        }
+        if (result == StageResult::Next)
+        {
+            result = mergeFile(file);
+        }
+        return result == StageResult::Done;
+    }
+
+    StageResult SearchEngine::readFile(IndexedFile& file) const
+    {
+        const StageResult result = checkFile(file);
+        return result == StageResult::Next && !isStreamed(file) ? mapFile(file) : result;
+    }
+
+    StageResult SearchEngine::checkFile(IndexedFile& file) const
+    {
+        /**
+        * a file indexed at its current version needs no reading, an outdated version is replaced on merge
+        */
+        const std::filesystem::path path = std::filesystem::u8path(file.path);
         if (path.extension() != ".txt")
         {
-            return false;
+            return StageResult::Failed;
         }
-        if (!std::filesystem::exists(path))
+        std::error_code err;
+        file.stat.mtime = std::filesystem::last_write_time(path, err).time_since_epoch().count();
+        if (err)
         {
-            return false;
+            return StageResult::Failed;
+        }
+
+        DocStat indexed{};
+        if (m_shards[shardIdx(file.path)]->findDocument(file.path, indexed) && indexed.mtime == file.stat.mtime)
+        {
+            return StageResult::Done;
+        }
+        if (file.bytes == 0)
+        {
+            file.bytes = std::filesystem::file_size(path, err);
+        }
+        return StageResult::Next;
+    }
+
+    StageResult SearchEngine::mapFile(IndexedFile& file) const
+    {
+        try
+        {
+            file.mmap = std::make_unique<const MMapASCII>(std::filesystem::u8path(file.path));
+        }
+        catch (const std::exception& err)
+        {
+            return StageResult::Failed;
+        }
+        file.mmap->willNeed();
+        file.text = file.mmap->view();
+        return StageResult::Next;
+    }
+
+    void SearchEngine::readFiles(UringReader& reader, std::vector<IndexedFile>& files,
+                                 std::vector<StageResult>& results) const
+    {
+        /**
+        * files smaller than a buffer of the reader are read with a single submission, the rest are mapped,
+        * as are the ones the reader leaves, e.g. having grown since they were crawled
+        */
+        std::vector<std::string> paths;
+        std::vector<size_t> batched;
+        for (size_t i = 0; i < files.size(); i++)
+        {
+            results[i] = checkFile(files[i]);
+            if (results[i] == StageResult::Next && !isStreamed(files[i]) && files[i].bytes < UringReader::BufferSize)
+            {
+                paths.push_back(files[i].path);
+                batched.push_back(i);
+            }
         }
 
-        std::unique_ptr<const MMapASCII> mmap;
+        std::vector<ReadBufferPtr> buffers;
+        reader.read(paths, buffers);
+        for (size_t i = 0; i < batched.size(); i++)
+        {
+            IndexedFile& file = files[batched[i]];
+            if (buffers[i])
+            {
+                file.text = buffers[i]->view();
+                file.buffer = std::move(buffers[i]);
+            }
+        }
+        for (size_t i = 0; i < files.size(); i++)
+        {
+            if (results[i] == StageResult::Next && !isStreamed(files[i]) && !files[i].mmap && !files[i].buffer)
+            {
+                results[i] = mapFile(files[i]);
+            }
+        }
+    }
+
+    StageResult SearchEngine::tokenizeFile(IndexedFile& file) const
+    {
+        if (isStreamed(file))
+        {
+            return streamFile(file);
+        }
+        file.tokens = std::make_unique<const TokenizedText>(file.text, m_semantics.lcaseTokens, m_semantics.nfcTokens);
+        file.stat.tokenCount = file.tokens->size();
+        return StageResult::Next;
+    }
+
+    StageResult SearchEngine::streamFile(IndexedFile& file) const
+    {
+        /**
+        * neither the file nor the tokens of more than a window are held at once, the tokens are grouped
+        * by the shard of the file as they come
+        */
+        auto postings = std::make_unique<DocPostings>();
         try
         {
-            mmap = std::make_unique<const MMapASCII>(path);
+            TokenStream stream(std::filesystem::u8path(file.path), m_semantics.lcaseTokens, m_semantics.nfcTokens);
+            const ShardPtr& shard = m_shards[shardIdx(file.path)];
+            while (stream.next())
+            {
+                shard->collect(stream.tokens(), *postings);
+                if (isLogging())
+                {
+                    file.logged += stream.text();
+                }
+            }
+            if (stream.isFailed())
+            {
+                return StageResult::Failed;
+            }
         }
         catch (const std::exception& err)
+        {
+            return StageResult::Failed;
+        }
+        file.stat.tokenCount = postings->count;
+        file.postings = std::move(postings);
+        return StageResult::Next;
+    }
+
+    bool SearchEngine::isStreamed(const IndexedFile& file) const
+    {
+        return file.bytes >= m_params.streamThreshold;
+    }
+
+    StageResult SearchEngine::mergeFile(IndexedFile& file)
+    {
+        const bool ok = file.postings
+                            ? upsertDocument(file.path, std::move(file.stat), *file.postings, file.logged)
+                            : upsertDocument(file.path, std::move(file.stat), file.tokens->tokens(), file.text);
+        return ok ? StageResult::Done : StageResult::Failed;
+    }
+
+    bool SearchEngine::isIndexed(const std::string& strPath, const DocStat& docStat)
+    {
+        /**
+        * true if the version of the document is indexed already, an outdated version is deleted
+        */
+        DocStat indexed{};
+        if (m_shards[shardIdx(strPath)]->findDocument(strPath, indexed))
+        {
+            if (indexed.mtime == docStat.mtime)
+            {
+                return true;
+            }
+            deleteLocked(strPath);
+        }
+        return false;
+    }
+
+    bool SearchEngine::upsertDocument(const std::string& strPath, DocStat&& docStat,
+                                      const std::vector<TokenView>& tokens, std::string_view text)
+    {
+        /**
+        * replaces an outdated version of the document, indexing the version already indexed is a no-op
+        */
+        const PathLock lock = lockPath(strPath);
+        if (isIndexed(strPath, docStat))
+        {
+            return true;
+        }
+
+        const size_t idx = shardIdx(strPath);
+        Json mutation = upsertMutation(strPath, docStat, text);
+        if (!m_shards[idx]->insertDocument(strPath, std::move(docStat), tokens))
         {
             return false;
         }
+        invalidateCache();
+        scheduleMaintenance(idx);
+        log(std::move(mutation));
+        return true;
+    }
 
-        auto tokens = tokenize(mmap, m_semantics.lcaseTokens);
-//        printf("%s%s%s%zu\n", "Indexing ", strPath.c_str(), "; tokens: ", tokens.size());
+    bool SearchEngine::upsertDocument(const std::string& strPath, DocStat&& docStat, const DocPostings& postings,
+                                      std::string_view text)
+    {
+        const PathLock lock = lockPath(strPath);
+        if (isIndexed(strPath, docStat))
+        {
+            return true;
+        }
 
-        for (auto&& token: tokens)
+        const size_t idx = shardIdx(strPath);
+        Json mutation = upsertMutation(strPath, docStat, text);
+        if (!m_shards[idx]->insertDocument(strPath, std::move(docStat), postings))
         {
-            insert(std::move(token.first), strPath, {tokens.size()}, token.second);
+            return false;
         }
+        invalidateCache();
+        scheduleMaintenance(idx);
+        log(std::move(mutation));
         return true;
     }
 
+    Json SearchEngine::upsertMutation(const std::string& strPath, const DocStat& docStat, std::string_view text) const
+    {
+        /**
+        * replicas tokenize the text themselves, a mutation is no larger than the document
+        */
+        if (!isLogging())
+        {
+            return nullptr;
+        }
+        Json mutation = {{"op", "upsert"}, {"path", strPath}, {"stat", docStat}};
+        writeText(mutation, text);
+        return mutation;
+    }
+
+    bool SearchEngine::deleteDocument(const std::string& strPath)
+    {
+        const PathLock lock = lockPath(strPath);
+        return deleteLocked(strPath);
+    }
+
+    bool SearchEngine::deleteLocked(const std::string& strPath)
+    {
+        invalidateCache();
+        const size_t idx = shardIdx(strPath);
+        if (!m_shards[idx]->eraseDocument(strPath))
+        {
+            return false;
+        }
+        scheduleMaintenance(idx);
+        if (isLogging())
+        {
+            log({{"op", "delete"}, {"path", strPath}});
+        }
+        return true;
+    }
+
+    SearchEngine::PathLock SearchEngine::lockPath(const std::string& strPath)
+    {
+        return {std::shared_lock<std::shared_mutex>(m_erasureMtx),
+                std::unique_lock<std::mutex>(m_pathMtx[routing::shard(strPath, PathStripes)])};
+    }
+
+    bool SearchEngine::reindexDocument(std::string&& strPath)
+    {
+        deleteDocument(strPath);
+        return indexTxtFile(std::move(strPath));
+    }
+
+    size_t SearchEngine::shardIdx(const std::string& path) const
+    {
+        return routing::shard(path, m_shards.size());
+    }
+
+    size_t SearchEngine::shardIdx(DocId docId) const
+    {
+        return docId % m_shards.size();
+    }
+
+    void SearchEngine::scheduleMaintenance(size_t shardIdx)
+    {
+        /**
+        * sealing full buffers and merging segments (which also drops postings of deleted documents)
+        * happens in the background, at most one maintenance task per shard is in flight
+        */
+        const ShardPtr& shard = m_shards[shardIdx];
+        if (!shard->needsMaintenance())
+        {
+            return;
+        }
+
+        bool expected = false;
+        if (!m_isMaintaining[shardIdx].compare_exchange_strong(expected, true))
+        {
+            return;
+        }
+        m_pool->submitTask(
+            [this, shardIdx] {
+                while (m_shards[shardIdx]->maintain())
+                {
+                }
+                m_isMaintaining[shardIdx] = false;
+            },
+            false, TaskPriority::Background);
+    }
+
     void SearchEngine::insert(std::string&& token, const std::string& doc, DocStat&& docStat, size_t pos)
     {
         invalidateCache();
-        m_storage->insert(std::move(token), doc, std::move(docStat), pos);
+        m_shards[shardIdx(doc)]->insert(std::move(token), doc, std::move(docStat), pos);
     }
 
-    ConstTokenRecordPtr SearchEngine::search(std::string token, bool& found) const
+    void SearchEngine::normalize(std::string& token) const
     {
+        /**
+        * a token looked up is brought to the form indexed tokens are in, see TokenizedText
+        */
         if (m_params.toLowercase)
         {
-            utils::toLower(token);
+            unicode::foldCase(token);
+        }
+        if (m_semantics.nfcTokens)
+        {
+            unicode::toNfc(token);
         }
-        return m_storage->search(token, found);
     }
 
-    static void rankDocs(SUMap<std::string, float>& ranks, const std::string& path, float tfIdf)
+    ConstPostingListPtr SearchEngine::search(std::string token, bool& found) const
     {
-        ranks.mutate(path, [tfIdf](const auto& it, bool iterValid, bool& shouldErase) {
-            shouldErase = false;
-            if (iterValid)
-            {
-                it->second += tfIdf;
-                return 0.0f;
-            }
-            return tfIdf;
-        });
+        normalize(token);
+        if (m_shards.size() == 1)
+        {
+            return m_shards.front()->search(token, found);
+        }
+
+        auto postings = std::make_shared<PostingList>();
+        found = false;
+        for (const auto& shard: m_shards)
+        {
+            bool foundInShard;
+            postings->append(*shard->search(token, foundInShard));
+            found |= foundInShard;
+        }
+        return postings;
     }
 
-    tfidf::RankedDocs SearchEngine::searchQuery(std::string query)
+    bool SearchEngine::isAlive(DocId docId) const
     {
-        if (m_params.toLowercase)
+        return m_shards[shardIdx(docId)]->isAlive(docId);
+    }
+
+    std::string SearchEngine::docPath(DocId docId) const
+    {
+        return m_shards[shardIdx(docId)]->docPath(docId);
+    }
+
+    ranking::RankedDocs SearchEngine::rank(const ranking::QueryStats& stats, const query::Query& query,
+                                           const ranking::Page& page, std::vector<std::string>& cursors,
+                                           bool isRanked)
+    {
+        /**
+        * Okapi BM25. Document frequencies and lengths are maintained at index time, so postings are only
+        * visited to score the documents holding them, and Block-Max WAND skips the documents that cannot
+        * make it into the page. Every shard ranks its own documents, the per-shard pages are merged
+        * afterwards and only the documents of the final page are resolved to paths. Boolean and phrase
+        * queries match documents by intersecting postings first and rank the matches only, unless isRanked
+        * is unset, in which case matches come in DocId order
+        */
+        const float docs = stats.docCount;
+        const float avgDocLength = stats.docCount > 0 ? (float)stats.totalTokens / stats.docCount : 0.0f;
+        const ranking::Bm25 bm25{m_params.bm25K1, m_params.bm25B, avgDocLength};
+        std::vector<float> idfs(stats.tokens.size(), 0.0f);
+        for (size_t t = 0; t < stats.tokens.size() && t < stats.docFreqs.size(); t++)
         {
-            utils::toLower(query);
+            const float df = stats.docFreqs[t];
+            if (df > 0)
+            {
+                idfs[t] = logf(1.0f + (docs - df + 0.5f) / (df + 0.5f));
+            }
         }
 
-        SUMap<std::string, float> ranks(m_storage->docCount() * 10e-2);
+        const size_t shardCount = m_shards.size();
+        std::vector<ranking::ScoredDocs> shardPages(shardCount);
         {
             std::vector<WaitableFuture> futures;
-            for (auto&&[token, _]: tokenize(query))
+            for (size_t s = 0; s < shardCount; s++)
             {
                 futures.push_back(m_pool->submitTask(
-                    [this, &ranks, tok = std::move(token)] {
-                        bool found;
-                        const auto recordPtr = search(tok, found);
-                        if (!found)
-                        {
-                            return;
-                        }
-
-                        std::unordered_map<std::string_view, size_t> hist;
-                        for (auto&[path, _pos]: recordPtr->iterate())
-                        {
-                            hist[path]++;
-                        }
-
-                        const float idf = log10f((float)m_storage->docCount() / hist.size());
-                        for (auto&&[pathView, freq]: hist)
-                        {
-                            std::string path{pathView};
-                            const float tf = (float)freq / m_storage->tokenCountForDoc(path);
-                            rankDocs(ranks, path, tf * idf);
-                        }
+                    [this, &stats, &query, &idfs, &shardPages, &bm25, &page, isRanked, s] {
+                        shardPages[s] = isRanked && query.isBagOfWords
+                                            ? m_shards[s]->topDocs(stats.tokens, idfs, bm25, page)
+                                            : m_shards[s]->matchDocs(query, idfs, bm25, page, isRanked);
                     },
                     true));
             }
         }
 
-        auto snapshot = ranks.snapshotDense();
-        const size_t topX = snapshot.size() < 20 ? snapshot.size() : 20;
+        ranking::ScoredDocs scored;
+        for (const auto& shardPage: shardPages)
+        {
+            scored.insert(scored.end(), shardPage.begin(), shardPage.end());
+        }
+        const size_t topX = std::min(scored.size(), page.limit);
+        std::partial_sort(scored.begin(), scored.begin() + topX, scored.end(), ranking::isRankedBefore);
+
+        ranking::RankedDocs ranked;
+        cursors.clear();
+        for (size_t i = 0; i < topX; i++)
+        {
+            const auto& [docId, score] = scored[i];
+            ranked.emplace_back(m_shards[shardIdx(docId)]->docPath(docId), score);
+            cursors.push_back(ranking::encodeCursor(scored[i]));
+        }
+        return ranked;
+    }
+
+    ranking::RankedDocs SearchEngine::searchQuery(std::string query)
+    {
+        std::vector<std::string> cursors;
+        return searchQuery(std::move(query), ranking::Page{}, cursors);
+    }
+
+    ranking::RankedDocs SearchEngine::searchQuery(std::string query, const ranking::Page& page,
+                                                  std::vector<std::string>& cursors)
+    {
+        const query::Query parsed = parseQuery(query);
+        return rank(tokenStats(parsed.tokens), parsed, page, cursors, true);
+    }
+
+    ranking::RankedDocs SearchEngine::filterQuery(std::string query, const ranking::Page& page,
+                                                  std::vector<std::string>& cursors)
+    {
+        /**
+        * matches without ranking, no statistics are needed and every match scores 0
+        */
+        const query::Query parsed = parseQuery(query);
+        ranking::QueryStats stats;
+        stats.tokens = parsed.tokens;
+        return rank(stats, parsed, page, cursors, false);
+    }
+
+    ranking::RankedDocs SearchEngine::searchQuery(std::string query, const ranking::QueryStats& globalStats,
+                                                  const ranking::Page& page, std::vector<std::string>& cursors)
+    {
+        /**
+        * ranks local documents with statistics gathered over a larger corpus, e.g. by a coordinator
+        */
+        const query::Query parsed = parseQuery(query);
+        ranking::QueryStats stats = tokenStats(parsed.tokens);
+        std::unordered_map<std::string_view, size_t> docFreqs;
+        for (size_t i = 0; i < globalStats.tokens.size() && i < globalStats.docFreqs.size(); i++)
+        {
+            docFreqs[globalStats.tokens[i]] = globalStats.docFreqs[i];
+        }
+        for (size_t t = 0; t < stats.tokens.size(); t++)
+        {
+            auto it = docFreqs.find(stats.tokens[t]);
+            stats.docFreqs[t] = it != docFreqs.end() ? it->second : 0;
+        }
+        stats.docCount = globalStats.docCount;
+        stats.totalTokens = globalStats.totalTokens;
+        return rank(stats, parsed, page, cursors, true);
+    }
+
+    ranking::QueryStats SearchEngine::queryStats(std::string query) const
+    {
+        return tokenStats(parseQuery(query).tokens);
+    }
+
+    size_t SearchEngine::docFreq(const std::string& token) const
+    {
+        size_t df = 0;
+        for (const auto& shard: m_shards)
+        {
+            df += shard->docFreq(token);
+        }
+        return df;
+    }
+
+    std::vector<std::string> SearchEngine::expandTerms(std::string pattern, size_t limit, bool& truncated) const
+    {
+        normalize(pattern);
+        return mergeTerms(limit, truncated, [&pattern, limit](const Shard& shard, bool& shardTruncated) {
+            return shard.expand(pattern, limit, shardTruncated);
+        });
+    }
 
-        auto threshold = snapshot.begin() + topX;
-        std::partial_sort(snapshot.begin(), threshold, snapshot.end(), [](auto&& first, auto&& second) {
-            return tfidf::docRankCompare(first, second);
+    std::vector<std::string> SearchEngine::termRange(std::string from, std::string to, size_t limit,
+                                                     bool& truncated) const
+    {
+        normalize(from);
+        normalize(to);
+        return mergeTerms(limit, truncated, [&from, &to, limit](const Shard& shard, bool& shardTruncated) {
+            return shard.termRange(from, to, limit, shardTruncated);
         });
+    }
 
-        return tfidf::RankedDocs {
-            std::make_move_iterator(snapshot.begin()),
-            std::make_move_iterator(threshold)
+    std::vector<TermMatch> SearchEngine::fuzzyTerms(std::string token, size_t maxEdits, size_t limit,
+                                                    bool& truncated) const
+    {
+        normalize(token);
+        std::vector<TermMatch> matches;
+        for (const auto& shard: m_shards)
+        {
+            std::vector<TermMatch> part = shard->fuzzyMatch(token, maxEdits);
+            matches.insert(matches.end(), std::make_move_iterator(part.begin()), std::make_move_iterator(part.end()));
+        }
+        std::sort(matches.begin(), matches.end(), [](const TermMatch& first, const TermMatch& second) {
+            return first.term < second.term;
+        });
+        matches.erase(std::unique(matches.begin(), matches.end(),
+                                  [](const TermMatch& first, const TermMatch& second) {
+                                      return first.term == second.term;
+                                  }),
+                      matches.end());
+
+        for (auto& match: matches)
+        {
+            match.docFreq = docFreq(match.term);
+        }
+        std::sort(matches.begin(), matches.end(), [](const TermMatch& first, const TermMatch& second) {
+            return std::tie(first.distance, second.docFreq, first.term) <
+                   std::tie(second.distance, first.docFreq, second.term);
+        });
+        truncated = matches.size() > limit;
+        matches.resize(std::min(matches.size(), limit));
+        return matches;
+    }
+
+    std::vector<std::string> SearchEngine::mergeTerms(
+        size_t limit, bool& truncated,
+        const std::function<std::vector<std::string>(const Shard&, bool&)>& shardTerms) const
+    {
+        /**
+        * every shard contributes its first limit terms, which covers the first limit terms overall
+        */
+        std::vector<std::string> terms;
+        truncated = false;
+        for (const auto& shard: m_shards)
+        {
+            bool shardTruncated = false;
+            std::vector<std::string> part = shardTerms(*shard, shardTruncated);
+            truncated |= shardTruncated;
+            const size_t middle = terms.size();
+            terms.insert(terms.end(), std::make_move_iterator(part.begin()), std::make_move_iterator(part.end()));
+            std::inplace_merge(terms.begin(), terms.begin() + middle, terms.end());
+            terms.erase(std::unique(terms.begin(), terms.end()), terms.end());
+        }
+        if (terms.size() > limit)
+        {
+            terms.resize(limit);
+            truncated = true;
+        }
+        return terms;
+    }
+
+    query::Query SearchEngine::parseQuery(const std::string& query) const
+    {
+        /**
+        * wildcards and misspelled tokens expand to at most maxExpansions tokens each, the latter to
+        * the closest and most frequent ones
+        */
+        auto expand = [this](const std::string& pattern) {
+            bool truncated;
+            return expandTerms(pattern, m_params.maxExpansions, truncated);
         };
+        auto fuzzyExpand = [this](const std::string& token, size_t maxEdits) {
+            bool truncated;
+            std::vector<std::string> terms;
+            for (auto& match: fuzzyTerms(token, maxEdits, m_params.maxExpansions, truncated))
+            {
+                terms.push_back(std::move(match.term));
+            }
+            return terms;
+        };
+        return query::parse(query, m_params.toLowercase, expand, fuzzyExpand, m_semantics.nfcTokens);
+    }
+
+    ranking::QueryStats SearchEngine::tokenStats(std::vector<std::string> tokens) const
+    {
+        /**
+        * Statistics are read off the shard vocabularies, no postings are visited. Document frequencies
+        * keep counting deleted documents until a merge drops their postings, so the collection is taken
+        * to be every document holding postings, tombstones included, which keeps docFreq <= docCount
+        */
+        ranking::QueryStats stats;
+        stats.tokens = std::move(tokens);
+        for (const auto& token: stats.tokens)
+        {
+            stats.docFreqs.push_back(docFreq(token));
+        }
+        for (const auto& shard: m_shards)
+        {
+            stats.docCount += shard->docCount() + shard->tombstoneCount();
+            stats.totalTokens += shard->totalTokenCount() + shard->tombstoneTokenCount();
+        }
+        return stats;
     }
 
     void SearchEngine::erase(const std::string& token)
     {
+        /**
+        * the token may be in any document, an upsert of it is logged either before or after the erasure
+        */
+        std::unique_lock<std::shared_mutex> lock(m_erasureMtx);
         invalidateCache();
-        return m_storage->erase(token);
+        for (const auto& shard: m_shards)
+        {
+            shard->erase(token);
+        }
+        if (isLogging())
+        {
+            log({{"op", "erase"}, {"token", token}});
+        }
     }
 
     void SearchEngine::cache(const std::string& key, const std::string& json, CacheType::Type cacheType)
@@ -250,38 +927,84 @@ namespace core
 
     size_t SearchEngine::tokenCount() const
     {
-        return m_storage->tokenCount();
+        /**
+        * shard vocabularies overlap, the sum is an upper bound on the number of distinct tokens
+        */
+        size_t count = 0;
+        for (const auto& shard: m_shards)
+        {
+            count += shard->tokenCount();
+        }
+        return count;
     }
 
     size_t SearchEngine::docCount() const
     {
-        return m_storage->docCount();
+        size_t count = 0;
+        for (const auto& shard: m_shards)
+        {
+            count += shard->docCount();
+        }
+        return count;
     }
 
     Json SearchEngine::serialize() const
     {
-        return m_storage->serialize();
+        if (m_shards.size() == 1)
+        {
+            return m_shards.front()->serialize();
+        }
+
+        Json dump = Json::object();
+        Json docTrace = Json::object();
+        for (const auto& shard: m_shards)
+        {
+            Json data = shard->serialize();
+            for (auto&& [token, postings]: data.at("dump").items())
+            {
+                Json& merged = dump[token];
+                for (auto& posting: postings)
+                {
+                    merged.push_back(std::move(posting));
+                }
+            }
+            docTrace.update(data.at("docTrace"));
+        }
+        return Json{{"dump", dump}, {"docTrace", docTrace}};
     }
 
     float SearchEngine::loadFactor() const
     {
-        return m_storage->loadFactor();
+        float loadFactor = 0.0f;
+        for (const auto& shard: m_shards)
+        {
+            loadFactor = std::max(loadFactor, shard->loadFactor());
+        }
+        return loadFactor;
     }
 
     bool SearchEngine::isExpandable() const
     {
-        return m_storage->isExpandable();
+        return std::all_of(m_shards.begin(), m_shards.end(), [](const auto& shard) {
+            return shard->isExpandable();
+        });
     }
 
-    bool SearchEngine::dump(const std::string& strPath) const
+    Json SearchEngine::snapshot() const
     {
-        // TODO compression
-        const std::filesystem::path path = std::filesystem::u8path(strPath);
         auto now = std::chrono::system_clock::now();
         auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch());
 
         Json data = {{"timestamp", ns.count()}};
-        data.update(m_storage->serialize());
+        data.update(serialize());
+        return data;
+    }
+
+    bool SearchEngine::dump(const std::string& strPath) const
+    {
+        // TODO compression
+        const std::filesystem::path path = std::filesystem::u8path(strPath);
+        const Json data = snapshot();
         if (path.extension() == ".json")
         {
             std::ofstream f(path);
@@ -340,24 +1063,136 @@ namespace core
         const Json& dump = backup.at("dump");
         const Json& docTrace = backup.at("docTrace");
 
-        for (auto&& [token, info]: dump.items())
+        for (auto&& [docPath, tokens]: regroupByDocument(dump))
         {
-            for (auto& it: info)
+            auto ftime = std::filesystem::last_write_time(docPath);
+            if (dumpTs < ftime.time_since_epoch().count() && !isStale)
             {
-                const std::string& docPath = it.at(0).get<std::string>();
-                auto ftime = std::filesystem::last_write_time(docPath);
-                if (dumpTs < ftime.time_since_epoch().count() && !isStale)
+                /**
+                * File has been mutated since the last back-up
+                */
+                isStale = true;
+            }
+
+            DocStat docStat = docTrace.at(docPath).get<DocStat>();
+            m_shards[shardIdx(docPath)]->insertDocument(docPath, std::move(docStat), viewsOf(tokens));
+        }
+        for (size_t i = 0; i < m_shards.size(); i++)
+        {
+            scheduleMaintenance(i);
+        }
+        return true;
+    }
+
+    bool SearchEngine::sync(const Json& snapshot)
+    {
+        /**
+        * brings the index to the state of a snapshot of another engine, documents indexed
+        * in the same version are left as they are
+        */
+        if (!snapshot.contains("dump") || !snapshot.contains("docTrace"))
+        {
+            return false;
+        }
+
+        const Json& docTrace = snapshot.at("docTrace");
+        for (const auto& shard: m_shards)
+        {
+            for (const auto& path: shard->documents())
+            {
+                if (!docTrace.contains(path))
                 {
-                    /**
-                    * File has been mutated since the last back-up
-                    */
-                    isStale = true;
+                    deleteDocument(path);
                 }
-
-                DocStat docStat = docTrace.at(docPath).get<DocStat>();
-                m_storage->insert(std::string{token}, docPath, std::move(docStat), it.at(1));
             }
         }
+        /**
+        * documents taken from a snapshot come without their texts and are not logged
+        */
+        for (auto&& [docPath, tokens]: regroupByDocument(snapshot.at("dump")))
+        {
+            DocStat docStat = docTrace.at(docPath).get<DocStat>();
+            const PathLock lock = lockPath(docPath);
+            if (!isIndexed(docPath, docStat))
+            {
+                const size_t idx = shardIdx(docPath);
+                m_shards[idx]->insertDocument(docPath, std::move(docStat), viewsOf(tokens));
+                scheduleMaintenance(idx);
+            }
+        }
+        invalidateCache();
         return true;
     }
+
+    bool SearchEngine::applyMutation(const std::string& mutation)
+    {
+        /**
+        * applies a mutation logged by another engine, see mutationsSince. Mutations may be applied
+        * more than once, e.g. when a replica catches up after a snapshot, every one of them is idempotent
+        */
+        const Json data = Json::parse(mutation, nullptr, false);
+        if (data.is_discarded() || !data.is_object())
+        {
+            return false;
+        }
+
+        try
+        {
+            const std::string op = data.value("op", "");
+            if (op == "upsert")
+            {
+                const std::string text = readText(data);
+                const TokenizedText tokens(text, m_semantics.lcaseTokens, m_semantics.nfcTokens);
+                return upsertDocument(data.at("path").get<std::string>(), data.at("stat").get<DocStat>(),
+                                      tokens.tokens(), text);
+            }
+            if (op == "delete")
+            {
+                deleteDocument(data.at("path").get<std::string>());
+                return true;
+            }
+            if (op == "erase")
+            {
+                erase(data.at("token").get<std::string>());
+                return true;
+            }
+        }
+        catch (const std::exception& err)
+        {
+        }
+        return false;
+    }
+
+    std::vector<std::string> SearchEngine::mutationsSince(uint64_t seq, size_t limit, bool& truncated) const
+    {
+        return m_replicationLog->since(seq, limit, truncated);
+    }
+
+    bool SearchEngine::isLogging() const
+    {
+        return m_replicationLog->isEnabled();
+    }
+
+    uint64_t SearchEngine::replicationSeq() const
+    {
+        return m_replicationLog->lastSeq();
+    }
+
+    uint64_t SearchEngine::replicationEpoch() const
+    {
+        return m_replicationLog->epoch();
+    }
+
+    void SearchEngine::log(Json&& mutation)
+    {
+        /**
+        * mutations are logged after they have been applied, so a snapshot taken after reading
+        * replicationSeq covers at least every mutation up to it
+        */
+        if (!isLogging() || mutation.is_null())
+        {
+            return;
+        }
+        m_replicationLog->append(mutation.dump());
+    }
 }
\ No newline at end of file
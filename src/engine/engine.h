@@ -1,45 +1,20 @@
 #pragma once
 
 #include "shard.h"
+#include "tokenizer.h"
+#include "dir_watcher.h"
+#include "index_job.h"
+#include "replication_log.h"
 #include "../thread_pool/pool/thread_pool.h"
+#include <array>
+#include <mutex>
+#include <shared_mutex>
+
+class UringReader;
 
 namespace core
 {
-    namespace detail
-    {
-        template<typename Begin, typename End>
-        auto tokenizeRange(Begin begin, End end, bool toLowercase)
-        {
-            auto rangeToStr = [](auto begin, auto end, bool lower) {
-                std::string token{begin, end};
-                if (lower)
-                {
-                    utils::toLower(token);
-                }
-                return token;
-            };
-
-            std::vector<std::pair<std::string, size_t>> res;
-            for (auto p = begin;; ++p)
-            {
-                auto q = p;
-                p = std::find_if_not(p, end, [](char ch) {
-                    return utils::isLetter(ch) || ch == '\'';
-                });
-
-                if (p != q)
-                {
-                    const auto pos = p - begin;
-                    res.emplace_back(rangeToStr(q, p, toLowercase), pos);
-                }
-
-                if (p == end)
-                {
-                    return res;
-                }
-            }
-        }
-    }
+    using DocTokens = std::vector<std::pair<std::string, size_t>>;
 
     namespace CacheType
     {
@@ -75,17 +50,6 @@ namespace core
         using CachePtr = std::shared_ptr<Cache>;
     }
 
-    namespace tfidf
-    {
-        inline bool docRankCompare(const std::pair<std::string_view, float>& first,
-                                   const std::pair<std::string_view, float>& second)
-        {
-            return first.second > second.second;
-        }
-
-        using RankedDocs = std::vector<std::pair<std::string, float>>;
-    }
-
     struct SearchEngineParams
     {
         size_t size;
@@ -94,6 +58,40 @@ namespace core
         float maxLF;
         bool toLowercase;
         float cacheSize;
+        size_t watchCoalesceMs{500};
+        float compactionRatio{0.1};
+        size_t segmentBufferPostings{size_t{1} << 21};
+        size_t mergeFactor{10};
+        size_t shards{1};
+        size_t replicationLogBytes{0};
+        /**
+        * BM25 parameters: k1 controls term frequency saturation, b the document length normalization
+        */
+        float bm25K1{1.2f};
+        float bm25B{0.75f};
+        /**
+        * the maximum number of tokens a wildcard of a query expands to
+        */
+        size_t maxExpansions{64};
+        /**
+        * the maximum number of files an indexing job discovers ahead of its readers, and the number of
+        * threads reading them
+        */
+        size_t maxInFlightFiles{64};
+        size_t indexReaders{4};
+        /**
+        * whether readers read small files in batches through io_uring, where the kernel provides it
+        */
+        bool uringReader{true};
+        /**
+        * files of that many bytes or more are tokenized a window at a time rather than mapped whole
+        */
+        size_t streamThreshold{size_t{1} << 26};
+        /**
+        * whether tokens are brought to Unicode normalization form C, so precomposed and decomposed
+        * accented letters match each other
+        */
+        bool nfcTokens{false};
     };
 
     class SearchEngine
@@ -101,16 +99,48 @@ namespace core
         struct SemanticParams
         {
             bool lcaseTokens{false};
+            bool nfcTokens{false};
         };
 
     public:
         explicit SearchEngine(const SearchEngineParams& params);
+        /**
+        * indexes the .txt files under strPath and waits for them, startIndexing does so in the background
+        * and sets jobId to the job to be followed with jobStatus
+        */
         bool indexDir(const std::string& strPath);
+        bool startIndexing(const std::string& strPath, uint64_t& jobId);
+        bool jobStatus(uint64_t jobId, IndexJobStatus& status) const;
+        bool cancelJob(uint64_t jobId, IndexJobStatus& status);
         bool indexTxtFile(std::string&& strPath);
+        bool watchDir(const std::string& strPath);
+        bool deleteDocument(const std::string& strPath);
+        bool reindexDocument(std::string&& strPath);
         void insert(std::string&& token, const std::string& doc, DocStat&& docStat, size_t pos);
         void erase(const std::string& token);
-        ConstTokenRecordPtr search(std::string token, bool& found) const;
-        tfidf::RankedDocs searchQuery(std::string query);
+        ConstPostingListPtr search(std::string token, bool& found) const;
+        bool isAlive(DocId docId) const;
+        std::string docPath(DocId docId) const;
+        ranking::RankedDocs searchQuery(std::string query);
+        ranking::RankedDocs searchQuery(std::string query, const ranking::Page& page, std::vector<std::string>& cursors);
+        ranking::RankedDocs searchQuery(std::string query, const ranking::QueryStats& globalStats,
+                                        const ranking::Page& page, std::vector<std::string>& cursors);
+        /**
+        * matches a boolean query without ranking it, documents come in DocId order
+        */
+        ranking::RankedDocs filterQuery(std::string query, const ranking::Page& page, std::vector<std::string>& cursors);
+        ranking::QueryStats queryStats(std::string query) const;
+        /**
+        * tokens matching a wildcard pattern, e.g. appl* or c?t, and tokens in [from, to) respectively,
+        * at most limit of them in lexicographical order
+        */
+        std::vector<std::string> expandTerms(std::string pattern, size_t limit, bool& truncated) const;
+        std::vector<std::string> termRange(std::string from, std::string to, size_t limit, bool& truncated) const;
+        /**
+        * tokens within maxEdits edits of token, closest first and more frequent first among equally close ones
+        */
+        std::vector<TermMatch> fuzzyTerms(std::string token, size_t maxEdits, size_t limit, bool& truncated) const;
+        size_t docFreq(const std::string& token) const;
         void cache(const std::string& key, const std::string& json, CacheType::Type cacheType);
         cache::CacheEntry searchCache(const std::string& key, CacheType::Type cacheType, bool& found) const;
         void invalidateCache();
@@ -119,18 +149,91 @@ namespace core
         Json serialize() const;
         float loadFactor() const;
         bool isExpandable() const;
+        Json snapshot() const;
         bool dump(const std::string& strPath) const;
         bool restore(const std::string& strPath, bool& isStale);
+        bool sync(const Json& snapshot);
+        bool applyMutation(const std::string& mutation);
+        std::vector<std::string> mutationsSince(uint64_t seq, size_t limit, bool& truncated) const;
+        bool isLogging() const;
+        uint64_t replicationSeq() const;
+        uint64_t replicationEpoch() const;
 
     private:
         void initCache(size_t reserve);
+        void applyWatchEvent(const std::string& path, WatchEvent event);
+        void normalize(std::string& token) const;
+        /**
+        * the stages of indexing a file, see IndexPipeline
+        */
+        StageResult readFile(IndexedFile& file) const;
+        StageResult checkFile(IndexedFile& file) const;
+        StageResult mapFile(IndexedFile& file) const;
+        void readFiles(UringReader& reader, std::vector<IndexedFile>& files, std::vector<StageResult>& results) const;
+        StageResult tokenizeFile(IndexedFile& file) const;
+        StageResult streamFile(IndexedFile& file) const;
+        bool isStreamed(const IndexedFile& file) const;
+        StageResult mergeFile(IndexedFile& file);
+        /**
+        * text is what the document is tokenized from, logged for replicas in place of its tokens
+        */
+        bool upsertDocument(const std::string& strPath, DocStat&& docStat, const std::vector<TokenView>& tokens,
+                            std::string_view text);
+        bool upsertDocument(const std::string& strPath, DocStat&& docStat, const DocPostings& postings,
+                            std::string_view text);
+        Json upsertMutation(const std::string& strPath, const DocStat& docStat, std::string_view text) const;
+        /**
+        * isIndexed and deleteLocked are called with the path locked, see lockPath
+        */
+        struct PathLock
+        {
+            std::shared_lock<std::shared_mutex> erasure;
+            std::unique_lock<std::mutex> path;
+        };
+        bool isIndexed(const std::string& strPath, const DocStat& docStat);
+        bool deleteLocked(const std::string& strPath);
+        PathLock lockPath(const std::string& strPath);
+        void log(Json&& mutation);
+        size_t shardIdx(const std::string& path) const;
+        size_t shardIdx(DocId docId) const;
+        void scheduleMaintenance(size_t shardIdx);
+        ranking::RankedDocs rank(const ranking::QueryStats& stats, const query::Query& query,
+                                 const ranking::Page& page, std::vector<std::string>& cursors, bool isRanked);
+        ranking::QueryStats tokenStats(std::vector<std::string> tokens) const;
+        query::Query parseQuery(const std::string& query) const;
+        std::vector<std::string> mergeTerms(
+            size_t limit, bool& truncated,
+            const std::function<std::vector<std::string>(const Shard&, bool&)>& shardTerms) const;
 
     private:
         SearchEngineParams m_params;
         SemanticParams m_semantics;
-        ThreadPoolPtr m_pool;
-        ShardPtr m_storage;
+        /**
+        * the corpus is partitioned by document, a document lives in the shard its path hashes to
+        */
+        std::vector<ShardPtr> m_shards;
         cache::CachePtr m_cache;
+        /**
+        * mutations kept for replicas, disabled unless replicationLogBytes is set
+        */
+        ReplicationLogPtr m_replicationLog;
+        /**
+        * Upserts and deletes of a path are applied and logged under the mutex its path hashes to,
+        * so replicas apply the mutations of a document in the order the primary did. They share
+        * m_erasureMtx, which an erasure of a token takes exclusively as it may touch any document
+        */
+        static constexpr size_t PathStripes = 64;
+        std::array<std::mutex, PathStripes> m_pathMtx;
+        std::shared_mutex m_erasureMtx;
+        std::unique_ptr<std::atomic<bool>[]> m_isMaintaining;
+        /**
+        * members are destroyed in reverse order: indexing jobs and the watcher stop feeding the pool first,
+        * then the pool drains before storage, cache and maintenance flags go away
+        */
+        ThreadPoolPtr m_pool;
+        std::mutex m_watcherMtx;
+        DirWatcherPtr m_watcher;
+        IndexJobsPtr m_jobs;
     };
 
     using SearchEnginePtr = std::unique_ptr<SearchEngine>;
@@ -0,0 +1,538 @@
+#include "index_job.h"
+#include "tokenizer.h"
+#include "shard.h"
+#include "../mmap/mmap.h"
+#include "../mmap/uring_reader.h"
+#include <sys/resource.h>
+
+namespace core
+{
+    /**
+    * job threads are niced, which on Linux lowers the calling thread only
+    */
+    static constexpr int BackgroundNice = 10;
+    /**
+    * mapped and tokenized files waiting for a free tokenizer or merger, per thread of the stage
+    */
+    static constexpr size_t QueuedPerWorker = 2;
+
+    static void lowerPriority()
+    {
+        setpriority(PRIO_PROCESS, 0, BackgroundNice);
+    }
+
+    static uint64_t elapsedUs(std::chrono::steady_clock::time_point since)
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - since)
+            .count();
+    }
+
+    const char* toString(JobState state)
+    {
+        switch (state)
+        {
+            case JobState::Queued: return "queued";
+            case JobState::Running: return "running";
+            case JobState::Cancelling: return "cancelling";
+            case JobState::Cancelled: return "cancelled";
+            case JobState::Done: return "done";
+        }
+        return "unknown";
+    }
+
+    void to_json(Json& json, const StageStatus& stage)
+    {
+        json = {{"stage", stage.name},    {"workers", stage.workers}, {"processed", stage.processed},
+                {"busyMs", stage.busyMs}, {"queued", stage.queued},   {"capacity", stage.capacity},
+                {"peakQueued", stage.peakQueued}};
+    }
+
+    uint64_t IndexJobStatus::throughput() const
+    {
+        return elapsedMs > 0 ? bytesProcessed * 1000 / elapsedMs : bytesProcessed * 1000;
+    }
+
+    IndexedFile::IndexedFile() = default;
+
+    IndexedFile::IndexedFile(std::string path, uint64_t bytes)
+        : path(std::move(path))
+        , bytes(bytes)
+    {
+    }
+
+    IndexedFile::IndexedFile(IndexedFile&& other) noexcept = default;
+    IndexedFile& IndexedFile::operator=(IndexedFile&& other) noexcept = default;
+    IndexedFile::~IndexedFile() = default;
+
+    IndexJob::Stage::Stage(const char* name, size_t workers)
+        : name(name)
+        , workers(workers)
+        , running(workers)
+    {
+    }
+
+    StageStatus IndexJob::Stage::status() const
+    {
+        return {name, workers, processed, static_cast<size_t>(busyUs / 1000), 0, 0, 0};
+    }
+
+    IndexJob::IndexJob(uint64_t id, const std::filesystem::path& root, size_t maxInFlight, IndexPipeline pipeline)
+        : m_id(id)
+        , m_pipeline(std::move(pipeline))
+        , m_dirs{root}
+        , m_crawl("crawl", Crawlers)
+        , m_read("read", std::max<size_t>(m_pipeline.readers, 1))
+        , m_tokenize("tokenize", std::max<size_t>(m_pipeline.tokenizers, 1))
+        , m_merge("merge", std::max<size_t>(m_pipeline.mergers, 1))
+        , m_found(maxInFlight)
+        , m_loaded(m_tokenize.workers * QueuedPerWorker)
+    {
+        for (size_t i = 0; i < m_merge.workers; i++)
+        {
+            m_tokenized.push_back(std::make_unique<FileQueue>(QueuedPerWorker));
+        }
+    }
+
+    IndexJob::~IndexJob()
+    {
+        cancel();
+        for (auto& thread: m_threads)
+        {
+            if (thread.joinable())
+            {
+                thread.join();
+            }
+        }
+    }
+
+    void IndexJob::run()
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        if (m_isStarted || m_isCancelled)
+        {
+            return;
+        }
+        m_isStarted = true;
+        m_start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < m_crawl.workers; i++)
+        {
+            m_threads.emplace_back(&IndexJob::crawl, this);
+        }
+        for (size_t i = 0; i < m_read.workers; i++)
+        {
+            m_threads.emplace_back(&IndexJob::read, this);
+        }
+        for (size_t i = 0; i < m_tokenize.workers; i++)
+        {
+            m_threads.emplace_back(&IndexJob::tokenize, this);
+        }
+        for (size_t i = 0; i < m_merge.workers; i++)
+        {
+            m_threads.emplace_back(&IndexJob::merge, this, i);
+        }
+    }
+
+    void IndexJob::cancel()
+    {
+        /**
+        * a job that is over stays done, a queued one is over at once
+        */
+        std::lock_guard<std::mutex> lock(m_mtx);
+        if (m_isFinished)
+        {
+            return;
+        }
+        m_isCancelled = true;
+        if (!m_isStarted)
+        {
+            m_isFinished = true;
+            m_start = std::chrono::steady_clock::now();
+            m_finish = m_start;
+        }
+        m_cv.notify_all();
+    }
+
+    void IndexJob::wait()
+    {
+        std::unique_lock<std::mutex> lock(m_mtx);
+        m_cv.wait(lock, [this] {
+            return m_isFinished;
+        });
+    }
+
+    bool IndexJob::isFinished() const
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        return m_isFinished;
+    }
+
+    IndexJobStatus IndexJob::status() const
+    {
+        std::unique_lock<std::mutex> lock(m_mtx);
+        const bool isStarted = m_isStarted;
+        const bool isFinished = m_isFinished;
+        const bool isCancelled = m_isCancelled;
+        const auto start = m_start;
+        const auto until = isFinished || !isStarted ? m_finish : std::chrono::steady_clock::now();
+        const size_t dirs = m_dirs.size();
+        lock.unlock();
+
+        JobState state = isFinished ? JobState::Done : JobState::Running;
+        if (!isStarted && !isFinished)
+        {
+            state = JobState::Queued;
+        }
+        if (isCancelled)
+        {
+            state = isFinished ? JobState::Cancelled : JobState::Cancelling;
+        }
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(until - start).count();
+        IndexJobStatus status{m_id, state, m_discovered, m_indexed, m_failed, m_bytes, static_cast<size_t>(elapsed),
+                              {}};
+
+        /**
+        * the crawlers are fed by a list of directories that is not bounded, capacity 0 stands for that
+        */
+        status.stages = {m_crawl.status(), m_read.status(), m_tokenize.status(), m_merge.status()};
+        status.stages[0].queued = dirs;
+        const FileQueue* feeding[] = {&m_found, &m_loaded};
+        for (size_t i = 0; i < 2; i++)
+        {
+            status.stages[i + 1].queued = feeding[i]->size();
+            status.stages[i + 1].capacity = feeding[i]->capacity();
+            status.stages[i + 1].peakQueued = feeding[i]->peak();
+        }
+        for (const auto& queue: m_tokenized)
+        {
+            status.stages[3].queued += queue->size();
+            status.stages[3].capacity += queue->capacity();
+            status.stages[3].peakQueued = std::max(status.stages[3].peakQueued, queue->peak());
+        }
+        return status;
+    }
+
+    bool IndexJob::nextDir(std::filesystem::path& dir)
+    {
+        /**
+        * crawling is over once no directory is left and no crawler is listing one that may hold more
+        */
+        std::unique_lock<std::mutex> lock(m_mtx);
+        m_cv.wait(lock, [this] {
+            return !m_dirs.empty() || m_listing == 0 || m_isCancelled;
+        });
+        if (m_dirs.empty() || m_isCancelled)
+        {
+            return false;
+        }
+        dir = std::move(m_dirs.back());
+        m_dirs.pop_back();
+        m_listing++;
+        return true;
+    }
+
+    void IndexJob::crawl()
+    {
+        lowerPriority();
+        std::filesystem::path dir;
+        while (nextDir(dir))
+        {
+            std::vector<std::filesystem::path> subdirs;
+            std::error_code err;
+            auto since = std::chrono::steady_clock::now();
+            const auto options = std::filesystem::directory_options::skip_permission_denied;
+            for (std::filesystem::directory_iterator it(dir, options, err), end; !err && it != end && !m_isCancelled;
+                 it.increment(err))
+            {
+                /**
+                * links to directories are not followed, as by recursive_directory_iterator
+                */
+                std::error_code typeErr;
+                if (it->is_directory(typeErr) && !it->is_symlink(typeErr))
+                {
+                    subdirs.push_back(it->path());
+                    continue;
+                }
+                if (it->path().extension() != ".txt")
+                {
+                    continue;
+                }
+                std::error_code sizeErr;
+                const uint64_t size = it->file_size(sizeErr);
+                m_discovered++;
+                m_crawl.processed++;
+                m_crawl.busyUs += elapsedUs(since);
+                m_found.push(IndexedFile(it->path().string(), sizeErr ? 0 : size));
+                since = std::chrono::steady_clock::now();
+            }
+            m_crawl.busyUs += elapsedUs(since);
+
+            std::lock_guard<std::mutex> lock(m_mtx);
+            std::move(subdirs.begin(), subdirs.end(), std::back_inserter(m_dirs));
+            m_listing--;
+            m_cv.notify_all();
+        }
+        if (leave(m_crawl))
+        {
+            m_found.close();
+        }
+    }
+
+    void IndexJob::read()
+    {
+        lowerPriority();
+        const IndexPipeline::BatchStage readBatch = m_pipeline.batchRead ? m_pipeline.batchRead() : nullptr;
+        std::vector<IndexedFile> files;
+        std::vector<StageResult> results;
+        IndexedFile file;
+        while (m_found.pop(file))
+        {
+            if (!readBatch)
+            {
+                if (apply(m_read, m_pipeline.read, file))
+                {
+                    m_loaded.push(std::move(file));
+                }
+                continue;
+            }
+
+            /**
+            * a batch takes the files already waiting rather than waiting for more
+            */
+            files.clear();
+            files.push_back(std::move(file));
+            while (files.size() < m_pipeline.readBatch && m_found.tryPop(file))
+            {
+                files.push_back(std::move(file));
+            }
+            applyBatch(m_read, readBatch, files, results);
+            for (size_t i = 0; i < files.size(); i++)
+            {
+                if (results[i] == StageResult::Next)
+                {
+                    m_loaded.push(std::move(files[i]));
+                }
+            }
+        }
+        if (leave(m_read))
+        {
+            m_loaded.close();
+        }
+    }
+
+    void IndexJob::tokenize()
+    {
+        lowerPriority();
+        IndexedFile file;
+        while (m_loaded.pop(file))
+        {
+            if (apply(m_tokenize, m_pipeline.tokenize, file))
+            {
+                const size_t mergerIdx = m_pipeline.route ? m_pipeline.route(file) % m_tokenized.size() : 0;
+                m_tokenized[mergerIdx]->push(std::move(file));
+            }
+        }
+        if (leave(m_tokenize))
+        {
+            for (auto& queue: m_tokenized)
+            {
+                queue->close();
+            }
+        }
+    }
+
+    void IndexJob::merge(size_t mergerIdx)
+    {
+        lowerPriority();
+        IndexedFile file;
+        while (m_tokenized[mergerIdx]->pop(file))
+        {
+            if (apply(m_merge, m_pipeline.merge, file))
+            {
+                finish(file, StageResult::Done);
+            }
+            /**
+            * the file is unmapped by the thread done with it rather than on the next pop
+            */
+            file = IndexedFile();
+        }
+        if (leave(m_merge))
+        {
+            std::lock_guard<std::mutex> lock(m_mtx);
+            m_isFinished = true;
+            m_finish = std::chrono::steady_clock::now();
+            m_cv.notify_all();
+        }
+    }
+
+    bool IndexJob::apply(Stage& stage, const IndexPipeline::Stage& fn, IndexedFile& file)
+    {
+        /**
+        * true when the file goes on to the next stage, files of a cancelled job are dropped
+        */
+        if (m_isCancelled)
+        {
+            return false;
+        }
+        if (!fn)
+        {
+            return true;
+        }
+        const auto since = std::chrono::steady_clock::now();
+        const StageResult result = fn(file);
+        stage.busyUs += elapsedUs(since);
+        stage.processed++;
+        if (result != StageResult::Next)
+        {
+            finish(file, result);
+            return false;
+        }
+        return true;
+    }
+
+    void IndexJob::applyBatch(Stage& stage, const IndexPipeline::BatchStage& fn, std::vector<IndexedFile>& files,
+                              std::vector<StageResult>& results)
+    {
+        /**
+        * as apply, for every file of the batch, results[i] is Next for the files going on
+        */
+        results.assign(files.size(), StageResult::Failed);
+        if (m_isCancelled)
+        {
+            return;
+        }
+        const auto since = std::chrono::steady_clock::now();
+        fn(files, results);
+        stage.busyUs += elapsedUs(since);
+        stage.processed += files.size();
+        for (size_t i = 0; i < files.size(); i++)
+        {
+            if (results[i] != StageResult::Next)
+            {
+                finish(files[i], results[i]);
+            }
+        }
+    }
+
+    void IndexJob::finish(const IndexedFile& file, StageResult result)
+    {
+        if (result == StageResult::Failed)
+        {
+            m_failed++;
+            return;
+        }
+        m_indexed++;
+        m_bytes += file.bytes;
+    }
+
+    bool IndexJob::leave(Stage& stage)
+    {
+        /**
+        * true for the last thread to leave the stage, which closes the queue behind it
+        */
+        return --stage.running == 0;
+    }
+
+    IndexJobs::IndexJobs(size_t maxInFlight)
+        : m_maxInFlight(maxInFlight)
+    {
+        m_dispatcher = std::thread(&IndexJobs::dispatch, this);
+    }
+
+    IndexJobs::~IndexJobs()
+    {
+        /**
+        * all jobs are cancelled before any is waited for
+        */
+        {
+            std::lock_guard<std::mutex> lock(m_mtx);
+            m_isStopping = true;
+            for (const auto& [id, job]: m_jobs)
+            {
+                job->cancel();
+            }
+            m_cv.notify_all();
+        }
+        m_dispatcher.join();
+        std::lock_guard<std::mutex> lock(m_mtx);
+        m_jobs.clear();
+    }
+
+    void IndexJobs::dispatch()
+    {
+        while (true)
+        {
+            IndexJobPtr job;
+            {
+                std::unique_lock<std::mutex> lock(m_mtx);
+                m_cv.wait(lock, [this] {
+                    return !m_queued.empty() || m_isStopping;
+                });
+                if (m_isStopping)
+                {
+                    return;
+                }
+                job = std::move(m_queued.front());
+                m_queued.pop_front();
+            }
+            job->run();
+            job->wait();
+        }
+    }
+
+    uint64_t IndexJobs::start(const std::filesystem::path& root, IndexPipeline pipeline)
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        size_t finished = 0;
+        for (const auto& [id, job]: m_jobs)
+        {
+            finished += job->isFinished();
+        }
+        for (auto it = m_jobs.begin(); it != m_jobs.end() && finished > MaxFinished;)
+        {
+            if (it->second->isFinished())
+            {
+                it = m_jobs.erase(it);
+                finished--;
+                continue;
+            }
+            ++it;
+        }
+
+        const uint64_t id = m_nextId++;
+        const auto job = std::make_shared<IndexJob>(id, root, m_maxInFlight, std::move(pipeline));
+        m_jobs.emplace(id, job);
+        m_queued.push_back(job);
+        m_cv.notify_one();
+        return id;
+    }
+
+    IndexJobPtr IndexJobs::find(uint64_t id) const
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        const auto it = m_jobs.find(id);
+        return it != m_jobs.end() ? it->second : nullptr;
+    }
+
+    bool IndexJobs::status(uint64_t id, IndexJobStatus& status) const
+    {
+        const IndexJobPtr job = find(id);
+        if (!job)
+        {
+            return false;
+        }
+        status = job->status();
+        return true;
+    }
+
+    bool IndexJobs::cancel(uint64_t id, IndexJobStatus& status)
+    {
+        const IndexJobPtr job = find(id);
+        if (!job)
+        {
+            return false;
+        }
+        job->cancel();
+        status = job->status();
+        return true;
+    }
+}
@@ -0,0 +1,274 @@
+#pragma once
+
+#include "doc_trace.h"
+#include "bounded_queue.h"
+#include <chrono>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <thread>
+
+class MMapASCII;
+class ReadBuffer;
+
+namespace core
+{
+    class TokenizedText;
+    struct DocPostings;
+
+    enum class JobState : int8_t
+    {
+        /**
+        * waiting for the jobs started before to be over
+        */
+        Queued,
+        Running,
+        /**
+        * cancelled while files were still in flight
+        */
+        Cancelling,
+        Cancelled,
+        Done,
+    };
+
+    const char* toString(JobState state);
+
+    struct StageStatus
+    {
+        /**
+        * queued, capacity and peakQueued describe the queue feeding the stage
+        */
+        std::string name;
+        size_t workers;
+        size_t processed;
+        size_t busyMs;
+        size_t queued;
+        size_t capacity;
+        size_t peakQueued;
+    };
+
+    void to_json(Json& json, const StageStatus& stage);
+
+    struct IndexJobStatus
+    {
+        uint64_t id;
+        JobState state;
+        size_t filesDiscovered;
+        size_t filesIndexed;
+        size_t filesFailed;
+        uint64_t bytesProcessed;
+        size_t elapsedMs;
+        std::vector<StageStatus> stages;
+
+        /**
+        * bytes of indexed files per second
+        */
+        uint64_t throughput() const;
+    };
+
+    struct IndexedFile
+    {
+        /**
+        * a file on its way through the pipeline, every stage fills in its part
+        */
+        IndexedFile();
+        IndexedFile(std::string path, uint64_t bytes);
+        IndexedFile(IndexedFile&& other) noexcept;
+        IndexedFile& operator=(IndexedFile&& other) noexcept;
+        ~IndexedFile();
+
+        std::string path;
+        uint64_t bytes{0};
+        DocStat stat{};
+        /**
+        * the contents of the file, held either by mmap or by buffer
+        */
+        std::string_view text;
+        std::unique_ptr<const MMapASCII> mmap;
+        std::unique_ptr<const ReadBuffer> buffer;
+        std::unique_ptr<const TokenizedText> tokens;
+        /**
+        * the tokens of a file too large to be held in memory, grouped as it is streamed
+        */
+        std::unique_ptr<const DocPostings> postings;
+        /**
+        * the contents of a streamed file, gathered only for the replication log
+        */
+        std::string logged;
+    };
+
+    enum class StageResult : int8_t
+    {
+        /**
+        * the file is handed to the next stage
+        */
+        Next,
+        /**
+        * the file is indexed, e.g. it has not changed since it was last indexed
+        */
+        Done,
+        Failed,
+    };
+
+    struct IndexPipeline
+    {
+        /**
+        * The stages a discovered file passes through: read runs on readers threads, tokenize on tokenizers
+        * threads and merge on one thread per merger, the one route picks for the file. A stage left empty
+        * passes files on as they are. The last stage that is set has to report every file Done or Failed.
+        *
+        * batchRead, when set, makes a stage for every reader thread that reads up to readBatch files at
+        * once and sets results[i] for files[i]. A reader it makes no stage for falls back to read
+        */
+        using Stage = std::function<StageResult(IndexedFile& file)>;
+        using BatchStage = std::function<void(std::vector<IndexedFile>& files, std::vector<StageResult>& results)>;
+
+        Stage read;
+        std::function<BatchStage()> batchRead;
+        size_t readBatch{1};
+        Stage tokenize;
+        Stage merge;
+        std::function<size_t(const IndexedFile& file)> route;
+        size_t readers{1};
+        size_t tokenizers{1};
+        size_t mergers{1};
+    };
+
+    class IndexJob
+    {
+        /**
+        * IndexJob indexes the .txt files of a directory tree in the background, as a pipeline of stages
+        * connected by bounded queues:
+        *
+        *     crawl -> read -> tokenize -> merge
+        *
+        * Crawlers walk the tree in parallel, a directory at a time. Readers map the files and fault their
+        * pages in ahead of the tokenizers, or read them a batch at a time, so IO and CPU bound work overlap
+        * instead of alternating within a single task. Tokenized files are merged by one thread per shard, which keeps writers of a shard
+        * from contending with each other. A full queue holds back the stages feeding it, so no more than
+        * maxInFlight files are discovered ahead of the readers, and the number of mapped and tokenized
+        * files waiting for the next stage is bounded by the capacity of the queues in between.
+        *
+        * Every stage counts the files it has processed and the time it has been busy, which along with
+        * the depth of the queues tells the stage holding the pipeline back. The job threads run at a
+        * lowered priority, so requests served meanwhile take precedence. A cancelled job stops crawling,
+        * files already discovered are dropped by the stage they are waiting for
+        */
+    public:
+        static constexpr size_t Crawlers = 2;
+
+        IndexJob(uint64_t id, const std::filesystem::path& root, size_t maxInFlight, IndexPipeline pipeline);
+        ~IndexJob();
+        IndexJob(const IndexJob& other) = delete;
+        IndexJob& operator=(const IndexJob& other) = delete;
+        /**
+        * starts the threads of the stages, a job cancelled before it runs is over without running
+        */
+        void run();
+        void cancel();
+        void wait();
+        bool isFinished() const;
+        IndexJobStatus status() const;
+
+    private:
+        struct Stage
+        {
+            Stage(const char* name, size_t workers);
+            StageStatus status() const;
+
+            const char* name;
+            const size_t workers;
+            std::atomic<size_t> running;
+            std::atomic<size_t> processed{0};
+            std::atomic<uint64_t> busyUs{0};
+        };
+
+        using FileQueue = BoundedQueue<IndexedFile>;
+        using FileQueuePtr = std::unique_ptr<FileQueue>;
+
+        void crawl();
+        bool nextDir(std::filesystem::path& dir);
+        void read();
+        void tokenize();
+        void merge(size_t mergerIdx);
+        bool apply(Stage& stage, const IndexPipeline::Stage& fn, IndexedFile& file);
+        void applyBatch(Stage& stage, const IndexPipeline::BatchStage& fn, std::vector<IndexedFile>& files,
+                        std::vector<StageResult>& results);
+        void finish(const IndexedFile& file, StageResult result);
+        bool leave(Stage& stage);
+
+    private:
+        const uint64_t m_id;
+        const IndexPipeline m_pipeline;
+        std::atomic<size_t> m_discovered{0};
+        std::atomic<size_t> m_indexed{0};
+        std::atomic<size_t> m_failed{0};
+        std::atomic<uint64_t> m_bytes{0};
+        std::atomic<bool> m_isCancelled{false};
+        mutable std::mutex m_mtx;
+        std::condition_variable m_cv;
+        bool m_isStarted{false};
+        bool m_isFinished{false};
+        std::chrono::steady_clock::time_point m_start;
+        std::chrono::steady_clock::time_point m_finish;
+        /**
+        * directories left to crawl and the number of crawlers listing one, guarded by m_mtx
+        */
+        std::vector<std::filesystem::path> m_dirs;
+        size_t m_listing{0};
+        Stage m_crawl;
+        Stage m_read;
+        Stage m_tokenize;
+        Stage m_merge;
+        FileQueue m_found;
+        FileQueue m_loaded;
+        std::vector<FileQueuePtr> m_tokenized;
+        /**
+        * started last, once the rest of the job is set up
+        */
+        std::vector<std::thread> m_threads;
+    };
+
+    using IndexJobPtr = std::shared_ptr<IndexJob>;
+
+    class IndexJobs
+    {
+        /**
+        * IndexJobs starts jobs and looks them up by id. Ids start from 1, so 0 never names a job.
+        * The stages of a job are sized to the whole machine, so jobs run one at a time in the order they
+        * were started rather than side by side, a dispatcher thread runs the next one once the last is over.
+        * Finished jobs are kept for their status to be read, the oldest of them are dropped once there
+        * are more than MaxFinished. Destroying the registry cancels the jobs and waits for the running one
+        */
+    public:
+        static constexpr size_t MaxFinished = 64;
+
+        explicit IndexJobs(size_t maxInFlight);
+        ~IndexJobs();
+        IndexJobs(const IndexJobs& other) = delete;
+        IndexJobs& operator=(const IndexJobs& other) = delete;
+        uint64_t start(const std::filesystem::path& root, IndexPipeline pipeline);
+        IndexJobPtr find(uint64_t id) const;
+        bool status(uint64_t id, IndexJobStatus& status) const;
+        bool cancel(uint64_t id, IndexJobStatus& status);
+
+    private:
+        void dispatch();
+
+    private:
+        const size_t m_maxInFlight;
+        mutable std::mutex m_mtx;
+        std::condition_variable m_cv;
+        uint64_t m_nextId{1};
+        std::map<uint64_t, IndexJobPtr> m_jobs;
+        std::deque<IndexJobPtr> m_queued;
+        bool m_isStopping{false};
+        /**
+        * started last, once the rest of the registry is set up
+        */
+        std::thread m_dispatcher;
+    };
+
+    using IndexJobsPtr = std::unique_ptr<IndexJobs>;
+}
@@ -0,0 +1,147 @@
+#include "interner.h"
+#include <algorithm>
+#include <cstring>
+
+namespace core
+{
+    TermInterner::Table::Table(size_t capacity)
+        : mask(capacity - 1)
+        , slots(std::make_unique<std::atomic<uint32_t>[]>(capacity))
+        , entries(std::make_unique<Entry[]>(capacity / 2))
+    {
+    }
+
+    bool TermInterner::Table::find(const HashedTerm& term, size_t& slot) const
+    {
+        /**
+        * linear probing, slot is set to the slot of the term or to the empty slot it would take
+        */
+        for (slot = (term.hash >> StripeBits) & mask;; slot = (slot + 1) & mask)
+        {
+            const uint32_t entry = slots[slot].load(std::memory_order_acquire);
+            if (entry == 0)
+            {
+                return false;
+            }
+            if (entries[entry - 1].hash == term.hash && entries[entry - 1].text == term.text)
+            {
+                return true;
+            }
+        }
+    }
+
+    std::string_view TermInterner::Stripe::store(std::string_view text)
+    {
+        if (text.size() > blockLeft)
+        {
+            const size_t size = std::max(BlockSize, text.size());
+            blocks.push_back(std::make_unique<char[]>(size));
+            blockNext = blocks.back().get();
+            blockLeft = size;
+        }
+        char* dst = blockNext;
+        std::memcpy(dst, text.data(), text.size());
+        blockNext += text.size();
+        blockLeft -= text.size();
+        return {dst, text.size()};
+    }
+
+    void TermInterner::Stripe::grow()
+    {
+        const Table* current = table.load(std::memory_order_relaxed);
+        auto grown = std::make_unique<Table>(current ? (current->mask + 1) * 2 : 16);
+        const uint32_t count = size.load(std::memory_order_relaxed);
+        for (uint32_t idx = 0; idx < count; idx++)
+        {
+            grown->entries[idx] = current->entries[idx];
+            size_t slot = (current->entries[idx].hash >> StripeBits) & grown->mask;
+            while (grown->slots[slot].load(std::memory_order_relaxed) != 0)
+            {
+                slot = (slot + 1) & grown->mask;
+            }
+            grown->slots[slot].store(idx + 1, std::memory_order_relaxed);
+        }
+        table.store(grown.get(), std::memory_order_release);
+        tables.push_back(std::move(grown));
+    }
+
+    TermId TermInterner::makeId(size_t idx, size_t stripeIdx)
+    {
+        return TermId(idx) << StripeBits | TermId(stripeIdx);
+    }
+
+    TermId TermInterner::intern(const HashedTerm& term)
+    {
+        TermId id;
+        if (find(term, id))
+        {
+            return id;
+        }
+
+        const size_t stripeIdx = term.hash & (StripeCount - 1);
+        Stripe& stripe = m_stripes[stripeIdx];
+        std::lock_guard<std::mutex> lock(stripe.mtx);
+        const uint32_t idx = stripe.size.load(std::memory_order_relaxed);
+        const Table* table = stripe.table.load(std::memory_order_relaxed);
+        size_t slot;
+        if (table && table->find(term, slot))
+        {
+            return makeId(table->slots[slot].load(std::memory_order_relaxed) - 1, stripeIdx);
+        }
+        if (!table || (idx + 1) * 2 > table->mask + 1)
+        {
+            stripe.grow();
+            table = stripe.table.load(std::memory_order_relaxed);
+            table->find(term, slot);
+        }
+        /**
+        * the entry is complete before the slot pointing to it is published
+        */
+        table->entries[idx] = {stripe.store(term.text), term.hash};
+        table->slots[slot].store(idx + 1, std::memory_order_release);
+        stripe.size.store(idx + 1, std::memory_order_release);
+        return makeId(idx, stripeIdx);
+    }
+
+    TermId TermInterner::intern(std::string_view term)
+    {
+        return intern(HashedTerm(term));
+    }
+
+    bool TermInterner::find(const HashedTerm& term, TermId& id) const
+    {
+        const size_t stripeIdx = term.hash & (StripeCount - 1);
+        const Table* table = m_stripes[stripeIdx].table.load(std::memory_order_acquire);
+        size_t slot;
+        if (!table || !table->find(term, slot))
+        {
+            return false;
+        }
+        id = makeId(table->slots[slot].load(std::memory_order_relaxed) - 1, stripeIdx);
+        return true;
+    }
+
+    bool TermInterner::find(std::string_view term, TermId& id) const
+    {
+        return find(HashedTerm(term), id);
+    }
+
+    std::string_view TermInterner::term(TermId id) const
+    {
+        /**
+        * whoever holds an id has seen its entry published, a table published later holds a copy of it
+        */
+        const Table* table = m_stripes[id & (StripeCount - 1)].table.load(std::memory_order_acquire);
+        return table->entries[id >> StripeBits].text;
+    }
+
+    size_t TermInterner::size() const
+    {
+        size_t size = 0;
+        for (const Stripe& stripe: m_stripes)
+        {
+            size += stripe.size.load(std::memory_order_acquire);
+        }
+        return size;
+    }
+}
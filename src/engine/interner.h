@@ -0,0 +1,118 @@
+#pragma once
+
+#include "xxh64_hasher.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace core
+{
+    using TermId = uint32_t;
+
+    struct HashedTerm
+    {
+        /**
+        * a term along with its hash, computed once where the term enters the index
+        */
+        explicit HashedTerm(std::string_view text)
+            : text(text)
+            , hash(Xxh64Hasher{}(text))
+        {
+        }
+
+        bool operator==(const HashedTerm& other) const
+        {
+            return hash == other.hash && text == other.text;
+        }
+
+        std::string_view text;
+        size_t hash;
+    };
+
+    struct HashedTermHasher
+    {
+        inline size_t operator()(const HashedTerm& term) const
+        {
+            return term.hash;
+        }
+    };
+
+    class TermInterner
+    {
+        /**
+        * TermInterner assigns every distinct term a stable 32-bit TermId and keeps a single copy of it in
+        * an arena of large blocks, so the views it hands out stay valid for its lifetime. Terms are never
+        * released, a term dropped from the index and indexed again gets its old id back.
+        *
+        * The interner is split into stripes picked by the low bits of the hash, each with its own
+        * open-addressing table and arena. The id of a term is its index within the stripe followed by
+        * the stripe bits, so ids are unique without any shared counter.
+        *
+        * Lookups take no lock and write no shared memory, which matters as every query token of every
+        * shard is looked up here. Writers of a stripe are serialized by its mutex, they fill an entry of
+        * the published table before publishing its slot. A full table is copied into one twice as large,
+        * which is then published in its place, readers still probing the retired table find every term
+        * interned before the swap. Retired tables are freed only with the interner, together they are
+        * smaller than the live one
+        */
+    public:
+        static constexpr unsigned StripeBits = 6;
+        static constexpr size_t StripeCount = size_t{1} << StripeBits;
+
+        TermId intern(const HashedTerm& term);
+        TermId intern(std::string_view term);
+        bool find(const HashedTerm& term, TermId& id) const;
+        bool find(std::string_view term, TermId& id) const;
+        std::string_view term(TermId id) const;
+        size_t size() const;
+
+    private:
+        struct Entry
+        {
+            std::string_view text;
+            size_t hash;
+        };
+
+        struct Table
+        {
+            /**
+            * slots hold the index of an entry plus one, 0 marks an empty slot. Tables are kept at most half full
+            */
+            explicit Table(size_t capacity);
+            bool find(const HashedTerm& term, size_t& slot) const;
+
+            const size_t mask;
+            const std::unique_ptr<std::atomic<uint32_t>[]> slots;
+            const std::unique_ptr<Entry[]> entries;
+        };
+
+        struct Stripe
+        {
+            static constexpr size_t BlockSize = size_t{1} << 14;
+
+            std::string_view store(std::string_view text);
+            void grow();
+
+            std::mutex mtx;
+            std::atomic<const Table*> table{nullptr};
+            std::atomic<uint32_t> size{0};
+            /**
+            * the live table and the retired ones
+            */
+            std::vector<std::unique_ptr<Table>> tables;
+            std::vector<std::unique_ptr<char[]>> blocks;
+            char* blockNext{nullptr};
+            size_t blockLeft{0};
+        };
+
+        static TermId makeId(size_t idx, size_t stripeIdx);
+
+        std::array<Stripe, StripeCount> m_stripes;
+    };
+
+    using TermInternerPtr = std::shared_ptr<TermInterner>;
+}
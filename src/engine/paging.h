@@ -0,0 +1,47 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace core
+{
+    namespace paging
+    {
+        /**
+        * Cursors handed out to clients are opaque, they carry the sort key of the last result of a page
+        * as two numbers. They stay valid as long as the documents keep their ids, i.e. until a restart
+        */
+        inline size_t limit(uint64_t requested, size_t defaultLimit, size_t maxLimit)
+        {
+            /**
+            * 0 requests the default page size, a page holds at least one result
+            */
+            return std::max<size_t>(requested == 0 ? defaultLimit : std::min<size_t>(requested, maxLimit), 1);
+        }
+
+        inline std::string encode(uint64_t first, uint64_t second)
+        {
+            char buf[40];
+            const int size = std::snprintf(buf, sizeof(buf), "%llx.%llx", (unsigned long long)first,
+                                           (unsigned long long)second);
+            return std::string(buf, size);
+        }
+
+        inline bool decode(const std::string& cursor, uint64_t& first, uint64_t& second)
+        {
+            unsigned long long high = 0;
+            unsigned long long low = 0;
+            int consumed = 0;
+            if (std::sscanf(cursor.c_str(), "%llx.%llx%n", &high, &low, &consumed) != 2 ||
+                consumed != (int)cursor.size())
+            {
+                return false;
+            }
+            first = high;
+            second = low;
+            return true;
+        }
+    }
+}
@@ -0,0 +1,624 @@
+#include "postings.h"
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <mutex>
+
+namespace core
+{
+    TokenRecord::Cursor::Cursor(const LaneView& lane)
+        : m_lane(lane)
+        , m_begin(0)
+        , m_end(0)
+    {
+        settle();
+    }
+
+    bool TokenRecord::Cursor::isValid() const
+    {
+        return m_begin < m_lane.size;
+    }
+
+    DocId TokenRecord::Cursor::doc() const
+    {
+        return m_lane.docs[m_begin];
+    }
+
+    size_t TokenRecord::Cursor::termFreq() const
+    {
+        return m_end - m_begin;
+    }
+
+    const size_t* TokenRecord::Cursor::positions() const
+    {
+        return m_lane.positions + m_begin;
+    }
+
+    void TokenRecord::Cursor::next()
+    {
+        m_begin = m_end;
+        settle();
+    }
+
+    void TokenRecord::Cursor::nextGEQ(DocId target)
+    {
+        if (!isValid() || doc() >= target)
+        {
+            return;
+        }
+        uint32_t lo = m_begin;
+        uint32_t hi = m_begin;
+        uint32_t step = 1;
+        while (hi < m_lane.size && m_lane.docs[hi] < target)
+        {
+            lo = hi + 1;
+            hi += step;
+            step *= 2;
+        }
+        m_begin = std::lower_bound(m_lane.docs + lo, m_lane.docs + std::min(hi, m_lane.size), target) - m_lane.docs;
+        settle();
+    }
+
+    void TokenRecord::Cursor::settle()
+    {
+        /**
+        * the postings of a document follow each other, the run of the current one ends at m_end
+        */
+        m_end = m_begin;
+        while (m_end < m_lane.size && m_lane.docs[m_end] == m_lane.docs[m_begin])
+        {
+            m_end++;
+        }
+    }
+
+    size_t* TokenRecord::Lane::positions()
+    {
+        return reinterpret_cast<size_t*>(this + 1);
+    }
+
+    DocId* TokenRecord::Lane::docs()
+    {
+        return reinterpret_cast<DocId*>(positions() + capacity);
+    }
+
+    const size_t* TokenRecord::Lane::positions() const
+    {
+        return reinterpret_cast<const size_t*>(this + 1);
+    }
+
+    const DocId* TokenRecord::Lane::docs() const
+    {
+        return reinterpret_cast<const DocId*>(positions() + capacity);
+    }
+
+    TokenRecord::TokenRecord(std::pmr::memory_resource* resource)
+        : m_resource(resource)
+        , m_inline{{InlineCapacity, {0}, {nullptr}}, {}, {}}
+    {
+        static_assert(offsetof(InlineLane, positions) == sizeof(Lane) &&
+                      offsetof(InlineLane, docs) == sizeof(Lane) + InlineCapacity * sizeof(size_t),
+                      "the arrays of the inline lane must follow it as they do an allocated one");
+        static_assert(offsetof(Block, lane) + sizeof(Lane) == sizeof(Block), "the arrays must follow the lane");
+    }
+
+    TokenRecord::~TokenRecord()
+    {
+        for (Lane* lane = m_inline.lane.next.load(std::memory_order_relaxed); lane;)
+        {
+            Lane* const next = lane->next.load(std::memory_order_relaxed);
+            for (Block* allocated = block(lane); allocated;)
+            {
+                Block* const replaced = allocated->replaced;
+                const size_t capacity = allocated->lane.capacity;
+                allocated->~Block();
+                m_resource->deallocate(allocated, sizeof(Block) + capacity * (sizeof(size_t) + sizeof(DocId)),
+                                       alignof(Block));
+                allocated = replaced;
+            }
+            lane = next;
+        }
+    }
+
+    TokenRecord::Block* TokenRecord::block(Lane* lane)
+    {
+        return reinterpret_cast<Block*>(reinterpret_cast<char*>(lane) - offsetof(Block, lane));
+    }
+
+    TokenRecord::Lane* TokenRecord::allocate(const Lane* lane, uint32_t capacity, Block* replaced)
+    {
+        /**
+        * the block and its arrays take a single allocation, positions come first as they are the more aligned
+        */
+        void* memory = m_resource->allocate(sizeof(Block) + capacity * (sizeof(size_t) + sizeof(DocId)), alignof(Block));
+        Block* res = new (memory) Block{replaced, {capacity, {0}, {nullptr}}};
+        if (lane)
+        {
+            const uint32_t size = lane->size.load(std::memory_order_relaxed);
+            std::copy(lane->docs(), lane->docs() + size, res->lane.docs());
+            std::copy(lane->positions(), lane->positions() + size, res->lane.positions());
+            res->lane.size.store(size, std::memory_order_relaxed);
+            res->lane.next.store(lane->next.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+        return &res->lane;
+    }
+
+    bool TokenRecord::hasRoom(const Lane& lane, uint32_t size, size_t count) const
+    {
+        /**
+        * allocated lanes grow, the inline one is never replaced
+        */
+        return &lane != &m_inline.lane || size + count <= InlineCapacity;
+    }
+
+    bool TokenRecord::insert(DocId docId, const size_t* positions, size_t count, bool& isNewDoc)
+    {
+        /**
+        * Runs the writer sees are only read here, under the lock. The positions the runs of the document
+        * hold already are dropped, the rest extend the run ending a lane if they follow it, and go to the
+        * first lane the document follows otherwise. Nothing published is ever rewritten
+        */
+        isNewDoc = true;
+        std::vector<size_t> missing;
+        Lane* tail = nullptr;
+        std::atomic<Lane*>* tailLink = nullptr;
+        Lane* followed = nullptr;
+        std::atomic<Lane*>* followedLink = nullptr;
+        Lane* last = nullptr;
+        std::atomic<Lane*>* link = nullptr;
+        for (Lane* lane = &m_inline.lane; lane; link = &lane->next, lane = link->load(std::memory_order_relaxed))
+        {
+            last = lane;
+            const uint32_t size = lane->size.load(std::memory_order_relaxed);
+            const DocId* docs = lane->docs();
+            if (size == 0 || docs[size - 1] < docId)
+            {
+                if (!followed && hasRoom(*lane, size, count))
+                {
+                    followed = lane;
+                    followedLink = link;
+                }
+                continue;
+            }
+            const uint32_t begin = std::lower_bound(docs, docs + size, docId) - docs;
+            const uint32_t end = std::upper_bound(docs + begin, docs + size, docId) - docs;
+            if (begin == end)
+            {
+                continue;
+            }
+            if (isNewDoc)
+            {
+                missing.assign(positions, positions + count);
+                isNewDoc = false;
+            }
+            const size_t* run = lane->positions() + begin;
+            missing.erase(std::remove_if(missing.begin(), missing.end(), [run, begin, end](size_t pos) {
+                return std::binary_search(run, run + (end - begin), pos);
+            }), missing.end());
+            if (end == size)
+            {
+                tail = lane;
+                tailLink = link;
+            }
+        }
+        if (!isNewDoc)
+        {
+            if (missing.empty())
+            {
+                return false;
+            }
+            positions = missing.data();
+            count = missing.size();
+        }
+
+        Lane* target = followed;
+        std::atomic<Lane*>* targetLink = followedLink;
+        if (tail)
+        {
+            const uint32_t size = tail->size.load(std::memory_order_relaxed);
+            if (tail->positions()[size - 1] < positions[0] && hasRoom(*tail, size, count))
+            {
+                target = tail;
+                targetLink = tailLink;
+            }
+        }
+        const bool isOpened = !target;
+        if (isOpened)
+        {
+            /**
+            * the document follows no lane with room for it, a new lane is linked last
+            */
+            target = allocate(nullptr, std::max<uint32_t>(count, InlineCapacity), nullptr);
+            last->next.store(target, std::memory_order_release);
+        }
+        const uint32_t size = target->size.load(std::memory_order_relaxed);
+        if (size + count > target->capacity)
+        {
+            Lane* lane = allocate(target, std::max<uint32_t>(2 * target->capacity, size + count), block(target));
+            targetLink->store(lane, std::memory_order_release);
+            target = lane;
+        }
+        std::fill(target->docs() + size, target->docs() + size + count, docId);
+        std::copy(positions, positions + count, target->positions() + size);
+        target->size.store(size + count, std::memory_order_release);
+        if (isOpened)
+        {
+            mergeLast();
+        }
+        return true;
+    }
+
+    void TokenRecord::mergeLast()
+    {
+        /**
+        * Lanes opened for documents arriving in descending order, or positions of one document arriving in
+        * descending order, would pile up. The last lane is merged with the one before it for as long as it
+        * holds at least half as many postings, as a shard merges segments of a tier, so a record keeps
+        * a logarithmic number of lanes and a posting is copied a logarithmic number of times.
+        * The merged lane is published in place of both, a document of the two ends up in a single run
+        */
+        while (true)
+        {
+            std::atomic<Lane*>* link = &m_inline.lane.next;
+            Lane* first = link->load(std::memory_order_relaxed);
+            if (!first)
+            {
+                return;
+            }
+            Lane* second = first->next.load(std::memory_order_relaxed);
+            while (second && second->next.load(std::memory_order_relaxed))
+            {
+                link = &first->next;
+                first = second;
+                second = second->next.load(std::memory_order_relaxed);
+            }
+            if (!second)
+            {
+                return;
+            }
+            const uint32_t firstSize = first->size.load(std::memory_order_relaxed);
+            const uint32_t secondSize = second->size.load(std::memory_order_relaxed);
+            if (2 * size_t{secondSize} < firstSize)
+            {
+                return;
+            }
+
+            /**
+            * the blocks the second lane has replaced are no more than its postings, chaining there is cheap
+            */
+            Block* tail = block(second);
+            while (tail->replaced)
+            {
+                tail = tail->replaced;
+            }
+            tail->replaced = block(first);
+            Lane* merged = allocate(nullptr, firstSize + secondSize, block(second));
+            uint32_t i = 0;
+            uint32_t j = 0;
+            for (uint32_t k = 0; k < firstSize + secondSize; k++)
+            {
+                const bool isFirst = j == secondSize ||
+                    (i < firstSize && std::make_pair(first->docs()[i], first->positions()[i]) <
+                                      std::make_pair(second->docs()[j], second->positions()[j]));
+                Lane* source = isFirst ? first : second;
+                uint32_t& idx = isFirst ? i : j;
+                merged->docs()[k] = source->docs()[idx];
+                merged->positions()[k] = source->positions()[idx];
+                idx++;
+            }
+            merged->size.store(firstSize + secondSize, std::memory_order_relaxed);
+            link->store(merged, std::memory_order_release);
+        }
+    }
+
+    void TokenRecord::append(DocId docId, const std::vector<size_t>& positions)
+    {
+        if (positions.empty())
+        {
+            return;
+        }
+        std::unique_lock<utils::SharedSpinMutex> lock(m_mtx);
+        bool isNewDoc;
+        if (std::is_sorted(positions.begin(), positions.end()))
+        {
+            insert(docId, positions.data(), positions.size(), isNewDoc);
+            return;
+        }
+        std::vector<size_t> sorted = positions;
+        std::sort(sorted.begin(), sorted.end());
+        insert(docId, sorted.data(), sorted.size(), isNewDoc);
+    }
+
+    bool TokenRecord::addIfNotPresent(const Posting& posting, bool& isNewDoc)
+    {
+        std::unique_lock<utils::SharedSpinMutex> lock(m_mtx);
+        return insert(posting.first, &posting.second, 1, isNewDoc);
+    }
+
+    std::vector<TokenRecord::LaneView> TokenRecord::lanes() const
+    {
+        std::vector<LaneView> res;
+        for (const Lane* lane = &m_inline.lane; lane; lane = lane->next.load(std::memory_order_acquire))
+        {
+            const uint32_t size = lane->size.load(std::memory_order_acquire);
+            if (size > 0)
+            {
+                res.push_back({lane->docs(), lane->positions(), size});
+            }
+        }
+        return res;
+    }
+
+    size_t TokenRecord::size() const
+    {
+        size_t size = 0;
+        for (const LaneView& lane: lanes())
+        {
+            size += lane.size;
+        }
+        return size;
+    }
+
+    bool TokenRecord::isInline() const
+    {
+        return !m_inline.lane.next.load(std::memory_order_acquire);
+    }
+
+    std::vector<Posting> TokenRecord::snapshot() const
+    {
+        std::vector<Posting> postings;
+        for (const LaneView& lane: lanes())
+        {
+            const size_t merged = postings.size();
+            for (uint32_t i = 0; i < lane.size; i++)
+            {
+                postings.emplace_back(lane.docs[i], lane.positions[i]);
+            }
+            std::inplace_merge(postings.begin(), postings.begin() + merged, postings.end());
+        }
+        return postings;
+    }
+
+    PostingList::Cursor::Cursor(const PostingList& list)
+    {
+        m_parts.reserve(list.m_segments.size() + list.m_records.size());
+        for (const auto& part: list.m_segments)
+        {
+            m_parts.push_back({Segment::Cursor(*part.segment, part.termIdx), part.docTrace});
+        }
+        for (const auto& part: list.m_records)
+        {
+            m_parts.push_back({TokenRecord::Cursor(part.lane), part.docTrace});
+        }
+        settle();
+    }
+
+    bool PostingList::Cursor::isValid() const
+    {
+        return m_current < m_parts.size();
+    }
+
+    DocId PostingList::Cursor::doc() const
+    {
+        return std::visit([](const auto& cursor) { return cursor.doc(); }, m_parts[m_current].cursor);
+    }
+
+    size_t PostingList::Cursor::termFreq() const
+    {
+        if (m_isMerged)
+        {
+            return m_merged.size();
+        }
+        return std::visit([](const auto& cursor) { return cursor.termFreq(); }, m_parts[m_current].cursor);
+    }
+
+    const size_t* PostingList::Cursor::positions() const
+    {
+        if (m_isMerged)
+        {
+            return m_merged.data();
+        }
+        return std::visit([](const auto& cursor) { return cursor.positions(); }, m_parts[m_current].cursor);
+    }
+
+    void PostingList::Cursor::next()
+    {
+        const DocId current = doc();
+        for (auto& part: m_parts)
+        {
+            std::visit([current](auto& cursor) {
+                if (cursor.isValid() && cursor.doc() == current)
+                {
+                    cursor.next();
+                }
+            }, part.cursor);
+        }
+        settle();
+    }
+
+    void PostingList::Cursor::nextGEQ(DocId target)
+    {
+        for (auto& part: m_parts)
+        {
+            std::visit([target](auto& cursor) { cursor.nextGEQ(target); }, part.cursor);
+        }
+        settle();
+    }
+
+    void PostingList::Cursor::settle()
+    {
+        /**
+        * moves to the part with the smallest document, documents deleted in the meantime are stepped over.
+        * The positions of a document found in several parts are merged
+        */
+        while (true)
+        {
+            m_current = m_parts.size();
+            m_isMerged = false;
+            DocId current = 0;
+            size_t count = 0;
+            for (size_t i = 0; i < m_parts.size(); i++)
+            {
+                std::visit([this, i, &current, &count](const auto& cursor) {
+                    if (!cursor.isValid())
+                    {
+                        return;
+                    }
+                    if (m_current == m_parts.size() || cursor.doc() < current)
+                    {
+                        m_current = i;
+                        current = cursor.doc();
+                        count = 1;
+                    }
+                    else if (cursor.doc() == current)
+                    {
+                        count++;
+                    }
+                }, m_parts[i].cursor);
+            }
+            if (m_current == m_parts.size())
+            {
+                return;
+            }
+            if (m_parts[m_current].docTrace->isAlive(current))
+            {
+                if (count > 1)
+                {
+                    merge(current);
+                }
+                return;
+            }
+            for (auto& part: m_parts)
+            {
+                std::visit([current](auto& cursor) {
+                    if (cursor.isValid() && cursor.doc() == current)
+                    {
+                        cursor.next();
+                    }
+                }, part.cursor);
+            }
+        }
+    }
+
+    void PostingList::Cursor::merge(DocId docId)
+    {
+        m_merged.clear();
+        for (const auto& part: m_parts)
+        {
+            std::visit([this, docId](const auto& cursor) {
+                if (cursor.isValid() && cursor.doc() == docId)
+                {
+                    const size_t merged = m_merged.size();
+                    m_merged.insert(m_merged.end(), cursor.positions(), cursor.positions() + cursor.termFreq());
+                    std::inplace_merge(m_merged.begin(), m_merged.begin() + merged, m_merged.end());
+                }
+            }, part.cursor);
+        }
+        m_isMerged = true;
+    }
+
+    void PostingList::add(const DocTrace& docTrace, const TokenRecord& record)
+    {
+        /**
+        * every lane is a part of its own, read in place
+        */
+        pin();
+        for (const TokenRecord::LaneView& lane: record.lanes())
+        {
+            m_records.push_back({&docTrace, lane});
+        }
+        m_size = UnknownSize;
+    }
+
+    void PostingList::add(const DocTrace& docTrace, const Segment& segment, uint32_t termIdx)
+    {
+        pin();
+        m_segments.push_back({&docTrace, &segment, termIdx});
+        m_size = UnknownSize;
+    }
+
+    void PostingList::append(const PostingList& other)
+    {
+        pin();
+        m_segments.insert(m_segments.end(), other.m_segments.begin(), other.m_segments.end());
+        m_records.insert(m_records.end(), other.m_records.begin(), other.m_records.end());
+        m_size = UnknownSize;
+    }
+
+    void PostingList::pin()
+    {
+        /**
+        * nested in the pin the parts were loaded under, so the pinned epoch stays the one of the parts
+        */
+        if (!m_guard)
+        {
+            m_guard = utils::Epoch::global().pin();
+        }
+    }
+
+    bool PostingList::empty() const
+    {
+        /**
+        * parts holding only postings of deleted documents do not count
+        */
+        return !Cursor(*this).isValid();
+    }
+
+    size_t PostingList::size() const
+    {
+        size_t size = m_size.load(std::memory_order_relaxed);
+        if (size != UnknownSize)
+        {
+            return size;
+        }
+        size = 0;
+        forEachDoc([&size](DocId, size_t termFreq) {
+            size += termFreq;
+        });
+        m_size.store(size, std::memory_order_relaxed);
+        return size;
+    }
+
+    Json PostingList::serialize() const
+    {
+        Json postings;
+        forEach([&postings](DocId docId, size_t pos) {
+            postings.push_back(Json::array({docId, pos}));
+        });
+        return postings;
+    }
+
+    std::vector<Posting> PostingList::page(const std::optional<Posting>& after, size_t limit, bool isByDocument) const
+    {
+        std::vector<Posting> page;
+        if (limit == 0)
+        {
+            return page;
+        }
+        Cursor cursor(*this);
+        if (after)
+        {
+            cursor.nextGEQ(after->first);
+        }
+        size_t docs = 0;
+        for (; cursor.isValid(); cursor.next())
+        {
+            const size_t* positions = cursor.positions();
+            bool isNewDoc = true;
+            for (size_t i = 0; i < cursor.termFreq(); i++)
+            {
+                const Posting posting{cursor.doc(), positions[i]};
+                if (after && posting <= *after)
+                {
+                    continue;
+                }
+                if (isByDocument ? isNewDoc && docs++ == limit : page.size() == limit)
+                {
+                    return page;
+                }
+                isNewDoc = false;
+                page.push_back(posting);
+            }
+        }
+        return page;
+    }
+}
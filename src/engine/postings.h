@@ -0,0 +1,274 @@
+#pragma once
+
+#include "segment.h"
+#include "spin_mutex.h"
+#include "epoch.h"
+#include <limits>
+#include <memory_resource>
+#include <optional>
+#include <type_traits>
+#include <variant>
+
+namespace core
+{
+    class TokenRecord
+    {
+        /**
+        * Mutable posting list of a token inside the in-memory buffer of a shard, appended to by writers and
+        * read in place by readers without any locking.
+        *
+        * Postings are kept in lanes, every lane holding runs of ascending documents in (DocId, position)
+        * order. A new document is appended to the first lane it follows, one that follows no lane opens a
+        * new lane, so a record has about as many lanes as documents were indexed concurrently. Positions of
+        * a document already present extend its run when they follow it and form a run of their own in
+        * another lane otherwise, so a document may span lanes but never occurs twice in one.
+        * A lane is only ever appended to: the writer fills the slots past its published size and then raises
+        * the size, a full lane is copied into one twice as large, which is published in its place, and a lane
+        * opened last is merged with the one before it when about as large (see mergeLast). Replaced lanes
+        * are kept until the record is destroyed, so the arrays and the size of a lane loaded once make
+        * an immutable view.
+        *
+        * The first lane is stored in the record itself and holds at most InlineCapacity postings, later
+        * lanes are allocated from resource, the arena of the buffer when the record lives in one. Writers
+        * serialize on a one-word lock, a record takes 80 bytes on 64-bit targets and no allocation until it
+        * outgrows its inline lane
+        */
+    public:
+        static constexpr uint32_t InlineCapacity = 4;
+
+        struct LaneView
+        {
+            /**
+            * the postings of a lane at the time it was loaded, docs[i] and positions[i] make the i-th one
+            */
+            const DocId* docs;
+            const size_t* positions;
+            uint32_t size;
+        };
+
+        class Cursor
+        {
+            /**
+            * Cursor walks the documents of a lane in DocId order, targets of nextGEQ are reached by galloping
+            */
+        public:
+            explicit Cursor(const LaneView& lane);
+            bool isValid() const;
+            DocId doc() const;
+            size_t termFreq() const;
+            const size_t* positions() const;
+            void next();
+            void nextGEQ(DocId target);
+
+        private:
+            void settle();
+
+        private:
+            LaneView m_lane;
+            uint32_t m_begin;
+            uint32_t m_end;
+        };
+
+        explicit TokenRecord(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+        ~TokenRecord();
+        TokenRecord(const TokenRecord& other) = delete;
+        TokenRecord& operator=(const TokenRecord& other) = delete;
+        void append(DocId docId, const std::vector<size_t>& positions);
+        bool addIfNotPresent(const Posting& posting, bool& isNewDoc);
+        size_t size() const;
+        bool isInline() const;
+        /**
+        * the postings of the record in (DocId, position) order
+        */
+        std::vector<Posting> snapshot() const;
+        std::vector<LaneView> lanes() const;
+
+    private:
+        struct Lane
+        {
+            /**
+            * capacity positions and then capacity DocIds follow the lane in memory
+            */
+            uint32_t capacity;
+            std::atomic<uint32_t> size;
+            std::atomic<Lane*> next;
+
+            size_t* positions();
+            DocId* docs();
+            const size_t* positions() const;
+            const DocId* docs() const;
+        };
+
+        struct InlineLane
+        {
+            Lane lane;
+            size_t positions[InlineCapacity];
+            DocId docs[InlineCapacity];
+        };
+
+        struct Block
+        {
+            /**
+            * an allocated lane, linked to the lane it has replaced if any
+            */
+            Block* replaced;
+            Lane lane;
+        };
+
+        /**
+        * inserts the postings of a document, positions in ascending order, returns false if all of them
+        * are present already
+        */
+        bool insert(DocId docId, const size_t* positions, size_t count, bool& isNewDoc);
+        /**
+        * a copy of lane, or an empty lane if null, with room for capacity postings, which is not published yet
+        */
+        Lane* allocate(const Lane* lane, uint32_t capacity, Block* replaced);
+        static Block* block(Lane* lane);
+        void mergeLast();
+        bool hasRoom(const Lane& lane, uint32_t size, size_t count) const;
+
+    private:
+        mutable utils::SharedSpinMutex m_mtx;
+        std::pmr::memory_resource* m_resource;
+        InlineLane m_inline;
+    };
+
+    static_assert(sizeof(TokenRecord) <= 80, "an inline record is meant to stay small, most tokens occur only a few times");
+
+    class PostingList
+    {
+        /**
+        * PostingList gathers the postings of a single token across the buffers and segments of one or more
+        * shards. Of a buffer record the lanes are taken as they are when added, so the list is an immutable
+        * snapshot read in place without locks even if a shard appends, seals or merges in the meantime.
+        * Parts are plain pointers kept valid by pinning the epoch for the lifetime of the list, so the list
+        * must be destroyed by the thread that built it. Postings of deleted documents are skipped.
+        */
+    public:
+        class Cursor
+        {
+            /**
+            * Cursor walks the live documents of a posting list in DocId order by merging the cursors of its
+            * parts. It must not outlive the list. A document lives in a single buffer or segment but may
+            * span lanes of a record, the positions of such a document are merged into the cursor, which
+            * allocates only then and when created
+            */
+        public:
+            explicit Cursor(const PostingList& list);
+            bool isValid() const;
+            DocId doc() const;
+            size_t termFreq() const;
+            /**
+            * positions of the token in the current document, termFreq() of them in ascending order
+            */
+            const size_t* positions() const;
+            void next();
+            void nextGEQ(DocId target);
+
+        private:
+            void settle();
+            void merge(DocId docId);
+
+        private:
+            struct Part
+            {
+                std::variant<Segment::Cursor, TokenRecord::Cursor> cursor;
+                const DocTrace* docTrace;
+            };
+
+            std::vector<Part> m_parts;
+            size_t m_current;
+            /**
+            * positions of the current document when it spans parts
+            */
+            std::vector<size_t> m_merged;
+            bool m_isMerged{false};
+        };
+
+        PostingList() = default;
+        /**
+        * parts are added by a thread that keeps the epoch pinned while it loads them
+        */
+        void add(const DocTrace& docTrace, const TokenRecord& record);
+        void add(const DocTrace& docTrace, const Segment& segment, uint32_t termIdx);
+        void append(const PostingList& other);
+        bool empty() const;
+        /**
+        * the number of live postings, counted once on the first call
+        */
+        size_t size() const;
+        Json serialize() const;
+        /**
+        * Returns the live postings following after in (DocId, position) order, at most limit of them, or
+        * all postings of at most limit documents when isByDocument is set. The cursor seeks to after
+        * directly and stops as soon as the page is full
+        */
+        std::vector<Posting> page(const std::optional<Posting>& after, size_t limit, bool isByDocument) const;
+
+        template<typename Callback>
+        void forEach(Callback&& callback) const
+        {
+            /**
+            * calls callback(docId, pos) for every live posting in (DocId, position) order, a callback
+            * returning bool stops the traversal by returning false
+            */
+            for (Cursor cursor(*this); cursor.isValid(); cursor.next())
+            {
+                const size_t* positions = cursor.positions();
+                for (size_t i = 0; i < cursor.termFreq(); i++)
+                {
+                    if constexpr (std::is_same_v<std::invoke_result_t<Callback, DocId, size_t>, bool>)
+                    {
+                        if (!callback(cursor.doc(), positions[i]))
+                        {
+                            return;
+                        }
+                    }
+                    else
+                    {
+                        callback(cursor.doc(), positions[i]);
+                    }
+                }
+            }
+        }
+
+        template<typename Callback>
+        void forEachDoc(Callback&& callback) const
+        {
+            /**
+            * calls callback(docId, termFreq) for every live document, positions are not visited
+            */
+            for (Cursor cursor(*this); cursor.isValid(); cursor.next())
+            {
+                callback(cursor.doc(), cursor.termFreq());
+            }
+        }
+
+    private:
+        struct SegmentPart
+        {
+            const DocTrace* docTrace;
+            const Segment* segment;
+            uint32_t termIdx;
+        };
+
+        struct RecordPart
+        {
+            const DocTrace* docTrace;
+            TokenRecord::LaneView lane;
+        };
+
+        static constexpr size_t UnknownSize = std::numeric_limits<size_t>::max();
+
+        void pin();
+
+        std::vector<SegmentPart> m_segments;
+        std::vector<RecordPart> m_records;
+        mutable std::atomic<size_t> m_size{UnknownSize};
+        utils::Epoch::Guard m_guard;
+    };
+
+    using PostingListPtr = std::shared_ptr<PostingList>;
+    using ConstPostingListPtr = std::shared_ptr<const PostingList>;
+}
@@ -0,0 +1,967 @@
+#include "query.h"
+#include "tokenizer.h"
+#include "unicode.h"
+#include "term_dict.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace core
+{
+    namespace query
+    {
+        namespace
+        {
+            struct Lexeme
+            {
+                enum class Type
+                {
+                    Open,
+                    Close,
+                    And,
+                    Or,
+                    Not,
+                    Operand,
+                };
+
+                Type type;
+                Node operand{};
+            };
+
+            class Parser
+            {
+                /**
+                * or := and (OR and)*, and := unary (AND? unary)*, unary := NOT unary | operand | ( or )
+                */
+            public:
+                explicit Parser(const std::vector<Lexeme>& lexemes)
+                    : m_lexemes(lexemes)
+                {
+                }
+
+                Node parse()
+                {
+                    Node root = parseOr();
+                    while (m_next < m_lexemes.size())
+                    {
+                        /**
+                        * a stray closing parenthesis ends the expression early, the rest is joined by AND
+                        */
+                        m_next++;
+                        Node rest = parseOr();
+                        if (!isEmpty(rest))
+                        {
+                            root = join(Node::Type::And, std::move(root), std::move(rest));
+                        }
+                    }
+                    return root;
+                }
+
+            private:
+                static bool isEmpty(const Node& node)
+                {
+                    return (node.type == Node::Type::And || node.type == Node::Type::Or) && node.children.empty();
+                }
+
+                static Node join(Node::Type type, Node first, Node second)
+                {
+                    if (isEmpty(first))
+                    {
+                        return second;
+                    }
+                    Node node{type};
+                    for (Node* part: {&first, &second})
+                    {
+                        if (part->type == type)
+                        {
+                            for (auto& child: part->children)
+                            {
+                                node.children.push_back(std::move(child));
+                            }
+                        }
+                        else
+                        {
+                            node.children.push_back(std::move(*part));
+                        }
+                    }
+                    return node;
+                }
+
+                bool accept(Lexeme::Type type)
+                {
+                    if (m_next < m_lexemes.size() && m_lexemes[m_next].type == type)
+                    {
+                        m_next++;
+                        return true;
+                    }
+                    return false;
+                }
+
+                bool isAtOperand() const
+                {
+                    if (m_next == m_lexemes.size())
+                    {
+                        return false;
+                    }
+                    const Lexeme::Type type = m_lexemes[m_next].type;
+                    return type == Lexeme::Type::Operand || type == Lexeme::Type::Open || type == Lexeme::Type::Not;
+                }
+
+                Node parseOr()
+                {
+                    Node node = parseAnd();
+                    while (accept(Lexeme::Type::Or))
+                    {
+                        Node next = parseAnd();
+                        if (!isEmpty(next))
+                        {
+                            node = join(Node::Type::Or, std::move(node), std::move(next));
+                        }
+                    }
+                    return node;
+                }
+
+                Node parseAnd()
+                {
+                    Node node{Node::Type::And};
+                    while (true)
+                    {
+                        const bool isExplicit = accept(Lexeme::Type::And);
+                        if (!isAtOperand())
+                        {
+                            if (isExplicit)
+                            {
+                                continue;
+                            }
+                            return node;
+                        }
+                        Node next = parseUnary();
+                        if (!isEmpty(next))
+                        {
+                            node = join(Node::Type::And, std::move(node), std::move(next));
+                        }
+                    }
+                }
+
+                Node parseUnary()
+                {
+                    if (accept(Lexeme::Type::Not))
+                    {
+                        if (!isAtOperand())
+                        {
+                            return Node{Node::Type::And};
+                        }
+                        Node child = parseUnary();
+                        if (isEmpty(child))
+                        {
+                            return child;
+                        }
+                        Node node{Node::Type::Not};
+                        node.children.push_back(std::move(child));
+                        return node;
+                    }
+                    if (accept(Lexeme::Type::Open))
+                    {
+                        Node node = parseOr();
+                        accept(Lexeme::Type::Close);
+                        return node;
+                    }
+                    return m_lexemes[m_next++].operand;
+                }
+
+            private:
+                const std::vector<Lexeme>& m_lexemes;
+                size_t m_next{0};
+            };
+
+            bool isSeparator(char ch)
+            {
+                return std::isspace(static_cast<unsigned char>(ch)) || ch == '(' || ch == ')' || ch == '"';
+            }
+
+            bool isFuzzy(std::string_view word)
+            {
+                /**
+                * a word followed by ~ and an optional number of edits, e.g. aple~1
+                */
+                const size_t tilde = word.rfind('~');
+                return tilde != std::string_view::npos && tilde > 0 &&
+                       std::all_of(word.begin() + tilde + 1, word.end(), [](char ch) {
+                           return std::isdigit(static_cast<unsigned char>(ch));
+                       });
+            }
+
+            void normalize(std::string& word, bool toLowercase, bool toNfc)
+            {
+                /**
+                * words taken as they are rather than tokenized are brought to the form of indexed tokens
+                */
+                if (toLowercase)
+                {
+                    unicode::foldCase(word);
+                }
+                if (toNfc)
+                {
+                    unicode::toNfc(word);
+                }
+            }
+        }
+
+        Query parse(const std::string& query, bool toLowercase, const Expander& expand,
+                    const FuzzyExpander& fuzzyExpand, bool toNfc)
+        {
+            Query res;
+            std::vector<Lexeme> lexemes;
+            auto addOperand = [&res, &lexemes, toLowercase, toNfc](std::string_view text, size_t slop,
+                                                                   bool isPhrase) {
+                const size_t begin = res.tokens.size();
+                const TokenizedText tokenized(text, toLowercase, toNfc);
+                for (const auto& [token, _]: tokenized.tokens())
+                {
+                    res.tokens.emplace_back(token);
+                }
+                const size_t end = res.tokens.size();
+                if (begin == end)
+                {
+                    return;
+                }
+                /**
+                * a word splitting into several tokens, e.g. o'clock-wise, is taken as a phrase
+                */
+                const Node::Type type = isPhrase || end - begin > 1 ? Node::Type::Phrase : Node::Type::Term;
+                lexemes.push_back({Lexeme::Type::Operand, Node{type, begin, end, slop}});
+            };
+
+            auto addExpansion = [&res, &lexemes](std::vector<std::string> terms, std::string fallback) {
+                /**
+                * a word expanding to nothing is kept as is, no indexed token can match it
+                */
+                if (terms.empty())
+                {
+                    terms.push_back(std::move(fallback));
+                }
+                Node operand{Node::Type::Or};
+                for (auto& term: terms)
+                {
+                    const size_t t = res.tokens.size();
+                    operand.children.push_back(Node{Node::Type::Term, t, t + 1});
+                    res.tokens.push_back(std::move(term));
+                }
+                lexemes.push_back({Lexeme::Type::Operand, operand.children.size() == 1
+                                                              ? std::move(operand.children.front())
+                                                              : std::move(operand)});
+            };
+
+            for (size_t i = 0; i < query.size();)
+            {
+                const char ch = query[i];
+                if (std::isspace(static_cast<unsigned char>(ch)))
+                {
+                    i++;
+                }
+                else if (ch == '(' || ch == ')')
+                {
+                    lexemes.push_back({ch == '(' ? Lexeme::Type::Open : Lexeme::Type::Close});
+                    res.isBagOfWords = false;
+                    i++;
+                }
+                else if (ch == '"')
+                {
+                    const size_t close = std::min(query.find('"', i + 1), query.size());
+                    size_t next = close + 1;
+                    size_t slop = 0;
+                    if (next < query.size() && query[next] == '~')
+                    {
+                        char* end;
+                        slop = std::strtoull(query.c_str() + next + 1, &end, 10);
+                        next = end - query.c_str();
+                    }
+                    addOperand(std::string_view(query).substr(i + 1, close - i - 1), slop, true);
+                    res.isBagOfWords = false;
+                    i = std::min(next, query.size());
+                }
+                else
+                {
+                    size_t end = i;
+                    while (end < query.size() && !isSeparator(query[end]))
+                    {
+                        end++;
+                    }
+                    const std::string_view word = std::string_view(query).substr(i, end - i);
+                    if (word == "AND" || word == "OR" || word == "NOT")
+                    {
+                        lexemes.push_back({word == "AND" ? Lexeme::Type::And
+                                                         : word == "OR" ? Lexeme::Type::Or : Lexeme::Type::Not});
+                        res.isBagOfWords = false;
+                    }
+                    else if (expand && wildcard::isPattern(word))
+                    {
+                        std::string pattern{word};
+                        normalize(pattern, toLowercase, toNfc);
+                        std::vector<std::string> terms = expand(pattern);
+                        addExpansion(std::move(terms), std::move(pattern));
+                    }
+                    else if (fuzzyExpand && isFuzzy(word))
+                    {
+                        /**
+                        * word~N allows N edits, a bare ~ the most edits supported
+                        */
+                        const size_t tilde = word.rfind('~');
+                        std::string token{word.substr(0, tilde)};
+                        normalize(token, toLowercase, toNfc);
+                        const size_t maxEdits = tilde + 1 == word.size()
+                                                    ? fuzzy::MaxEdits
+                                                    : std::strtoull(word.data() + tilde + 1, nullptr, 10);
+                        addExpansion(fuzzyExpand(token, maxEdits), std::string{word});
+                    }
+                    else
+                    {
+                        addOperand(word, 0, false);
+                    }
+                    i = end;
+                }
+            }
+
+            if (res.isBagOfWords)
+            {
+                res.root = Node{Node::Type::Or};
+                for (size_t t = 0; t < res.tokens.size(); t++)
+                {
+                    res.root.children.push_back(Node{Node::Type::Term, t, t + 1});
+                }
+                return res;
+            }
+            res.root = Parser(lexemes).parse();
+            return res;
+        }
+
+        static void collectRequired(const Node& node, std::vector<size_t>& tokens)
+        {
+            if (node.type == Node::Type::Term || node.type == Node::Type::Phrase)
+            {
+                for (size_t t = node.begin; t < node.end; t++)
+                {
+                    tokens.push_back(t);
+                }
+            }
+            else if (node.type == Node::Type::And)
+            {
+                for (const auto& child: node.children)
+                {
+                    collectRequired(child, tokens);
+                }
+            }
+        }
+
+        std::vector<size_t> requiredTokens(const Query& query)
+        {
+            std::vector<size_t> tokens;
+            collectRequired(query.root, tokens);
+            return tokens;
+        }
+
+        static size_t seek(const DocId* ids, size_t size, size_t lo, DocId target)
+        {
+            /**
+            * the first index from lo on holding an id not less than target, found by galloping from lo
+            */
+            size_t step = 1;
+            size_t hi = lo;
+            while (hi < size && ids[hi] < target)
+            {
+                lo = hi + 1;
+                hi += step;
+                step *= 2;
+            }
+            return std::lower_bound(ids + lo, ids + std::min(hi, size), target) - ids;
+        }
+
+        static void gallop(const DocId* small, size_t smallSize, const DocId* large, size_t largeSize,
+                           std::vector<DocId>& out)
+        {
+            size_t lo = 0;
+            for (size_t i = 0; i < smallSize && lo < largeSize; i++)
+            {
+                const DocId target = small[i];
+                lo = seek(large, largeSize, lo, target);
+                if (lo < largeSize && large[lo] == target)
+                {
+                    out.push_back(target);
+                    lo++;
+                }
+            }
+        }
+
+#if defined(__SSE2__)
+        static int matchBlocks(const DocId* first, const DocId* second)
+        {
+            /**
+            * a block of four ids of first is compared against every rotation of a block of second, bit k
+            * of the result is set if first[k] occurs in the block of second
+            */
+            const __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            const __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(second));
+            const __m128i eq = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi32(left, right),
+                             _mm_cmpeq_epi32(left, _mm_shuffle_epi32(right, _MM_SHUFFLE(0, 3, 2, 1)))),
+                _mm_or_si128(_mm_cmpeq_epi32(left, _mm_shuffle_epi32(right, _MM_SHUFFLE(1, 0, 3, 2))),
+                             _mm_cmpeq_epi32(left, _mm_shuffle_epi32(right, _MM_SHUFFLE(2, 1, 0, 3)))));
+            return _mm_movemask_ps(_mm_castsi128_ps(eq));
+        }
+#endif
+
+        static constexpr size_t GallopRatio = 32;
+
+        void intersect(const DocId* first, size_t firstSize, const DocId* second, size_t secondSize,
+                       std::vector<DocId>& out)
+        {
+            if (firstSize > secondSize)
+            {
+                std::swap(first, second);
+                std::swap(firstSize, secondSize);
+            }
+            if (firstSize == 0)
+            {
+                return;
+            }
+            if (firstSize * GallopRatio < secondSize)
+            {
+                gallop(first, firstSize, second, secondSize, out);
+                return;
+            }
+
+            size_t i = 0;
+            size_t j = 0;
+#if defined(__SSE2__)
+            /**
+            * the block with the smaller last id is done after every comparison. Ids are unique, so every
+            * match is found exactly once
+            */
+            while (i + 4 <= firstSize && j + 4 <= secondSize)
+            {
+                for (int mask = matchBlocks(first + i, second + j); mask != 0; mask &= mask - 1)
+                {
+                    out.push_back(first[i + __builtin_ctz(mask)]);
+                }
+                const DocId leftLast = first[i + 3];
+                const DocId rightLast = second[j + 3];
+                i += leftLast <= rightLast ? 4 : 0;
+                j += rightLast <= leftLast ? 4 : 0;
+            }
+#endif
+            while (i < firstSize && j < secondSize)
+            {
+                if (first[i] < second[j])
+                {
+                    i++;
+                }
+                else if (second[j] < first[i])
+                {
+                    j++;
+                }
+                else
+                {
+                    out.push_back(first[i]);
+                    i++;
+                    j++;
+                }
+            }
+        }
+
+        void unite(const DocId* first, size_t firstSize, const DocId* second, size_t secondSize,
+                   std::vector<DocId>& out)
+        {
+            /**
+            * The ids of one input up to the next id of the other are copied as a whole run. Runs are found
+            * by galloping when the sizes are far apart, interleaved ids are merged one at a time: a merge
+            * network needs unsigned 32-bit min and max, which SSE2 lacks
+            */
+            out.reserve(out.size() + firstSize + secondSize);
+            if (firstSize > secondSize)
+            {
+                std::swap(first, second);
+                std::swap(firstSize, secondSize);
+            }
+            if (firstSize * GallopRatio < secondSize)
+            {
+                size_t lo = 0;
+                for (size_t i = 0; i < firstSize; i++)
+                {
+                    const size_t hi = seek(second, secondSize, lo, first[i]);
+                    out.insert(out.end(), second + lo, second + hi);
+                    out.push_back(first[i]);
+                    lo = hi < secondSize && second[hi] == first[i] ? hi + 1 : hi;
+                }
+                out.insert(out.end(), second + lo, second + secondSize);
+                return;
+            }
+
+            size_t i = 0;
+            size_t j = 0;
+            while (i < firstSize && j < secondSize)
+            {
+                if (first[i] < second[j])
+                {
+                    out.push_back(first[i++]);
+                }
+                else if (second[j] < first[i])
+                {
+                    out.push_back(second[j++]);
+                }
+                else
+                {
+                    out.push_back(first[i]);
+                    i++;
+                    j++;
+                }
+            }
+            out.insert(out.end(), first + i, first + firstSize);
+            out.insert(out.end(), second + j, second + secondSize);
+        }
+
+        void subtract(const DocId* first, size_t firstSize, const DocId* second, size_t secondSize,
+                      std::vector<DocId>& out)
+        {
+            /**
+            * a small first probes second by galloping, a small second cuts first into runs copied whole.
+            * Otherwise blocks are compared four by four like in intersect, a block of first is emitted
+            * without its matches once no block of second can match it anymore
+            */
+            if (firstSize * GallopRatio < secondSize)
+            {
+                size_t lo = 0;
+                for (size_t i = 0; i < firstSize; i++)
+                {
+                    lo = seek(second, secondSize, lo, first[i]);
+                    if (lo == secondSize || second[lo] != first[i])
+                    {
+                        out.push_back(first[i]);
+                    }
+                }
+                return;
+            }
+            if (secondSize * GallopRatio < firstSize)
+            {
+                size_t lo = 0;
+                for (size_t j = 0; j < secondSize && lo < firstSize; j++)
+                {
+                    const size_t hi = seek(first, firstSize, lo, second[j]);
+                    out.insert(out.end(), first + lo, first + hi);
+                    lo = hi < firstSize && first[hi] == second[j] ? hi + 1 : hi;
+                }
+                out.insert(out.end(), first + lo, first + firstSize);
+                return;
+            }
+
+            size_t i = 0;
+            size_t j = 0;
+            /**
+            * bit k is set if first[i + k] has been matched already
+            */
+            int matched = 0;
+#if defined(__SSE2__)
+            while (i + 4 <= firstSize && j + 4 <= secondSize)
+            {
+                matched |= matchBlocks(first + i, second + j);
+                const DocId leftLast = first[i + 3];
+                const DocId rightLast = second[j + 3];
+                if (leftLast <= rightLast)
+                {
+                    for (int k = 0; k < 4; k++)
+                    {
+                        if (!(matched >> k & 1))
+                        {
+                            out.push_back(first[i + k]);
+                        }
+                    }
+                    i += 4;
+                    matched = 0;
+                }
+                j += rightLast <= leftLast ? 4 : 0;
+            }
+#endif
+            for (; i < firstSize; i++, matched >>= 1)
+            {
+                while (j < secondSize && second[j] < first[i])
+                {
+                    j++;
+                }
+                if (!(matched & 1) && (j == secondSize || second[j] != first[i]))
+                {
+                    out.push_back(first[i]);
+                }
+            }
+        }
+
+        Evaluator::Evaluator(const Query& query, const Segment& segment, const std::vector<DocId>& universe)
+            : m_query(query)
+            , m_segment(&segment)
+            , m_universe(universe)
+        {
+            for (const auto& token: query.tokens)
+            {
+                uint32_t termIdx;
+                m_termIdxs.push_back(segment.find(token, termIdx) ? std::optional<uint32_t>(termIdx) : std::nullopt);
+            }
+        }
+
+        Evaluator::Evaluator(const Query& query, const std::vector<const PostingList*>& postings,
+                             const std::vector<DocId>& universe)
+            : m_query(query)
+            , m_segment(nullptr)
+            , m_universe(universe)
+            , m_postings(postings)
+        {
+        }
+
+        std::vector<DocId> Evaluator::match() const
+        {
+            /**
+            * an empty expression, e.g. (), matches nothing rather than the universe
+            */
+            const Node& root = m_query.root;
+            if ((root.type == Node::Type::And || root.type == Node::Type::Or) && root.children.empty())
+            {
+                return {};
+            }
+            return docs(root);
+        }
+
+        bool Evaluator::holds(size_t token) const
+        {
+            return m_segment ? m_termIdxs[token].has_value() : m_postings[token] != nullptr;
+        }
+
+        size_t Evaluator::docCount(size_t token) const
+        {
+            /**
+            * the posting count of a list bounds its document count, which is estimate enough for costs
+            */
+            if (!holds(token))
+            {
+                return 0;
+            }
+            return m_segment ? m_segment->docCount(*m_termIdxs[token]) : m_postings[token]->size();
+        }
+
+        void Evaluator::termDocs(size_t token, std::vector<DocId>& out) const
+        {
+            if (!holds(token))
+            {
+                return;
+            }
+            if (m_segment)
+            {
+                const DocId* termDocs = m_segment->termDocs(*m_termIdxs[token]);
+                out.insert(out.end(), termDocs, termDocs + m_segment->docCount(*m_termIdxs[token]));
+                return;
+            }
+            m_postings[token]->forEachDoc([&out](DocId docId, size_t) {
+                out.push_back(docId);
+            });
+        }
+
+        void Evaluator::intersectTerm(size_t token, const std::vector<DocId>& docs, std::vector<DocId>& out) const
+        {
+            /**
+            * a posting list is not contiguous, its cursor gallops to every document of docs instead
+            */
+            if (!holds(token))
+            {
+                return;
+            }
+            if (m_segment)
+            {
+                const uint32_t termIdx = *m_termIdxs[token];
+                intersect(docs.data(), docs.size(), m_segment->termDocs(termIdx), m_segment->docCount(termIdx), out);
+                return;
+            }
+            PostingList::Cursor cursor(*m_postings[token]);
+            for (DocId doc: docs)
+            {
+                cursor.nextGEQ(doc);
+                if (!cursor.isValid())
+                {
+                    return;
+                }
+                if (cursor.doc() == doc)
+                {
+                    out.push_back(doc);
+                }
+            }
+        }
+
+        template<typename Callback>
+        void Evaluator::withCursors(const Node& leaf, Callback&& callback) const
+        {
+            for (size_t t = leaf.begin; t < leaf.end; t++)
+            {
+                if (!holds(t))
+                {
+                    return;
+                }
+            }
+            if (m_segment)
+            {
+                std::vector<Segment::Cursor> cursors;
+                for (size_t t = leaf.begin; t < leaf.end; t++)
+                {
+                    cursors.emplace_back(*m_segment, *m_termIdxs[t]);
+                }
+                callback(cursors);
+                return;
+            }
+            std::vector<PostingList::Cursor> cursors;
+            for (size_t t = leaf.begin; t < leaf.end; t++)
+            {
+                cursors.emplace_back(*m_postings[t]);
+            }
+            callback(cursors);
+        }
+
+        size_t Evaluator::cost(const Node& node) const
+        {
+            switch (node.type)
+            {
+                case Node::Type::Term:
+                case Node::Type::Phrase:
+                {
+                    size_t res = m_universe.size();
+                    for (size_t t = node.begin; t < node.end; t++)
+                    {
+                        res = std::min(res, docCount(t));
+                    }
+                    return res;
+                }
+                case Node::Type::And:
+                {
+                    size_t res = m_universe.size();
+                    for (const auto& child: node.children)
+                    {
+                        if (child.type != Node::Type::Not)
+                        {
+                            res = std::min(res, cost(child));
+                        }
+                    }
+                    return res;
+                }
+                case Node::Type::Or:
+                {
+                    size_t res = 0;
+                    for (const auto& child: node.children)
+                    {
+                        res += cost(child);
+                    }
+                    return std::min(res, m_universe.size());
+                }
+                case Node::Type::Not:
+                    return m_universe.size();
+            }
+            return m_universe.size();
+        }
+
+        std::vector<DocId> Evaluator::docs(const Node& node) const
+        {
+            std::vector<DocId> res;
+            std::vector<DocId> next;
+            switch (node.type)
+            {
+                case Node::Type::Term:
+                {
+                    termDocs(node.begin, res);
+                    return res;
+                }
+                case Node::Type::Phrase:
+                {
+                    std::vector<size_t> tokens;
+                    for (size_t t = node.begin; t < node.end; t++)
+                    {
+                        if (!holds(t))
+                        {
+                            return res;
+                        }
+                        tokens.push_back(t);
+                    }
+                    std::sort(tokens.begin(), tokens.end(), [this](size_t first, size_t second) {
+                        return docCount(first) < docCount(second);
+                    });
+                    termDocs(tokens[0], res);
+                    for (size_t i = 1; i < tokens.size() && !res.empty(); i++)
+                    {
+                        next.clear();
+                        intersectTerm(tokens[i], res, next);
+                        res.swap(next);
+                    }
+                    filterPhrase(node, res);
+                    return res;
+                }
+                case Node::Type::And:
+                {
+                    std::vector<const Node*> children;
+                    for (const auto& child: node.children)
+                    {
+                        children.push_back(&child);
+                    }
+                    std::stable_sort(children.begin(), children.end(), [this](const Node* first, const Node* second) {
+                        const bool isFirstNot = first->type == Node::Type::Not;
+                        const bool isSecondNot = second->type == Node::Type::Not;
+                        return isFirstNot != isSecondNot ? isSecondNot : !isFirstNot && cost(*first) < cost(*second);
+                    });
+
+                    auto child = children.begin();
+                    if (child == children.end() || (*child)->type == Node::Type::Not)
+                    {
+                        res = m_universe;
+                    }
+                    else
+                    {
+                        res = docs(**child++);
+                    }
+                    for (; child != children.end() && !res.empty(); ++child)
+                    {
+                        const Node& operand = **child;
+                        next.clear();
+                        if (operand.type == Node::Type::Phrase)
+                        {
+                            filterPhrase(operand, res);
+                            continue;
+                        }
+                        if (operand.type == Node::Type::Not)
+                        {
+                            const std::vector<DocId> excluded = docs(operand.children.front());
+                            subtract(res.data(), res.size(), excluded.data(), excluded.size(), next);
+                        }
+                        else if (operand.type == Node::Type::Term)
+                        {
+                            intersectTerm(operand.begin, res, next);
+                        }
+                        else
+                        {
+                            const std::vector<DocId> other = docs(operand);
+                            intersect(res.data(), res.size(), other.data(), other.size(), next);
+                        }
+                        res.swap(next);
+                    }
+                    return res;
+                }
+                case Node::Type::Or:
+                {
+                    for (const auto& child: node.children)
+                    {
+                        const std::vector<DocId> other = docs(child);
+                        next.clear();
+                        unite(res.data(), res.size(), other.data(), other.size(), next);
+                        res.swap(next);
+                    }
+                    return res;
+                }
+                case Node::Type::Not:
+                {
+                    const std::vector<DocId> excluded = docs(node.children.front());
+                    subtract(m_universe.data(), m_universe.size(), excluded.data(), excluded.size(), res);
+                    return res;
+                }
+            }
+            return res;
+        }
+
+        void Evaluator::filterPhrase(const Node& phrase, std::vector<DocId>& docs) const
+        {
+            /**
+            * keeps the documents the phrase occurs in, cursors only move forward as docs are ascending
+            */
+            size_t kept = 0;
+            withCursors(phrase, [&docs, &phrase, &kept](auto& cursors) {
+                std::vector<ranking::PositionRange> ranges;
+                for (DocId doc: docs)
+                {
+                    ranges.clear();
+                    for (auto& cursor: cursors)
+                    {
+                        cursor.nextGEQ(doc);
+                        if (!cursor.isValid() || cursor.doc() != doc)
+                        {
+                            break;
+                        }
+                        ranges.emplace_back(cursor.positions(), cursor.positions() + cursor.termFreq());
+                    }
+                    if (ranges.size() == cursors.size() && ranking::phraseFreq(ranges, phrase.slop) > 0)
+                    {
+                        docs[kept++] = doc;
+                    }
+                }
+            });
+            docs.resize(kept);
+        }
+
+        void Evaluator::positiveLeaves(const Node& node, std::vector<const Node*>& leaves) const
+        {
+            if (node.type == Node::Type::Term || node.type == Node::Type::Phrase)
+            {
+                leaves.push_back(&node);
+            }
+            else if (node.type != Node::Type::Not)
+            {
+                for (const auto& child: node.children)
+                {
+                    positiveLeaves(child, leaves);
+                }
+            }
+        }
+
+        void Evaluator::rank(const std::vector<DocId>& docs, const std::vector<float>& idfs, const ranking::Bm25& bm25,
+                             const DocTrace& docTrace, ranking::TopDocs& top) const
+        {
+            std::vector<float> scores(docs.size(), 0.0f);
+            std::vector<const Node*> leaves;
+            positiveLeaves(m_query.root, leaves);
+
+            std::vector<ranking::PositionRange> ranges;
+            for (const Node* leaf: leaves)
+            {
+                float idf = 0;
+                for (size_t t = leaf->begin; t < leaf->end; t++)
+                {
+                    idf += idfs[t];
+                }
+                if (idf <= 0)
+                {
+                    continue;
+                }
+
+                withCursors(*leaf, [&](auto& cursors) {
+                    for (size_t i = 0; i < docs.size(); i++)
+                    {
+                        ranges.clear();
+                        for (auto& cursor: cursors)
+                        {
+                            cursor.nextGEQ(docs[i]);
+                            if (!cursor.isValid() || cursor.doc() != docs[i])
+                            {
+                                break;
+                            }
+                            ranges.emplace_back(cursor.positions(), cursor.positions() + cursor.termFreq());
+                        }
+                        if (ranges.size() != cursors.size())
+                        {
+                            continue;
+                        }
+                        const size_t freq = leaf->type == Node::Type::Term ? cursors.front().termFreq()
+                                                                           : ranking::phraseFreq(ranges, leaf->slop);
+                        if (freq > 0)
+                        {
+                            scores[i] += bm25.score(idf, freq, docTrace.getTokenCount(docs[i]));
+                        }
+                    }
+                });
+            }
+            for (size_t i = 0; i < docs.size(); i++)
+            {
+                top.push(docs[i], scores[i]);
+            }
+        }
+    }
+}
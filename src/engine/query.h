@@ -0,0 +1,133 @@
+#pragma once
+
+#include "ranking.h"
+#include "postings.h"
+#include <functional>
+#include <optional>
+
+namespace core
+{
+    namespace query
+    {
+        struct Node
+        {
+            /**
+            * Term and Phrase nodes refer to the query tokens [begin, end), a phrase matches them in this order
+            * with at most slop other tokens in between altogether. And, Or and Not combine their children,
+            * Not has exactly one
+            */
+            enum class Type
+            {
+                Term,
+                Phrase,
+                And,
+                Or,
+                Not,
+            };
+
+            Type type;
+            size_t begin{0};
+            size_t end{0};
+            size_t slop{0};
+            std::vector<Node> children{};
+        };
+
+        struct Query
+        {
+            /**
+            * Queries are boolean expressions over tokens and quoted phrases, e.g. a AND (b OR "c d") NOT e.
+            * Operators are upper case, operands next to each other are joined by AND, NOT binds tightest
+            * and OR loosest. A query without quotes, parentheses and operators is a bag of words, i.e.
+            * an Or of its tokens, which is ranked without being matched first.
+            * tokens lists the tokens of the query in order of appearance, operators excluded
+            */
+            std::vector<std::string> tokens;
+            Node root;
+            bool isBagOfWords{true};
+        };
+
+        /**
+        * expand a wildcard pattern and a misspelled token respectively into the tokens they match
+        */
+        using Expander = std::function<std::vector<std::string>(const std::string& pattern)>;
+        using FuzzyExpander = std::function<std::vector<std::string>(const std::string& token, size_t maxEdits)>;
+
+        /**
+        * The parser is lenient, unbalanced parentheses and operators missing an operand are dropped.
+        * Given expanders, a word with wildcards outside of quotes, e.g. appl*, and a word followed by ~,
+        * e.g. aple~1, turn into an Or of the tokens they expand to. A word expanding to nothing stays
+        * a token that matches no document
+        */
+        Query parse(const std::string& query, bool toLowercase, const Expander& expand = nullptr,
+                    const FuzzyExpander& fuzzyExpand = nullptr, bool toNfc = false);
+
+        /**
+        * Sorted set operations over strictly ascending DocIds, the result is appended to out. They gallop
+        * through the larger input when the sizes are far apart. Otherwise intersection and difference compare
+        * blocks of four ids at a time with SSE2, union merges one id at a time
+        */
+        void intersect(const DocId* first, size_t firstSize, const DocId* second, size_t secondSize,
+                       std::vector<DocId>& out);
+        void unite(const DocId* first, size_t firstSize, const DocId* second, size_t secondSize,
+                   std::vector<DocId>& out);
+        void subtract(const DocId* first, size_t firstSize, const DocId* second, size_t secondSize,
+                      std::vector<DocId>& out);
+
+        class Evaluator
+        {
+            /**
+            * Evaluator matches a query against a single segment, or against the posting lists of the query
+            * tokens, which is how the unordered in-memory buffers are read. Children of And are evaluated
+            * cheapest first, the cost of a node being an estimate of its result size read off posting lengths,
+            * so the running intersection only shrinks and Not children are subtracted from it last.
+            * Phrases are checked on positions only for documents holding all their terms. universe lists
+            * every document searched, Not is taken relative to it
+            */
+        public:
+            Evaluator(const Query& query, const Segment& segment, const std::vector<DocId>& universe);
+            /**
+            * postings[t] holds the postings of the t-th query token, null if no document holds it
+            */
+            Evaluator(const Query& query, const std::vector<const PostingList*>& postings,
+                      const std::vector<DocId>& universe);
+            std::vector<DocId> match() const;
+            /**
+            * Scores docs, a subset of match(), with BM25: every term and phrase of the query not under Not
+            * adds to the score of the documents holding it, a phrase weighs as much as a term with the
+            * summed idf of its tokens occurring phrase frequency times
+            */
+            void rank(const std::vector<DocId>& docs, const std::vector<float>& idfs, const ranking::Bm25& bm25,
+                      const DocTrace& docTrace, ranking::TopDocs& top) const;
+
+        private:
+            std::vector<DocId> docs(const Node& node) const;
+            size_t cost(const Node& node) const;
+            void filterPhrase(const Node& phrase, std::vector<DocId>& docs) const;
+            void positiveLeaves(const Node& node, std::vector<const Node*>& leaves) const;
+            bool holds(size_t token) const;
+            size_t docCount(size_t token) const;
+            void termDocs(size_t token, std::vector<DocId>& out) const;
+            void intersectTerm(size_t token, const std::vector<DocId>& docs, std::vector<DocId>& out) const;
+            /**
+            * calls callback(cursors) with a cursor over every token of the leaf, unless some of them is not held
+            */
+            template<typename Callback>
+            void withCursors(const Node& leaf, Callback&& callback) const;
+
+        private:
+            const Query& m_query;
+            const Segment* m_segment;
+            const std::vector<DocId>& m_universe;
+            /**
+            * the term index of every query token within the segment, if the segment holds it
+            */
+            std::vector<std::optional<uint32_t>> m_termIdxs;
+            std::vector<const PostingList*> m_postings;
+        };
+
+        /**
+        * tokens every match has to hold, i.e. terms reachable from the root through And nodes only
+        */
+        std::vector<size_t> requiredTokens(const Query& query);
+    }
+}
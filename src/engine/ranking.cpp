@@ -0,0 +1,268 @@
+#include "ranking.h"
+#include "paging.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace core
+{
+    namespace ranking
+    {
+        bool isRankedBefore(const ScoredDoc& first, const ScoredDoc& second)
+        {
+            return first.second > second.second || (first.second == second.second && first.first < second.first);
+        }
+
+        std::string encodeCursor(const ScoredDoc& doc)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &doc.second, sizeof(bits));
+            return paging::encode(bits, doc.first);
+        }
+
+        bool decodeCursor(const std::string& cursor, ScoredDoc& doc)
+        {
+            uint64_t bits;
+            uint64_t docId;
+            if (!paging::decode(cursor, bits, docId) || bits > UINT32_MAX || docId > UINT32_MAX)
+            {
+                return false;
+            }
+            const uint32_t scoreBits = bits;
+            doc.first = docId;
+            std::memcpy(&doc.second, &scoreBits, sizeof(scoreBits));
+            return true;
+        }
+
+        TopDocs::TopDocs(size_t k, const std::optional<ScoredDoc>& after)
+            : m_k(k)
+            , m_after(after)
+        {
+            m_heap.reserve(k);
+        }
+
+        float TopDocs::threshold() const
+        {
+            return m_heap.size() < m_k || m_heap.empty() ? -std::numeric_limits<float>::infinity()
+                                                         : m_heap.front().second;
+        }
+
+        void TopDocs::push(DocId docId, float score)
+        {
+            if (m_k == 0 || (m_after && !isRankedBefore(*m_after, {docId, score})))
+            {
+                return;
+            }
+            if (m_heap.size() < m_k)
+            {
+                m_heap.emplace_back(docId, score);
+                std::push_heap(m_heap.begin(), m_heap.end(), isRankedBefore);
+                return;
+            }
+            if (isRankedBefore({docId, score}, m_heap.front()))
+            {
+                std::pop_heap(m_heap.begin(), m_heap.end(), isRankedBefore);
+                m_heap.back() = {docId, score};
+                std::push_heap(m_heap.begin(), m_heap.end(), isRankedBefore);
+            }
+        }
+
+        ScoredDocs TopDocs::sorted() const
+        {
+            ScoredDocs docs = m_heap;
+            std::sort(docs.begin(), docs.end(), isRankedBefore);
+            return docs;
+        }
+
+        void Accumulator::clear()
+        {
+            for (size_t slot: m_touched)
+            {
+                m_scores[slot] = 0.0f;
+            }
+            m_touched.clear();
+        }
+
+        static std::vector<std::unique_ptr<Accumulator>>& accumulatorPool()
+        {
+            thread_local std::vector<std::unique_ptr<Accumulator>> pool;
+            return pool;
+        }
+
+        Accumulator::Lease::Lease()
+        {
+            auto& pool = accumulatorPool();
+            if (pool.empty())
+            {
+                m_accumulator = std::make_unique<Accumulator>();
+            }
+            else
+            {
+                m_accumulator = std::move(pool.back());
+                pool.pop_back();
+            }
+        }
+
+        Accumulator::Lease::~Lease()
+        {
+            m_accumulator->clear();
+            accumulatorPool().push_back(std::move(m_accumulator));
+        }
+
+        Accumulator& Accumulator::Lease::operator*() const
+        {
+            return *m_accumulator;
+        }
+
+        Accumulator* Accumulator::Lease::operator->() const
+        {
+            return m_accumulator.get();
+        }
+
+        void blockMaxWand(std::vector<TermCursor>& terms, const Bm25& bm25, const DocTrace& docTrace, TopDocs& top)
+        {
+            /**
+            * Cursors are kept ordered by their current document. The pivot is the first document at which
+            * the summed maximum weights of the terms up to it can beat the threshold, no document before it
+            * can enter top. The block maxima of those terms at the pivot refine the bound: if it still holds
+            * and all of them sit on the pivot, the pivot is scored, otherwise the lagging terms are moved
+            * to the pivot or past the blocks that cannot reach the threshold
+            */
+            static constexpr DocId NoDoc = std::numeric_limits<DocId>::max();
+            std::vector<TermCursor*> cursors;
+            for (auto& term: terms)
+            {
+                cursors.push_back(&term);
+            }
+            auto byDoc = [](const TermCursor* first, const TermCursor* second) {
+                return first->cursor.doc() < second->cursor.doc();
+            };
+            auto heaviest = [&cursors](size_t end) {
+                size_t best = 0;
+                for (size_t i = 1; i < end; i++)
+                {
+                    if (cursors[i]->maxScore > cursors[best]->maxScore)
+                    {
+                        best = i;
+                    }
+                }
+                return cursors[best];
+            };
+
+            while (true)
+            {
+                cursors.erase(std::remove_if(cursors.begin(), cursors.end(), [](const TermCursor* term) {
+                    return !term->cursor.isValid();
+                }), cursors.end());
+                std::sort(cursors.begin(), cursors.end(), byDoc);
+
+                const float threshold = top.threshold();
+                size_t pivot = 0;
+                float bound = 0;
+                for (; pivot < cursors.size(); pivot++)
+                {
+                    bound += cursors[pivot]->maxScore;
+                    if (bound > threshold)
+                    {
+                        break;
+                    }
+                }
+                if (pivot == cursors.size())
+                {
+                    return;
+                }
+
+                const DocId pivotDoc = cursors[pivot]->cursor.doc();
+                while (pivot + 1 < cursors.size() && cursors[pivot + 1]->cursor.doc() == pivotDoc)
+                {
+                    pivot++;
+                }
+
+                float blockBound = 0;
+                for (size_t i = 0; i <= pivot; i++)
+                {
+                    cursors[i]->cursor.shallowNextGEQ(pivotDoc);
+                    blockBound += bm25.bound(cursors[i]->idf, cursors[i]->cursor.block());
+                }
+
+                if (blockBound > threshold)
+                {
+                    if (cursors[0]->cursor.doc() == pivotDoc)
+                    {
+                        if (docTrace.isAlive(pivotDoc))
+                        {
+                            const size_t docLength = docTrace.getTokenCount(pivotDoc);
+                            float score = 0;
+                            for (size_t i = 0; i <= pivot; i++)
+                            {
+                                score += bm25.score(cursors[i]->idf, cursors[i]->cursor.termFreq(), docLength);
+                            }
+                            top.push(pivotDoc, score);
+                        }
+                        for (size_t i = 0; i <= pivot; i++)
+                        {
+                            cursors[i]->cursor.next();
+                        }
+                    }
+                    else
+                    {
+                        size_t lagging = 0;
+                        while (cursors[lagging]->cursor.doc() < pivotDoc)
+                        {
+                            lagging++;
+                        }
+                        heaviest(lagging)->cursor.nextGEQ(pivotDoc);
+                    }
+                    continue;
+                }
+
+                /**
+                * no document before the end of the nearest block can enter top
+                */
+                DocId next = pivot + 1 < cursors.size() ? cursors[pivot + 1]->cursor.doc() : NoDoc;
+                for (size_t i = 0; i <= pivot; i++)
+                {
+                    const DocId lastDoc = cursors[i]->cursor.block().lastDoc;
+                    if (lastDoc != NoDoc)
+                    {
+                        next = std::min<DocId>(next, lastDoc + 1);
+                    }
+                }
+                heaviest(pivot + 1)->cursor.nextGEQ(next);
+            }
+        }
+
+        size_t phraseFreq(std::vector<PositionRange>& terms, size_t slop)
+        {
+            /**
+            * Every occurrence of the first term is extended greedily by the nearest following occurrence
+            * of each next term, which yields the shortest span starting there. Those nearest occurrences
+            * only move forward with the start, so every range is walked once
+            */
+            const size_t gaps = terms.size() - 1;
+            size_t freq = 0;
+            for (const size_t* start = terms[0].first; start != terms[0].second; ++start)
+            {
+                size_t prev = position::ordinal(*start);
+                for (size_t i = 1; i < terms.size(); i++)
+                {
+                    auto& [it, end] = terms[i];
+                    while (it != end && position::ordinal(*it) <= prev)
+                    {
+                        ++it;
+                    }
+                    if (it == end)
+                    {
+                        return freq;
+                    }
+                    prev = position::ordinal(*it);
+                }
+                if (prev - position::ordinal(*start) - gaps <= slop)
+                {
+                    freq++;
+                }
+            }
+            return freq;
+        }
+    }
+}
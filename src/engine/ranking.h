@@ -0,0 +1,181 @@
+#pragma once
+
+#include "segment.h"
+#include <algorithm>
+#include <optional>
+#include <string_view>
+
+namespace core
+{
+    namespace ranking
+    {
+        inline bool docRankCompare(const std::pair<std::string_view, float>& first,
+                                   const std::pair<std::string_view, float>& second)
+        {
+            return first.second > second.second;
+        }
+
+        using RankedDocs = std::vector<std::pair<std::string, float>>;
+        using ScoredDoc = std::pair<DocId, float>;
+        using ScoredDocs = std::vector<ScoredDoc>;
+
+        /**
+        * documents are ranked by score, equal scores by DocId, which makes the ranking a total order
+        */
+        bool isRankedBefore(const ScoredDoc& first, const ScoredDoc& second);
+
+        struct Page
+        {
+            /**
+            * at most limit documents ranked right after after, the first page has no after
+            */
+            size_t limit{20};
+            std::optional<ScoredDoc> after;
+        };
+
+        std::string encodeCursor(const ScoredDoc& doc);
+        bool decodeCursor(const std::string& cursor, ScoredDoc& doc);
+
+        struct QueryStats
+        {
+            /**
+            * docFreqs[i] is the number of documents containing tokens[i] out of docCount documents,
+            * which hold totalTokens tokens together
+            */
+            std::vector<std::string> tokens;
+            std::vector<size_t> docFreqs;
+            size_t docCount{0};
+            size_t totalTokens{0};
+        };
+
+        struct Bm25
+        {
+            /**
+            * Okapi BM25 term weight. It grows with termFreq and shrinks with docLength, so the weight of the
+            * largest term frequency and the shortest document of a block bounds every document of the block
+            */
+            float k1;
+            float b;
+            float avgDocLength;
+
+            float score(float idf, size_t termFreq, size_t docLength) const
+            {
+                const float norm = avgDocLength > 0 ? docLength / avgDocLength : 1.0f;
+                const float tf = termFreq;
+                return idf * tf * (k1 + 1) / (tf + k1 * (1 - b + b * norm));
+            }
+
+            float bound(float idf, const Segment::BlockMax& block) const
+            {
+                return score(idf, block.maxTermFreq, block.minDocLength);
+            }
+        };
+
+        class TopDocs
+        {
+            /**
+            * TopDocs keeps the k best ranked documents in a min-heap, the result does not depend on the order
+            * documents are offered in. Documents not ranked after after are ignored, which yields the
+            * following page of a ranking without keeping its preceding pages
+            */
+        public:
+            explicit TopDocs(size_t k, const std::optional<ScoredDoc>& after = std::nullopt);
+            /**
+            * a document has to score above the threshold to enter a full heap
+            */
+            float threshold() const;
+            void push(DocId docId, float score);
+            ScoredDocs sorted() const;
+
+        private:
+            const size_t m_k;
+            const std::optional<ScoredDoc> m_after;
+            ScoredDocs m_heap;
+        };
+
+        class Accumulator
+        {
+            /**
+            * Accumulator sums the partial scores of documents in a dense array indexed by slot and is used
+            * by a single thread, so adding a score takes neither a lock nor an allocation once the array
+            * has grown to the slot count. Only touched slots are visited and cleared, so an accumulator is
+            * cheap to reuse across queries. Scores are expected to be positive
+            */
+        public:
+            class Lease
+            {
+                /**
+                * borrows a cleared accumulator from the pool of the calling thread and returns it cleared
+                */
+            public:
+                Lease();
+                ~Lease();
+                Lease(const Lease& other) = delete;
+                Lease& operator=(const Lease& other) = delete;
+                Accumulator& operator*() const;
+                Accumulator* operator->() const;
+
+            private:
+                std::unique_ptr<Accumulator> m_accumulator;
+            };
+
+            void add(size_t slot, float score)
+            {
+                if (slot >= m_scores.size())
+                {
+                    m_scores.resize(std::max(slot + 1, m_scores.size() * 2), 0.0f);
+                }
+                if (m_scores[slot] == 0.0f)
+                {
+                    m_touched.push_back(slot);
+                }
+                m_scores[slot] += score;
+            }
+
+            template<typename Callback>
+            void forEach(Callback&& callback) const
+            {
+                /**
+                * calls callback(slot, score) for every touched slot
+                */
+                for (size_t slot: m_touched)
+                {
+                    callback(slot, m_scores[slot]);
+                }
+            }
+
+            void clear();
+
+        private:
+            std::vector<float> m_scores;
+            std::vector<size_t> m_touched;
+        };
+
+        struct TermCursor
+        {
+            Segment::Cursor cursor;
+            float idf;
+            /**
+            * the largest weight the term contributes to any document of the segment
+            */
+            float maxScore;
+        };
+
+        /**
+        * Block-Max WAND over the cursors of one segment, documents that may enter top are fully scored,
+        * the rest are skipped a block at a time. Deleted documents are never scored
+        */
+        void blockMaxWand(std::vector<TermCursor>& terms, const Bm25& bm25, const DocTrace& docTrace, TopDocs& top);
+
+        /**
+        * [first, second) positions of a term within a document
+        */
+        using PositionRange = std::pair<const size_t*, const size_t*>;
+
+        /**
+        * the number of occurrences of a phrase, given the positions of its terms in phrase order. Ranges are
+        * consumed along the way
+        */
+        size_t phraseFreq(std::vector<PositionRange>& terms, size_t slop);
+    }
+}
@@ -0,0 +1,62 @@
+#include "replication_log.h"
+#include <algorithm>
+#include <chrono>
+
+namespace core
+{
+    ReplicationLog::ReplicationLog(size_t capacity)
+        : m_capacity(capacity)
+        , m_epoch(std::chrono::system_clock::now().time_since_epoch().count())
+    {
+    }
+
+    bool ReplicationLog::isEnabled() const
+    {
+        return m_capacity > 0;
+    }
+
+    uint64_t ReplicationLog::append(std::string&& mutation)
+    {
+        std::unique_lock lock(m_mtx);
+        m_size += mutation.size();
+        m_entries.push_back(std::move(mutation));
+        /**
+        * the latest mutation is kept even if it exceeds the capacity on its own
+        */
+        while (m_size > m_capacity && m_entries.size() > 1)
+        {
+            m_size -= m_entries.front().size();
+            m_entries.pop_front();
+            m_firstSeq++;
+        }
+        return ++m_lastSeq;
+    }
+
+    std::vector<std::string> ReplicationLog::since(uint64_t seq, size_t limit, bool& truncated) const
+    {
+        /**
+        * returns up to limit mutations following seq
+        */
+        std::unique_lock lock(m_mtx);
+        truncated = seq + 1 < m_firstSeq || seq > m_lastSeq;
+        if (truncated || seq == m_lastSeq)
+        {
+            return {};
+        }
+
+        const size_t offset = seq + 1 - m_firstSeq;
+        const size_t count = std::min<size_t>(limit, m_entries.size() - offset);
+        return {m_entries.begin() + offset, m_entries.begin() + offset + count};
+    }
+
+    uint64_t ReplicationLog::lastSeq() const
+    {
+        std::unique_lock lock(m_mtx);
+        return m_lastSeq;
+    }
+
+    uint64_t ReplicationLog::epoch() const
+    {
+        return m_epoch;
+    }
+}
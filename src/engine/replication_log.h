@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace core
+{
+    class ReplicationLog
+    {
+        /**
+        * ReplicationLog keeps the most recent index mutations of a primary, serialized and numbered
+        * from 1 in the order they were applied. Replicas pull the mutations following the last one they
+        * have applied. The log holds at most capacity bytes, older mutations are dropped, and a replica
+        * falling behind the oldest retained mutation has to start over from a snapshot.
+        *
+        * The epoch identifies a run of the primary, sequence numbers start over when it restarts.
+        */
+    public:
+        explicit ReplicationLog(size_t capacity);
+        bool isEnabled() const;
+        uint64_t append(std::string&& mutation);
+        std::vector<std::string> since(uint64_t seq, size_t limit, bool& truncated) const;
+        uint64_t lastSeq() const;
+        uint64_t epoch() const;
+
+    private:
+        const size_t m_capacity;
+        const uint64_t m_epoch;
+        mutable std::mutex m_mtx;
+        std::deque<std::string> m_entries;
+        size_t m_size{0};
+        uint64_t m_firstSeq{1};
+        uint64_t m_lastSeq{0};
+    };
+
+    using ReplicationLogPtr = std::unique_ptr<ReplicationLog>;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "xxh64.h"
+#include <cstdint>
+#include <string_view>
+
+namespace core
+{
+    namespace routing
+    {
+        /**
+        * Documents are routed by the hash of their path twice: to a backend by the coordinator and to a
+        * shard by the engine of that backend. Each level hashes with a seed of its own. With a shared
+        * hash, a backend would only receive paths with hash = b (mod backendCount), which reach just
+        * shardCount / gcd(backendCount, shardCount) of its shards
+        */
+        inline constexpr uint64_t ShardSeed = 0;
+        inline constexpr uint64_t BackendSeed = 0x9e3779b97f4a7c15;
+
+        inline size_t shard(std::string_view path, size_t shardCount)
+        {
+            return xxh64::hash(path.data(), path.size(), ShardSeed) % shardCount;
+        }
+
+        inline size_t backend(std::string_view path, size_t backendCount)
+        {
+            return xxh64::hash(path.data(), path.size(), BackendSeed) % backendCount;
+        }
+    }
+}
@@ -0,0 +1,250 @@
+#include "segment.h"
+#include <algorithm>
+#include <limits>
+
+namespace core
+{
+    Segment::Builder::Builder(const DocTrace* docTrace)
+        : m_docTrace(docTrace)
+        , m_segment(new Segment())
+    {
+    }
+
+    void Segment::Builder::add(std::string_view term, const std::vector<Posting>& postings)
+    {
+        if (postings.empty())
+        {
+            return;
+        }
+
+        Segment& segment = *m_segment;
+        segment.m_terms.emplace_back(term);
+        for (size_t i = 0; i < postings.size(); i++)
+        {
+            if (i == 0 || postings[i].first != postings[i - 1].first)
+            {
+                if (i != 0)
+                {
+                    segment.m_entryPositions.push_back(segment.m_positions.size());
+                }
+                segment.m_entryDocs.push_back(postings[i].first);
+                segment.m_docs.push_back(postings[i].first);
+            }
+            segment.m_positions.push_back(postings[i].second);
+        }
+        segment.m_entryPositions.push_back(segment.m_positions.size());
+
+        const uint32_t begin = segment.m_termEntries.back();
+        const uint32_t end = segment.m_entryDocs.size();
+        segment.m_termEntries.push_back(end);
+
+        BlockMax termMax{segment.m_entryDocs[end - 1], 0, std::numeric_limits<size_t>::max()};
+        for (uint32_t block = begin; block < end; block += BlockSize)
+        {
+            addBlock(block, std::min(block + BlockSize, end));
+            termMax.maxTermFreq = std::max(termMax.maxTermFreq, segment.m_blocks.back().maxTermFreq);
+            termMax.minDocLength = std::min(termMax.minDocLength, segment.m_blocks.back().minDocLength);
+        }
+        segment.m_termBlocks.push_back(segment.m_blocks.size());
+        segment.m_termMaxima.push_back(termMax);
+    }
+
+    void Segment::Builder::addBlock(uint32_t begin, uint32_t end)
+    {
+        Segment& segment = *m_segment;
+        BlockMax block{segment.m_entryDocs[end - 1], 0, std::numeric_limits<size_t>::max()};
+        for (uint32_t entry = begin; entry < end; entry++)
+        {
+            const size_t termFreq = segment.m_entryPositions[entry + 1] - segment.m_entryPositions[entry];
+            const size_t docLength = m_docTrace ? m_docTrace->getTokenCount(segment.m_entryDocs[entry]) : 0;
+            block.maxTermFreq = std::max(block.maxTermFreq, termFreq);
+            block.minDocLength = std::min(block.minDocLength, docLength);
+        }
+        segment.m_blocks.push_back(block);
+    }
+
+    size_t Segment::Builder::postingCount() const
+    {
+        return m_segment->m_positions.size();
+    }
+
+    std::shared_ptr<Segment> Segment::Builder::build()
+    {
+        Segment& segment = *m_segment;
+        std::sort(segment.m_docs.begin(), segment.m_docs.end());
+        segment.m_docs.erase(std::unique(segment.m_docs.begin(), segment.m_docs.end()), segment.m_docs.end());
+        segment.m_docs.shrink_to_fit();
+
+        const size_t words = segment.m_terms.size() / 64 + 1;
+        segment.m_erasedTerms = std::make_unique<std::atomic<uint64_t>[]>(words);
+
+        return std::shared_ptr<Segment>(m_segment.release());
+    }
+
+    bool Segment::find(std::string_view term, uint32_t& termIdx) const
+    {
+        auto it = std::lower_bound(m_terms.begin(), m_terms.end(), term);
+        if (it == m_terms.end() || *it != term)
+        {
+            return false;
+        }
+        termIdx = it - m_terms.begin();
+        return !isErased(termIdx);
+    }
+
+    bool Segment::eraseTerm(std::string_view term)
+    {
+        uint32_t termIdx;
+        if (!find(term, termIdx))
+        {
+            return false;
+        }
+        const uint64_t mask = uint64_t{1} << (termIdx % 64);
+        return !(m_erasedTerms[termIdx / 64].fetch_or(mask) & mask);
+    }
+
+    bool Segment::isErased(uint32_t termIdx) const
+    {
+        return m_erasedTerms[termIdx / 64].load(std::memory_order_acquire) & (uint64_t{1} << (termIdx % 64));
+    }
+
+    const std::string& Segment::term(uint32_t termIdx) const
+    {
+        return m_terms[termIdx];
+    }
+
+    size_t Segment::termCount() const
+    {
+        return m_terms.size();
+    }
+
+    size_t Segment::postingCount() const
+    {
+        return m_positions.size();
+    }
+
+    size_t Segment::postingCount(uint32_t termIdx) const
+    {
+        return m_entryPositions[m_termEntries[termIdx + 1]] - m_entryPositions[m_termEntries[termIdx]];
+    }
+
+    size_t Segment::docCount(uint32_t termIdx) const
+    {
+        return m_termEntries[termIdx + 1] - m_termEntries[termIdx];
+    }
+
+    const DocId* Segment::termDocs(uint32_t termIdx) const
+    {
+        return m_entryDocs.data() + m_termEntries[termIdx];
+    }
+
+    const std::vector<DocId>& Segment::docs() const
+    {
+        return m_docs;
+    }
+
+    Segment::Cursor::Cursor(const Segment& segment, uint32_t termIdx)
+        : m_segment(&segment)
+        , m_termIdx(termIdx)
+        , m_begin(segment.m_termEntries[termIdx])
+        , m_end(segment.m_termEntries[termIdx + 1])
+        , m_entry(m_begin)
+        , m_firstBlock(segment.m_termBlocks[termIdx])
+        , m_endBlock(segment.m_termBlocks[termIdx + 1])
+        , m_block(m_firstBlock)
+    {
+    }
+
+    bool Segment::Cursor::isValid() const
+    {
+        return m_entry < m_end;
+    }
+
+    DocId Segment::Cursor::doc() const
+    {
+        return m_segment->m_entryDocs[m_entry];
+    }
+
+    size_t Segment::Cursor::termFreq() const
+    {
+        return m_segment->m_entryPositions[m_entry + 1] - m_segment->m_entryPositions[m_entry];
+    }
+
+    const size_t* Segment::Cursor::positions() const
+    {
+        return m_segment->m_positions.data() + m_segment->m_entryPositions[m_entry];
+    }
+
+    uint32_t Segment::Cursor::blockOf(uint32_t entry) const
+    {
+        return m_firstBlock + (entry - m_begin) / BlockSize;
+    }
+
+    void Segment::Cursor::next()
+    {
+        if (++m_entry < m_end)
+        {
+            m_block = std::max(m_block, blockOf(m_entry));
+        }
+    }
+
+    void Segment::Cursor::shallowNextGEQ(DocId target)
+    {
+        const auto& blocks = m_segment->m_blocks;
+        if (m_block == m_endBlock || blocks[m_block].lastDoc >= target)
+        {
+            return;
+        }
+
+        /**
+        * blocks[m_block] ends before target, the step doubles until it overshoots, the last stride is
+        * then searched
+        */
+        uint32_t step = 1;
+        while (m_endBlock - m_block > step && blocks[m_block + step].lastDoc < target)
+        {
+            m_block += step;
+            step *= 2;
+        }
+        const auto last = blocks.begin() + std::min(m_block + step, m_endBlock);
+        m_block = std::lower_bound(blocks.begin() + m_block + 1, last, target, [](const BlockMax& block, DocId doc) {
+            return block.lastDoc < doc;
+        }) - blocks.begin();
+    }
+
+    void Segment::Cursor::nextGEQ(DocId target)
+    {
+        if (!isValid() || doc() >= target)
+        {
+            return;
+        }
+        shallowNextGEQ(target);
+        if (m_block == m_endBlock)
+        {
+            m_entry = m_end;
+            return;
+        }
+
+        /**
+        * the block holds a document not less than target, so the search never leaves it
+        */
+        const uint32_t blockBegin = m_begin + (m_block - m_firstBlock) * BlockSize;
+        const auto first = m_segment->m_entryDocs.begin() + std::max(m_entry, blockBegin);
+        const auto last = m_segment->m_entryDocs.begin() + std::min(blockBegin + BlockSize, m_end);
+        m_entry = std::lower_bound(first, last, target) - m_segment->m_entryDocs.begin();
+    }
+
+    const Segment::BlockMax& Segment::Cursor::block() const
+    {
+        /**
+        * past the last block no document of the term is left, nothing can score there
+        */
+        static const BlockMax Exhausted{std::numeric_limits<DocId>::max(), 0, std::numeric_limits<size_t>::max()};
+        return m_block < m_endBlock ? m_segment->m_blocks[m_block] : Exhausted;
+    }
+
+    const Segment::BlockMax& Segment::Cursor::termMax() const
+    {
+        return m_segment->m_termMaxima[m_termIdx];
+    }
+}
@@ -0,0 +1,216 @@
+#pragma once
+
+#include "doc_trace.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace core
+{
+    using Posting = std::pair<DocId, size_t>;
+
+    namespace position
+    {
+        /**
+        * A position packs the byte offset of a token within its document into the low OffsetBits bits and
+        * the ordinal of the token, i.e. the number of tokens preceding it, into the high bits. Ordinals grow
+        * with offsets, so positions order the same way offsets do. Documents past 64GiB or 256M tokens
+        * saturate the respective part
+        */
+        constexpr unsigned OffsetBits = 36;
+        constexpr size_t MaxOffset = (size_t{1} << OffsetBits) - 1;
+        constexpr size_t MaxOrdinal = (size_t{1} << (64 - OffsetBits)) - 1;
+
+        inline size_t pack(size_t offset, size_t ordinal)
+        {
+            return std::min(ordinal, MaxOrdinal) << OffsetBits | std::min(offset, MaxOffset);
+        }
+
+        inline size_t offset(size_t pos)
+        {
+            return pos & MaxOffset;
+        }
+
+        inline size_t ordinal(size_t pos)
+        {
+            return pos >> OffsetBits;
+        }
+    }
+
+    class Segment
+    {
+        /**
+        * Segment is an immutable, compact chunk of the index. Terms are kept in lexicographical order,
+        * every term owns a run of entries (one per document, ordered by DocId) and every entry owns a run
+        * of positions. Reads need no locking. The only mutable piece is the set of erased terms, which is
+        * kept in atomic words and dropped for good once the segment is merged.
+        *
+        * The entries of a term are also split into blocks of BlockSize entries, every block records its
+        * last DocId, the largest term frequency and the shortest document among its entries. Together they
+        * bound the score any document of the block can reach without visiting it.
+        */
+    public:
+        static constexpr uint32_t BlockSize = 64;
+
+        struct BlockMax
+        {
+            DocId lastDoc;
+            size_t maxTermFreq;
+            size_t minDocLength;
+        };
+
+        class Builder
+        {
+        public:
+            /**
+            * document lengths of block maxima are read off docTrace, without it they are assumed to be 0,
+            * which still yields valid, if looser, bounds
+            */
+            explicit Builder(const DocTrace* docTrace = nullptr);
+            /**
+            * terms must arrive in ascending order, postings must be sorted by (DocId, position)
+            */
+            void add(std::string_view term, const std::vector<Posting>& postings);
+            size_t postingCount() const;
+            std::shared_ptr<Segment> build();
+
+        private:
+            void addBlock(uint32_t begin, uint32_t end);
+
+        private:
+            const DocTrace* m_docTrace;
+            std::unique_ptr<Segment> m_segment;
+        };
+
+        class Cursor
+        {
+            /**
+            * Cursor walks the documents of a term in DocId order. Besides moving to a document, it can
+            * move only to the block holding a document (shallowNextGEQ), so that the block maxima can be
+            * checked before any entry of the block is touched. Targets are expected to be ascending and
+            * are reached by galloping over the blocks, so a rare term skips through a frequent one in
+            * logarithmic steps.
+            */
+        public:
+            Cursor(const Segment& segment, uint32_t termIdx);
+            bool isValid() const;
+            DocId doc() const;
+            size_t termFreq() const;
+            /**
+            * positions of the term in the current document, termFreq() of them in ascending order
+            */
+            const size_t* positions() const;
+            void next();
+            void nextGEQ(DocId target);
+            void shallowNextGEQ(DocId target);
+            const BlockMax& block() const;
+            const BlockMax& termMax() const;
+
+        private:
+            uint32_t blockOf(uint32_t entry) const;
+
+        private:
+            const Segment* m_segment;
+            uint32_t m_termIdx;
+            uint32_t m_begin;
+            uint32_t m_end;
+            uint32_t m_entry;
+            uint32_t m_firstBlock;
+            uint32_t m_endBlock;
+            uint32_t m_block;
+        };
+
+        bool find(std::string_view term, uint32_t& termIdx) const;
+        bool eraseTerm(std::string_view term);
+        bool isErased(uint32_t termIdx) const;
+        const std::string& term(uint32_t termIdx) const;
+        size_t termCount() const;
+        size_t postingCount() const;
+        size_t postingCount(uint32_t termIdx) const;
+        size_t docCount(uint32_t termIdx) const;
+        /**
+        * the documents holding the term in ascending order, docCount(termIdx) of them
+        */
+        const DocId* termDocs(uint32_t termIdx) const;
+        const std::vector<DocId>& docs() const;
+
+        template<typename Callback>
+        bool forEach(uint32_t termIdx, Callback&& callback) const
+        {
+            /**
+            * calls callback(docId, pos) for every posting of the term, stops early if the callback returns false
+            */
+            for (uint32_t entry = m_termEntries[termIdx]; entry < m_termEntries[termIdx + 1]; entry++)
+            {
+                const DocId docId = m_entryDocs[entry];
+                for (size_t i = m_entryPositions[entry]; i < m_entryPositions[entry + 1]; i++)
+                {
+                    if (!callback(docId, m_positions[i]))
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        template<typename Callback>
+        bool forEachFrom(uint32_t termIdx, DocId from, Callback&& callback) const
+        {
+            /**
+            * same as forEach, but starts at the first document not less than from
+            */
+            const auto first = m_entryDocs.begin() + m_termEntries[termIdx];
+            const auto last = m_entryDocs.begin() + m_termEntries[termIdx + 1];
+            for (uint32_t entry = std::lower_bound(first, last, from) - m_entryDocs.begin();
+                 entry < m_termEntries[termIdx + 1]; entry++)
+            {
+                const DocId docId = m_entryDocs[entry];
+                for (size_t i = m_entryPositions[entry]; i < m_entryPositions[entry + 1]; i++)
+                {
+                    if (!callback(docId, m_positions[i]))
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        template<typename Callback>
+        void forEachDoc(uint32_t termIdx, Callback&& callback) const
+        {
+            /**
+            * calls callback(docId, termFreq) for every document holding the term
+            */
+            for (uint32_t entry = m_termEntries[termIdx]; entry < m_termEntries[termIdx + 1]; entry++)
+            {
+                callback(m_entryDocs[entry], m_entryPositions[entry + 1] - m_entryPositions[entry]);
+            }
+        }
+
+    private:
+        Segment() = default;
+
+    private:
+        std::vector<std::string> m_terms;
+        std::vector<uint32_t> m_termEntries{0};
+        std::vector<DocId> m_entryDocs;
+        std::vector<size_t> m_entryPositions{0};
+        std::vector<size_t> m_positions;
+        std::vector<DocId> m_docs;
+        std::vector<uint32_t> m_termBlocks{0};
+        std::vector<BlockMax> m_blocks;
+        /**
+        * per-term maxima over all blocks of the term
+        */
+        std::vector<BlockMax> m_termMaxima;
+        std::unique_ptr<std::atomic<uint64_t>[]> m_erasedTerms;
+    };
+
+    using SegmentPtr = std::shared_ptr<Segment>;
+    using ConstSegmentPtr = std::shared_ptr<const Segment>;
+}
@@ -1,90 +1,1075 @@
 #include "shard.h"
+#include <queue>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace core
 {
+    static size_t collectLive(std::vector<Posting>& postings, const DocTrace& docTrace, size_t& inputDocs)
+    {
+        /**
+        * sorts postings, drops duplicates and postings of deleted documents. Returns the number of
+        * distinct live documents, inputDocs is set to the number of distinct documents before filtering
+        */
+        std::sort(postings.begin(), postings.end());
+        postings.erase(std::unique(postings.begin(), postings.end()), postings.end());
+
+        inputDocs = 0;
+        size_t liveDocs = 0;
+        size_t live = 0;
+        for (size_t i = 0; i < postings.size(); i++)
+        {
+            const bool isNewDoc = i == 0 || postings[i].first != postings[i - 1].first;
+            inputDocs += isNewDoc;
+            if (docTrace.isAlive(postings[i].first))
+            {
+                liveDocs += isNewDoc;
+                postings[live++] = postings[i];
+            }
+        }
+        postings.resize(live);
+        return liveDocs;
+    }
+
+    Shard::RecordTable::Table::Table(size_t capacity)
+        : mask(capacity - 1)
+        , slots(std::make_unique<std::atomic<uint32_t>[]>(capacity))
+        , entries(std::make_unique<Entry[]>(capacity / 2))
+    {
+    }
+
+    bool Shard::RecordTable::Table::find(TermId termId, size_t& slot) const
+    {
+        /**
+        * linear probing, slot is set to the slot of the term or to the empty slot it would take
+        */
+        for (slot = (termId >> StripeBits) & mask;; slot = (slot + 1) & mask)
+        {
+            const uint32_t entry = slots[slot].load(std::memory_order_acquire);
+            if (entry == 0)
+            {
+                return false;
+            }
+            if (entries[entry - 1].termId == termId)
+            {
+                return true;
+            }
+        }
+    }
+
+    void Shard::RecordTable::Stripe::grow(size_t capacity)
+    {
+        const Table* current = table.load(std::memory_order_relaxed);
+        auto grown = std::make_unique<Table>(current ? (current->mask + 1) * 2 : capacity);
+        const uint32_t count = size.load(std::memory_order_relaxed);
+        for (uint32_t idx = 0; idx < count; idx++)
+        {
+            const Entry& entry = current->entries[idx];
+            grown->entries[idx].termId = entry.termId;
+            grown->entries[idx].record.store(entry.record.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            size_t slot = (entry.termId >> StripeBits) & grown->mask;
+            while (grown->slots[slot].load(std::memory_order_relaxed) != 0)
+            {
+                slot = (slot + 1) & grown->mask;
+            }
+            grown->slots[slot].store(idx + 1, std::memory_order_relaxed);
+        }
+        table.store(grown.get(), std::memory_order_release);
+        tables.push_back(std::move(grown));
+    }
+
+    Shard::RecordTable::RecordTable(size_t reserve)
+    {
+        size_t capacity = 16;
+        while (capacity < reserve * 2 / StripeCount)
+        {
+            capacity *= 2;
+        }
+        for (Stripe& stripe: m_stripes)
+        {
+            stripe.grow(capacity);
+        }
+    }
+
+    TokenRecord* Shard::RecordTable::find(TermId termId) const
+    {
+        const Table* table = m_stripes[termId & (StripeCount - 1)].table.load(std::memory_order_acquire);
+        size_t slot;
+        if (!table->find(termId, slot))
+        {
+            return nullptr;
+        }
+        return table->entries[table->slots[slot].load(std::memory_order_relaxed) - 1].record.load(std::memory_order_acquire);
+    }
+
+    TokenRecord* Shard::RecordTable::insert(TermId termId, const std::function<TokenRecord*()>& make)
+    {
+        Stripe& stripe = m_stripes[termId & (StripeCount - 1)];
+        std::lock_guard<std::mutex> lock(stripe.mtx);
+        Table* table = stripe.table.load(std::memory_order_relaxed);
+        size_t slot;
+        if (table->find(termId, slot))
+        {
+            Entry& entry = table->entries[table->slots[slot].load(std::memory_order_relaxed) - 1];
+            TokenRecord* record = entry.record.load(std::memory_order_relaxed);
+            if (!record)
+            {
+                record = make();
+                entry.record.store(record, std::memory_order_release);
+                stripe.live.fetch_add(1, std::memory_order_relaxed);
+            }
+            return record;
+        }
+
+        const uint32_t idx = stripe.size.load(std::memory_order_relaxed);
+        if ((idx + 1) * 2 > table->mask + 1)
+        {
+            stripe.grow(0);
+            table = stripe.table.load(std::memory_order_relaxed);
+            table->find(termId, slot);
+        }
+        /**
+        * the entry is complete before the slot pointing to it is published
+        */
+        TokenRecord* record = make();
+        table->entries[idx].termId = termId;
+        table->entries[idx].record.store(record, std::memory_order_relaxed);
+        table->slots[slot].store(idx + 1, std::memory_order_release);
+        stripe.size.store(idx + 1, std::memory_order_relaxed);
+        stripe.live.fetch_add(1, std::memory_order_relaxed);
+        return record;
+    }
+
+    TokenRecord* Shard::RecordTable::erase(TermId termId)
+    {
+        Stripe& stripe = m_stripes[termId & (StripeCount - 1)];
+        std::lock_guard<std::mutex> lock(stripe.mtx);
+        Table* table = stripe.table.load(std::memory_order_relaxed);
+        size_t slot;
+        if (!table->find(termId, slot))
+        {
+            return nullptr;
+        }
+        Entry& entry = table->entries[table->slots[slot].load(std::memory_order_relaxed) - 1];
+        TokenRecord* record = entry.record.exchange(nullptr, std::memory_order_acq_rel);
+        if (record)
+        {
+            stripe.live.fetch_sub(1, std::memory_order_relaxed);
+        }
+        return record;
+    }
+
+    std::vector<std::pair<TermId, TokenRecord*>> Shard::RecordTable::snapshot() const
+    {
+        std::vector<std::pair<TermId, TokenRecord*>> records;
+        for (const Stripe& stripe: m_stripes)
+        {
+            const Table* table = stripe.table.load(std::memory_order_acquire);
+            const uint32_t count = stripe.size.load(std::memory_order_acquire);
+            for (uint32_t idx = 0; idx < count; idx++)
+            {
+                if (TokenRecord* record = table->entries[idx].record.load(std::memory_order_acquire))
+                {
+                    records.emplace_back(table->entries[idx].termId, record);
+                }
+            }
+        }
+        return records;
+    }
 
-    Shard::Shard(float maxLoadFactor, size_t estTokenCount, size_t estDocCount)
+    size_t Shard::RecordTable::size() const
+    {
+        size_t size = 0;
+        for (const Stripe& stripe: m_stripes)
+        {
+            size += stripe.live.load(std::memory_order_relaxed);
+        }
+        return size;
+    }
+
+    Shard::Buffer::Buffer(size_t tokenReserve, size_t docReserve)
+        : records(tokenReserve)
+        , docs(docReserve)
+    {
+    }
+
+    Shard::Buffer::~Buffer()
+    {
+        for (auto&& [_, record]: records.snapshot())
+        {
+            record->~TokenRecord();
+        }
+        for (TokenRecord* record: erased)
+        {
+            record->~TokenRecord();
+        }
+    }
+
+    TokenRecord* Shard::Buffer::record(TermId termId)
+    {
+        if (TokenRecord* record = records.find(termId))
+        {
+            return record;
+        }
+        return records.insert(termId, [this, termId] {
+            return arena.make<TokenRecord>(termId, arena.resource(termId));
+        });
+    }
+
+    const TokenRecord* Shard::Buffer::find(TermId termId) const
+    {
+        return records.find(termId);
+    }
+
+    void Shard::Buffer::erase(TermId termId)
+    {
+        if (TokenRecord* record = records.erase(termId))
+        {
+            std::lock_guard<std::mutex> lock(erasedMtx);
+            erased.push_back(record);
+        }
+    }
+
+    Shard::Shard(float maxLoadFactor, size_t estTokenCount, size_t estDocCount, const SegmentPolicy& policy,
+                 size_t shardIdx, size_t shardCount, TermInternerPtr terms)
         : m_maxLoadFactor(maxLoadFactor)
-        , m_record((float)estTokenCount / maxLoadFactor)
-        , m_docTrace(estDocCount)
+        , m_policy(policy)
+        , m_tokenReserve((float)estTokenCount / maxLoadFactor)
+        , m_docReserve(estDocCount)
+        , m_shardIdx(shardIdx)
+        , m_shardCount(shardCount)
+        , m_terms(terms ? std::move(terms) : std::make_shared<TermInterner>())
+        , m_vocabulary(m_tokenReserve)
+        , m_docTrace(estDocCount, shardIdx, shardCount)
+    {
+        if (policy.bufferPostings == 0 || policy.mergeFactor < 2)
+        {
+            throw std::invalid_argument("Invalid segment policy");
+        }
+        if (shardIdx >= shardCount)
+        {
+            throw std::invalid_argument("Invalid shard index");
+        }
+        auto view = std::make_unique<View>();
+        view->active = std::make_shared<Buffer>(m_tokenReserve, m_docReserve);
+        m_view.store(view.release(), std::memory_order_release);
+    }
+
+    Shard::~Shard()
     {
+        /**
+        * posting lists may still point into the view
+        */
+        utils::Epoch::global().retire(m_view.load(std::memory_order_relaxed));
+    }
+
+    const Shard::View* Shard::view() const
+    {
+        return m_view.load(std::memory_order_acquire);
+    }
+
+    DocId Shard::addDocument(const std::string& doc, DocStat&& docStat, bool& isNew)
+    {
+        return m_docTrace.addOrGet(doc, std::move(docStat), isNew);
+    }
+
+    bool Shard::insertDocument(const std::string& doc, DocStat&& docStat,
+                               const std::vector<TokenView>& tokens)
+    {
+        /**
+        * Postings of a document are grouped by token and appended to the active buffer in one go.
+        * Returns false if the document is already indexed
+        */
+        bool isNew;
+        const DocId docId = addDocument(doc, std::move(docStat), isNew);
+        if (!isNew)
+        {
+            return false;
+        }
+
+        /**
+        * every token is hashed once, distinct tokens are interned with that hash
+        */
+        std::unordered_map<HashedTerm, std::vector<size_t>, HashedTermHasher> grouped;
+        for (const auto& [token, pos]: tokens)
+        {
+            grouped[HashedTerm(token)].push_back(pos);
+        }
+        if (grouped.empty())
+        {
+            return true;
+        }
+
+        std::shared_lock<std::shared_mutex> ingest(m_ingestMtx);
+        const utils::Epoch::Guard guard = utils::Epoch::global().pin();
+        Buffer* buffer = view()->active.get();
+        if (buffer->docs.addIfNotPresent(docId))
+        {
+            m_docTrace.increment(docId);
+        }
+        for (const auto& [term, positions]: grouped)
+        {
+            const TermId termId = m_terms->intern(term);
+            buffer->record(termId)->append(docId, positions);
+            adjustDf(termId, 1, true);
+        }
+        buffer->postingCount += tokens.size();
+        return true;
+    }
+
+    void Shard::collect(const std::vector<TokenView>& tokens, DocPostings& postings)
+    {
+        /**
+        * tokens are grouped within the window first, so every distinct token of it is interned once
+        */
+        std::unordered_map<HashedTerm, std::vector<size_t>, HashedTermHasher> grouped;
+        for (const auto& [token, pos]: tokens)
+        {
+            grouped[HashedTerm(token)].push_back(pos);
+        }
+        for (const auto& [term, positions]: grouped)
+        {
+            std::vector<size_t>& collected = postings.positions[m_terms->intern(term)];
+            collected.insert(collected.end(), positions.begin(), positions.end());
+        }
+        postings.count += tokens.size();
+    }
+
+    bool Shard::insertDocument(const std::string& doc, DocStat&& docStat, const DocPostings& postings)
+    {
+        bool isNew;
+        const DocId docId = addDocument(doc, std::move(docStat), isNew);
+        if (!isNew)
+        {
+            return false;
+        }
+        if (postings.positions.empty())
+        {
+            return true;
+        }
+
+        std::shared_lock<std::shared_mutex> ingest(m_ingestMtx);
+        const utils::Epoch::Guard guard = utils::Epoch::global().pin();
+        Buffer* buffer = view()->active.get();
+        if (buffer->docs.addIfNotPresent(docId))
+        {
+            m_docTrace.increment(docId);
+        }
+        for (const auto& [termId, positions]: postings.positions)
+        {
+            buffer->record(termId)->append(docId, positions);
+            adjustDf(termId, 1, true);
+        }
+        buffer->postingCount += postings.count;
+        return true;
+    }
+
+    std::string_view Shard::term(TermId termId) const
+    {
+        return m_terms->term(termId);
+    }
+
+    void Shard::insert(std::string&& token, DocId docId, size_t pos)
+    {
+        const TermId termId = m_terms->intern(token);
+        std::shared_lock<std::shared_mutex> ingest(m_ingestMtx);
+        const utils::Epoch::Guard guard = utils::Epoch::global().pin();
+        Buffer* buffer = view()->active.get();
+
+        bool isNewDoc;
+        if (!buffer->record(termId)->addIfNotPresent(std::make_pair(docId, pos), isNewDoc))
+        {
+            return;
+        }
+        buffer->postingCount++;
+        if (isNewDoc)
+        {
+            adjustDf(termId, 1, true);
+        }
+        if (buffer->docs.addIfNotPresent(docId))
+        {
+            m_docTrace.increment(docId);
+        }
     }
 
     void Shard::insert(std::string&& token, const std::string& doc, DocStat&& docStat, size_t pos)
     {
-        std::string_view ref = m_docTrace.addOrIncrement(doc, std::move(docStat));
+        bool isNew;
+        const DocId docId = addDocument(doc, std::move(docStat), isNew);
+        insert(std::move(token), docId, pos);
+    }
 
-        const float forecast = log2f(m_docTrace.getAvgTokenCount());
-        const size_t expectedLoad = forecast > 9 ? ceil(forecast) : 9;
+    void Shard::adjustDf(TermId termId, size_t delta, bool increase)
+    {
+        /**
+        * the dictionary is updated under the lock of the vocabulary entry, so updates of a token apply in order
+        */
+        m_vocabulary.mutate(termId, [this, termId, delta, increase](const auto& it, bool iterValid, bool& shouldErase) {
+            if (!iterValid)
+            {
+                shouldErase = !increase;
+                if (increase)
+                {
+                    m_dictionary.insert(m_terms->term(termId));
+                }
+                return delta;
+            }
+            if (increase)
+            {
+                it->second += delta;
+            }
+            else
+            {
+                it->second -= std::min(delta, it->second);
+            }
+            shouldErase = it->second == 0;
+            if (shouldErase)
+            {
+                m_dictionary.erase(m_terms->term(termId));
+            }
+            return size_t{0};
+        });
+    }
 
-        auto callback = [expectedLoad, ref, pos]
-                        (const auto& it, bool iterValid, bool& shouldErase)
+    ConstPostingListPtr Shard::search(const std::string& token, bool& exists) const
+    {
+        auto postings = std::make_shared<PostingList>();
+        TermId termId;
+        if (!m_terms->find(token, termId))
         {
-            shouldErase = false;
-            if (iterValid)
+            exists = false;
+            return postings;
+        }
+        /**
+        * the list pins the epoch itself once a part is added, the buffers and segments it points into
+        * outlive it
+        */
+        const utils::Epoch::Guard guard = utils::Epoch::global().pin();
+        const View* snapshot = view();
+        for (const auto& segment: snapshot->segments)
+        {
+            uint32_t termIdx;
+            if (segment->find(token, termIdx))
             {
-                it->second->addIfNotPresent(std::make_pair(ref, pos));
-                return TokenRecordPtr{};
+                postings->add(m_docTrace, *segment, termIdx);
             }
-            auto newRecord = std::make_shared<TokenRecord>(expectedLoad);
-            newRecord->addIfNotPresent(std::make_pair(ref, pos));
-            return newRecord;
-        };
+        }
+        for (const auto& buffer: snapshot->sealing)
+        {
+            if (const TokenRecord* record = buffer->find(termId))
+            {
+                postings->add(m_docTrace, *record);
+            }
+        }
+        if (const TokenRecord* record = snapshot->active->find(termId))
+        {
+            postings->add(m_docTrace, *record);
+        }
+        exists = !postings->empty();
+        return postings;
+    }
+
+    ranking::ScoredDocs Shard::topDocs(const std::vector<std::string>& tokens, const std::vector<float>& idfs,
+                                       const ranking::Bm25& bm25, const ranking::Page& page) const
+    {
+        /**
+        * Buffers are small and their records are not ordered by DocId, so their documents are scored
+        * exhaustively into a dense accumulator indexed by DocId / shardCount, which also raises the
+        * threshold early. Segments are evaluated with Block-Max WAND.
+        * Every document lives in exactly one buffer or segment, so their scores never need to be combined
+        */
+        const utils::Epoch::Guard guard = utils::Epoch::global().pin();
+        const View* snapshot = view();
+        ranking::TopDocs top(page.limit, page.after);
+        std::vector<std::optional<TermId>> termIds(tokens.size());
+        for (size_t t = 0; t < tokens.size(); t++)
+        {
+            TermId termId;
+            if (m_terms->find(tokens[t], termId))
+            {
+                termIds[t] = termId;
+            }
+        }
+
+        std::vector<const Buffer*> buffers;
+        for (const auto& buffer: snapshot->sealing)
+        {
+            buffers.push_back(buffer.get());
+        }
+        buffers.push_back(snapshot->active.get());
+        ranking::Accumulator::Lease scores;
+        for (size_t t = 0; t < tokens.size(); t++)
+        {
+            if (idfs[t] <= 0 || !termIds[t])
+            {
+                continue;
+            }
+            /**
+            * a document may span lanes of a record, the list counts all its occurrences at once
+            */
+            PostingList postings;
+            for (const Buffer* buffer: buffers)
+            {
+                if (const TokenRecord* record = buffer->find(*termIds[t]))
+                {
+                    postings.add(m_docTrace, *record);
+                }
+            }
+            postings.forEachDoc([&](DocId docId, size_t termFreq) {
+                const size_t docLength = m_docTrace.getTokenCount(docId);
+                scores->add(docId / m_shardCount, bm25.score(idfs[t], termFreq, docLength));
+            });
+        }
+        scores->forEach([this, &top](size_t slot, float score) {
+            top.push(slot * m_shardCount + m_shardIdx, score);
+        });
 
-        m_record.mutate(token, std::move(callback));
+        std::vector<ranking::TermCursor> terms;
+        for (const auto& segment: snapshot->segments)
+        {
+            terms.clear();
+            for (size_t t = 0; t < tokens.size(); t++)
+            {
+                uint32_t termIdx;
+                if (idfs[t] > 0 && segment->find(tokens[t], termIdx))
+                {
+                    Segment::Cursor cursor(*segment, termIdx);
+                    const float maxScore = bm25.bound(idfs[t], cursor.termMax());
+                    terms.push_back({cursor, idfs[t], maxScore});
+                }
+            }
+            ranking::blockMaxWand(terms, bm25, m_docTrace, top);
+        }
+        return top.sorted();
     }
 
-    ConstTokenRecordPtr Shard::search(const std::string& token, bool& exists) const
+    ranking::ScoredDocs Shard::matchDocs(const query::Query& query, const std::vector<float>& idfs,
+                                         const ranking::Bm25& bm25, const ranking::Page& page, bool isRanked) const
     {
-        auto defaultValue = std::make_shared<TokenRecord>();
-        TokenRecordPtr res = m_record.get(token, defaultValue);
-        if (res != defaultValue)
+        /**
+        * The buffers are matched together, through a posting list per query token gathering the lanes of
+        * its records, which cursors walk in DocId order without copying. When the query requires some
+        * terms, the universe is the documents of the rarest of them, otherwise every document of the
+        * buffers, Not is taken relative to it
+        */
+        ranking::TopDocs top(page.limit, page.after);
+        const std::vector<size_t> required = query::requiredTokens(query);
+
+        const utils::Epoch::Guard guard = utils::Epoch::global().pin();
+        const View* snapshot = view();
+        std::vector<const Buffer*> buffers;
+        for (const auto& buffer: snapshot->sealing)
         {
-            exists = true;
+            buffers.push_back(buffer.get());
         }
-        else
+        buffers.push_back(snapshot->active.get());
+        std::vector<PostingList> postings(query.tokens.size());
+        std::vector<const PostingList*> lists(query.tokens.size(), nullptr);
+        for (size_t t = 0; t < query.tokens.size(); t++)
         {
-            exists = false;
+            TermId termId;
+            if (!m_terms->find(query.tokens[t], termId))
+            {
+                continue;
+            }
+            for (const Buffer* buffer: buffers)
+            {
+                if (const TokenRecord* record = buffer->find(termId))
+                {
+                    postings[t].add(m_docTrace, *record);
+                }
+            }
+            if (!postings[t].empty())
+            {
+                lists[t] = &postings[t];
+            }
+        }
+
+        std::optional<size_t> rarest;
+        bool isMatchable = true;
+        for (size_t t: required)
+        {
+            if (!lists[t])
+            {
+                isMatchable = false;
+                break;
+            }
+            if (!rarest || lists[t]->size() < lists[*rarest]->size())
+            {
+                rarest = t;
+            }
+        }
+        if (isMatchable)
+        {
+            std::vector<DocId> universe;
+            if (rarest)
+            {
+                lists[*rarest]->forEachDoc([&universe](DocId docId, size_t) {
+                    universe.push_back(docId);
+                });
+            }
+            else
+            {
+                for (const Buffer* buffer: buffers)
+                {
+                    for (DocId docId: buffer->docs.iterate())
+                    {
+                        universe.push_back(docId);
+                    }
+                }
+                std::sort(universe.begin(), universe.end());
+                universe.erase(std::unique(universe.begin(), universe.end()), universe.end());
+            }
+            match(query::Evaluator(query, lists, universe), idfs, bm25, isRanked, top);
+        }
+        for (const auto& segment: snapshot->segments)
+        {
+            match(query::Evaluator(query, *segment, segment->docs()), idfs, bm25, isRanked, top);
+        }
+        return top.sorted();
+    }
+
+    void Shard::match(const query::Evaluator& evaluator, const std::vector<float>& idfs, const ranking::Bm25& bm25,
+                      bool isRanked, ranking::TopDocs& top) const
+    {
+        std::vector<DocId> docs = evaluator.match();
+        docs.erase(std::remove_if(docs.begin(), docs.end(), [this](DocId docId) {
+            return !m_docTrace.isAlive(docId);
+        }), docs.end());
+        if (isRanked)
+        {
+            evaluator.rank(docs, idfs, bm25, m_docTrace, top);
+            return;
+        }
+        for (DocId docId: docs)
+        {
+            top.push(docId, 0.0f);
         }
-        return res;
     }
 
     void Shard::erase(const std::string& token)
     {
-        bool exists;
-        auto record = search(token, exists);
-        if (!exists)
+        TermId termId;
+        if (!m_terms->find(token, termId))
+        {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(m_viewMtx);
+        bool isErased = false;
+        m_vocabulary.mutate(termId, [this, &token, &isErased](const auto&, bool iterValid, bool& shouldErase) {
+            shouldErase = true;
+            if (iterValid)
+            {
+                m_dictionary.erase(token);
+                isErased = true;
+            }
+            return size_t{0};
+        });
+        if (!isErased)
         {
             return;
         }
 
-        if (m_record.erase(token))
+        const View* current = m_view.load(std::memory_order_relaxed);
+        current->active->erase(termId);
+        for (const auto& buffer: current->sealing)
+        {
+            buffer->erase(termId);
+        }
+        for (const auto& segment: current->segments)
+        {
+            segment->eraseTerm(token);
+        }
+        if (m_isMaintaining)
+        {
+            m_erasedLog.push_back(termId);
+        }
+    }
+
+    bool Shard::eraseDocument(const std::string& doc)
+    {
+        if (!m_docTrace.remove(doc))
+        {
+            return false;
+        }
+        m_mergeHint = true;
+        return true;
+    }
+
+    void Shard::publish(const std::function<void(View&)>& update, const SegmentPtr& segment, const DfDeltas& deltas)
+    {
+        std::unordered_set<TermId> erased;
+        const View* previous;
+        {
+            std::lock_guard<std::mutex> lock(m_viewMtx);
+            auto next = std::make_unique<View>(*m_view.load(std::memory_order_relaxed));
+            update(*next);
+            previous = m_view.exchange(next.release(), std::memory_order_acq_rel);
+
+            for (TermId termId: m_erasedLog)
+            {
+                segment->eraseTerm(m_terms->term(termId));
+                erased.insert(termId);
+            }
+            m_erasedLog.clear();
+            m_isMaintaining = false;
+        }
+        utils::Epoch::global().retire(previous);
+
+        /**
+        * tokens erased in the meantime are gone from the vocabulary already
+        */
+        for (const auto& [termId, delta]: deltas)
+        {
+            if (!erased.count(termId))
+            {
+                adjustDf(termId, delta, false);
+            }
+        }
+    }
+
+    bool Shard::sealLocked(size_t& retracted)
+    {
+        BufferPtr frozen;
+        const View* previous;
+        {
+            std::unique_lock<std::shared_mutex> ingest(m_ingestMtx);
+            std::lock_guard<std::mutex> lock(m_viewMtx);
+            const View* current = m_view.load(std::memory_order_relaxed);
+            if (current->active->records.size() == 0)
+            {
+                return false;
+            }
+            frozen = current->active;
+            auto next = std::make_unique<View>(*current);
+            next->active = std::make_shared<Buffer>(m_tokenReserve, m_docReserve);
+            next->sealing.push_back(frozen);
+            previous = m_view.exchange(next.release(), std::memory_order_acq_rel);
+            m_isMaintaining = true;
+        }
+        utils::Epoch::global().retire(previous);
+
+        std::vector<std::tuple<std::string_view, TermId, const TokenRecord*>> records;
+        for (auto&& [termId, record]: frozen->records.snapshot())
+        {
+            records.emplace_back(m_terms->term(termId), termId, record);
+        }
+        std::sort(records.begin(), records.end(), [](const auto& first, const auto& second) {
+            return std::get<0>(first) < std::get<0>(second);
+        });
+
+        Segment::Builder builder(&m_docTrace);
+        DfDeltas deltas;
+        for (const auto& [token, termId, record]: records)
+        {
+            std::vector<Posting> postings = record->snapshot();
+            const size_t size = postings.size();
+            size_t inputDocs;
+            const size_t liveDocs = collectLive(postings, m_docTrace, inputDocs);
+            retracted += size - postings.size();
+            if (inputDocs != liveDocs)
+            {
+                deltas.emplace_back(termId, inputDocs - liveDocs);
+            }
+            builder.add(token, postings);
+        }
+
+        const SegmentPtr segment = builder.build();
+        publish([&frozen, &segment](View& view) {
+            view.sealing.erase(std::find(view.sealing.begin(), view.sealing.end(), frozen));
+            if (segment->termCount() > 0)
+            {
+                view.segments.push_back(segment);
+            }
+        }, segment, deltas);
+
+        /**
+        * a document is referenced once by every buffer or segment holding its postings
+        */
+        for (DocId docId: segment->docs())
+        {
+            m_docTrace.increment(docId);
+        }
+        for (DocId docId: frozen->docs.iterate())
+        {
+            m_docTrace.decrement(docId);
+        }
+        m_mergeHint = true;
+        return true;
+    }
+
+    void Shard::mergeLocked(const std::vector<SegmentPtr>& inputs, size_t& retracted)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_viewMtx);
+            m_isMaintaining = true;
+        }
+
+        struct Cursor
+        {
+            const Segment* segment;
+            uint32_t termIdx;
+        };
+        auto greater = [](const Cursor& first, const Cursor& second) {
+            return first.segment->term(first.termIdx) > second.segment->term(second.termIdx);
+        };
+        std::priority_queue<Cursor, std::vector<Cursor>, decltype(greater)> heap(greater);
+        for (const auto& segment: inputs)
+        {
+            if (segment->termCount() > 0)
+            {
+                heap.push({segment.get(), 0});
+            }
+        }
+
+        Segment::Builder builder(&m_docTrace);
+        DfDeltas deltas;
+        std::vector<Posting> postings;
+        while (!heap.empty())
         {
-            for (auto&&[path, _]: record->iterate())
+            const std::string term = heap.top().segment->term(heap.top().termIdx);
+            postings.clear();
+            size_t inputDocs = 0;
+            while (!heap.empty() && heap.top().segment->term(heap.top().termIdx) == term)
+            {
+                Cursor cursor = heap.top();
+                heap.pop();
+                if (!cursor.segment->isErased(cursor.termIdx))
+                {
+                    inputDocs += cursor.segment->docCount(cursor.termIdx);
+                    cursor.segment->forEach(cursor.termIdx, [&postings](DocId docId, size_t pos) {
+                        postings.emplace_back(docId, pos);
+                        return true;
+                    });
+                }
+                if (++cursor.termIdx < cursor.segment->termCount())
+                {
+                    heap.push(cursor);
+                }
+            }
+            if (postings.empty())
             {
-                m_docTrace.eraseOrDecrement(std::string{path});
+                continue;
+            }
+
+            const size_t size = postings.size();
+            size_t distinctDocs;
+            const size_t liveDocs = collectLive(postings, m_docTrace, distinctDocs);
+            retracted += size - postings.size();
+            if (inputDocs != liveDocs)
+            {
+                deltas.emplace_back(m_terms->intern(term), inputDocs - liveDocs);
+            }
+            builder.add(term, postings);
+        }
+
+        const SegmentPtr merged = builder.build();
+        publish([&inputs, &merged](View& view) {
+            std::vector<SegmentPtr> segments;
+            bool isPlaced = false;
+            for (auto& segment: view.segments)
+            {
+                if (std::find(inputs.begin(), inputs.end(), segment) == inputs.end())
+                {
+                    segments.push_back(std::move(segment));
+                }
+                else if (!isPlaced && merged->termCount() > 0)
+                {
+                    segments.push_back(merged);
+                    isPlaced = true;
+                }
+            }
+            view.segments = std::move(segments);
+        }, merged, deltas);
+
+        for (DocId docId: merged->docs())
+        {
+            m_docTrace.increment(docId);
+        }
+        for (const auto& segment: inputs)
+        {
+            for (DocId docId: segment->docs())
+            {
+                m_docTrace.decrement(docId);
             }
         }
     }
 
+    std::vector<SegmentPtr> Shard::pickMerge(const View& view) const
+    {
+        /**
+        * Segments are bucketed into tiers growing by mergeFactor, a tier holding mergeFactor segments
+        * is merged. Otherwise, the first segment with too many deleted documents is rewritten alone
+        */
+        std::vector<std::vector<SegmentPtr>> tiers;
+        for (const auto& segment: view.segments)
+        {
+            size_t tier = 0;
+            for (size_t bound = m_policy.bufferPostings; segment->postingCount() > bound; bound *= m_policy.mergeFactor)
+            {
+                tier++;
+            }
+            if (tiers.size() <= tier)
+            {
+                tiers.resize(tier + 1);
+            }
+            tiers[tier].push_back(segment);
+            if (tiers[tier].size() == m_policy.mergeFactor)
+            {
+                return tiers[tier];
+            }
+        }
+
+        for (const auto& segment: view.segments)
+        {
+            const auto& docs = segment->docs();
+            const size_t dead = std::count_if(docs.begin(), docs.end(), [this](DocId docId) {
+                return !m_docTrace.isAlive(docId);
+            });
+            if (dead > 0 && dead >= docs.size() * m_policy.maxDeadRatio)
+            {
+                return {segment};
+            }
+        }
+        return {};
+    }
+
+    bool Shard::seal()
+    {
+        std::lock_guard<std::mutex> maintenance(m_maintenanceMtx);
+        size_t retracted = 0;
+        return sealLocked(retracted);
+    }
+
+    bool Shard::maintain()
+    {
+        /**
+        * Performs a single maintenance step: either seals a full buffer or runs one merge.
+        * Returns false once there is nothing left to do
+        */
+        std::lock_guard<std::mutex> maintenance(m_maintenanceMtx);
+        size_t retracted = 0;
+        /**
+        * views are only replaced under m_maintenanceMtx, the current one needs no pinning here
+        */
+        if (view()->active->postingCount >= m_policy.bufferPostings)
+        {
+            return sealLocked(retracted);
+        }
+
+        m_mergeHint = false;
+        const auto inputs = pickMerge(*view());
+        if (inputs.empty())
+        {
+            return false;
+        }
+        mergeLocked(inputs, retracted);
+        m_mergeHint = true;
+        return true;
+    }
+
+    bool Shard::needsMaintenance() const
+    {
+        const utils::Epoch::Guard guard = utils::Epoch::global().pin();
+        return m_mergeHint || view()->active->postingCount >= m_policy.bufferPostings;
+    }
+
+    size_t Shard::compact()
+    {
+        /**
+        * Seals the buffer and merges all segments into one, returns the number of retracted postings
+        */
+        std::lock_guard<std::mutex> maintenance(m_maintenanceMtx);
+        size_t retracted = 0;
+        sealLocked(retracted);
+
+        const auto segments = view()->segments;
+        const bool hasTombstones = std::any_of(segments.begin(), segments.end(), [this](const auto& segment) {
+            const auto& docs = segment->docs();
+            return std::any_of(docs.begin(), docs.end(), [this](DocId docId) {
+                return !m_docTrace.isAlive(docId);
+            });
+        });
+        if (segments.size() > 1 || hasTombstones)
+        {
+            mergeLocked(segments, retracted);
+        }
+        return retracted;
+    }
+
     bool Shard::exists(const std::string& token) const
     {
-        return m_record.contains(token);
+        TermId termId;
+        return m_terms->find(token, termId) && m_vocabulary.contains(termId);
+    }
+
+    bool Shard::isAlive(DocId docId) const
+    {
+        return m_docTrace.isAlive(docId);
+    }
+
+    bool Shard::findDocument(const std::string& doc, DocStat& docStat) const
+    {
+        bool found = false;
+        const DocId docId = m_docTrace.getId(doc, found);
+        if (found)
+        {
+            docStat = m_docTrace.getStat(docId);
+        }
+        return found;
+    }
+
+    std::string Shard::docPath(DocId docId) const
+    {
+        return m_docTrace.getPath(docId);
     }
 
     float Shard::loadFactor() const
     {
-        return m_record.loadFactor();
+        return m_vocabulary.loadFactor();
     }
 
     bool Shard::isExpandable() const
     {
-        return m_record.loadFactor() < m_maxLoadFactor;
+        return m_vocabulary.loadFactor() < m_maxLoadFactor;
     }
 
     size_t Shard::tokenCount() const
     {
-        return m_record.size();
+        return m_vocabulary.size();
+    }
+
+    std::vector<std::string> Shard::expand(const std::string& pattern, size_t limit, bool& truncated) const
+    {
+        return m_dictionary.match(pattern, limit, truncated);
+    }
+
+    std::vector<std::string> Shard::termRange(const std::string& from, const std::string& to, size_t limit,
+                                              bool& truncated) const
+    {
+        return m_dictionary.range(from, to, limit, truncated);
+    }
+
+    std::vector<TermMatch> Shard::fuzzyMatch(const std::string& token, size_t maxEdits) const
+    {
+        return m_dictionary.fuzzyMatch(token, maxEdits);
+    }
+
+    std::vector<std::string> Shard::documents() const
+    {
+        return m_docTrace.paths();
+    }
+
+    size_t Shard::docFreq(const std::string& token) const
+    {
+        /**
+        * maintained at index time, documents deleted since the last merge are still counted,
+        * see tombstoneCount
+        */
+        TermId termId;
+        return m_terms->find(token, termId) ? m_vocabulary.get(termId, 0) : 0;
     }
 
     size_t Shard::docCount() const
@@ -92,15 +1077,57 @@ namespace core
         return m_docTrace.size();
     }
 
+    size_t Shard::totalTokenCount() const
+    {
+        return m_docTrace.getTotalTokenCount();
+    }
+
+    size_t Shard::segmentCount() const
+    {
+        const utils::Epoch::Guard guard = utils::Epoch::global().pin();
+        return view()->segments.size();
+    }
+
+    size_t Shard::tombstoneCount() const
+    {
+        return m_docTrace.getTombstoneCount();
+    }
+
+    size_t Shard::tombstoneTokenCount() const
+    {
+        return m_docTrace.getTombstoneTokenCount();
+    }
+
     size_t Shard::tokenCountForDoc(const std::string& path) const
     {
         return m_docTrace.getTokenCount(path);
     }
 
+    size_t Shard::tokenCountForDoc(DocId docId) const
+    {
+        return m_docTrace.getTokenCount(docId);
+    }
+
     Json Shard::serialize() const
     {
-        const auto& dump = m_record.serialize();
+        /**
+        * postings are dumped by path so that dumps stay valid regardless of the ids assigned on restore
+        */
+        Json dump;
+        for (auto&& [termId, _]: m_vocabulary.snapshotDense())
+        {
+            const std::string token(m_terms->term(termId));
+            bool exists;
+            Json postings;
+            search(token, exists)->forEach([this, &postings](DocId docId, size_t pos) {
+                postings.push_back(Json::array({m_docTrace.getPath(docId), pos}));
+            });
+            if (!postings.is_null())
+            {
+                dump[token] = std::move(postings);
+            }
+        }
         const auto& docTrace = m_docTrace.serialize();
         return Json{{"dump", dump}, {"docTrace", docTrace}};
     }
-}
\ No newline at end of file
+}
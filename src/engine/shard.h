@@ -4,7 +4,20 @@
 #include "umap.h"
 #include "xxh64_hasher.h"
 #include "doc_trace.h"
+#include "postings.h"
+#include "ranking.h"
+#include "query.h"
+#include "term_dict.h"
+#include "interner.h"
+#include "arena.h"
+#include "tokenizer.h"
+#include "epoch.h"
+#include <array>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 
 namespace std
 {
@@ -23,33 +36,248 @@ namespace std
 
 namespace core
 {
-    using TokenRecord = core::USet<std::pair<std::string_view, size_t>>;
-    using TokenRecordPtr = std::shared_ptr<TokenRecord>;
-    using ConstTokenRecordPtr = std::shared_ptr<const TokenRecord>;
+    struct SegmentPolicy
+    {
+        /**
+        * bufferPostings - the in-memory buffer is sealed into a segment once it holds that many postings
+        * mergeFactor - the number of similarly sized segments merged together
+        * maxDeadRatio - segments with a larger share of deleted documents are rewritten on their own
+        */
+        size_t bufferPostings{size_t{1} << 21};
+        size_t mergeFactor{10};
+        float maxDeadRatio{0.1};
+    };
+
+    struct DocPostings
+    {
+        /**
+        * the positions of every token of a document, gathered a window of the document at a time
+        */
+        std::unordered_map<TermId, std::vector<size_t>> positions;
+        size_t count{0};
+    };
 
     class Shard
     {
+        /**
+        * Shard is organized as a small LSM tree. Fresh postings land in a mutable in-memory buffer, which
+        * is sealed into an immutable segment once it fills up. Segments of similar size are merged in the
+        * background (see maintain), which is also where postings of deleted documents are dropped.
+        * Readers grab a snapshot of the current buffers and segments and never wait for maintenance.
+        *
+        * A shard holding one of shardCount partitions of the corpus assigns DocIds congruent to shardIdx
+        * modulo shardCount, so ids stay unique across the shards of an engine.
+        *
+        * Buffers and the vocabulary are keyed by TermId. Tokens are interned where they enter the shard,
+        * shards of an engine share the interner, without one the shard interns its tokens on its own.
+        * Segments keep their terms as sorted strings, which merges and term expansion rely on.
+        */
     public:
-        Shard(float maxLoadFactor, size_t estTokenCount, size_t estDocCount);
+        Shard(float maxLoadFactor, size_t estTokenCount, size_t estDocCount, const SegmentPolicy& policy = {},
+              size_t shardIdx = 0, size_t shardCount = 1, TermInternerPtr terms = nullptr);
+        ~Shard();
+        Shard(const Shard& other) = delete;
+        Shard& operator=(const Shard& other) = delete;
+        DocId addDocument(const std::string& doc, DocStat&& docStat, bool& isNew);
+        bool insertDocument(const std::string& doc, DocStat&& docStat,
+                            const std::vector<TokenView>& tokens);
+        /**
+        * insertDocument in two steps, for a document tokenized a window at a time: collect interns the tokens
+        * of a window and adds their positions to postings, which are inserted once the document is over
+        */
+        void collect(const std::vector<TokenView>& tokens, DocPostings& postings);
+        bool insertDocument(const std::string& doc, DocStat&& docStat, const DocPostings& postings);
+        std::string_view term(TermId termId) const;
+        void insert(std::string&& token, DocId docId, size_t pos);
         void insert(std::string&& token, const std::string& doc, DocStat&& docStat, size_t pos);
-        ConstTokenRecordPtr search(const std::string& token, bool& exists) const;
+        ConstPostingListPtr search(const std::string& token, bool& exists) const;
+        ranking::ScoredDocs topDocs(const std::vector<std::string>& tokens, const std::vector<float>& idfs,
+                                    const ranking::Bm25& bm25, const ranking::Page& page) const;
+        /**
+        * documents matching a boolean query, ranked with BM25 or, unless isRanked, in DocId order
+        */
+        ranking::ScoredDocs matchDocs(const query::Query& query, const std::vector<float>& idfs,
+                                      const ranking::Bm25& bm25, const ranking::Page& page, bool isRanked) const;
         void erase(const std::string& token);
+        bool eraseDocument(const std::string& doc);
+        bool seal();
+        bool maintain();
+        bool needsMaintenance() const;
+        size_t compact();
         bool exists(const std::string& token) const;
+        bool isAlive(DocId docId) const;
+        bool findDocument(const std::string& doc, DocStat& docStat) const;
+        std::vector<std::string> documents() const;
+        std::string docPath(DocId docId) const;
         float loadFactor() const;
         bool isExpandable() const;
         size_t tokenCount() const;
+        /**
+        * tokens matching a wildcard pattern and tokens in [from, to) respectively, in lexicographical order
+        */
+        std::vector<std::string> expand(const std::string& pattern, size_t limit, bool& truncated) const;
+        std::vector<std::string> termRange(const std::string& from, const std::string& to, size_t limit,
+                                           bool& truncated) const;
+        std::vector<TermMatch> fuzzyMatch(const std::string& token, size_t maxEdits) const;
+        size_t docFreq(const std::string& token) const;
         size_t docCount() const;
+        size_t totalTokenCount() const;
+        size_t segmentCount() const;
+        size_t tombstoneCount() const;
+        size_t tombstoneTokenCount() const;
         size_t tokenCountForDoc(const std::string& path) const;
+        size_t tokenCountForDoc(DocId docId) const;
         Json serialize() const;
 
     private:
+        class RecordTable
+        {
+            /**
+            * TermId -> the record of the term in a buffer, laid out like TermInterner: stripes picked by the
+            * low bits of the id, each with an open-addressing table that is copied into one twice as large
+            * once half full. Lookups take no lock and write no shared memory, writers of a stripe are
+            * serialized by its mutex. Retired tables are freed with the buffer.
+            * An erased term keeps its slot with the record cleared, indexing the term again refills it
+            */
+        public:
+            static constexpr unsigned StripeBits = 4;
+            static constexpr size_t StripeCount = size_t{1} << StripeBits;
+
+            explicit RecordTable(size_t reserve);
+            TokenRecord* find(TermId termId) const;
+            /**
+            * the record of termId, made by make under the lock of the stripe if there is none
+            */
+            TokenRecord* insert(TermId termId, const std::function<TokenRecord*()>& make);
+            /**
+            * clears the record of termId and returns it
+            */
+            TokenRecord* erase(TermId termId);
+            std::vector<std::pair<TermId, TokenRecord*>> snapshot() const;
+            size_t size() const;
+
+        private:
+            struct Entry
+            {
+                TermId termId;
+                std::atomic<TokenRecord*> record;
+            };
+
+            struct Table
+            {
+                /**
+                * slots hold the index of an entry plus one, 0 marks an empty slot
+                */
+                explicit Table(size_t capacity);
+                bool find(TermId termId, size_t& slot) const;
+
+                const size_t mask;
+                const std::unique_ptr<std::atomic<uint32_t>[]> slots;
+                const std::unique_ptr<Entry[]> entries;
+            };
+
+            struct Stripe
+            {
+                void grow(size_t capacity);
+
+                std::mutex mtx;
+                std::atomic<Table*> table{nullptr};
+                std::atomic<uint32_t> size{0};
+                /**
+                * entries holding a record
+                */
+                std::atomic<uint32_t> live{0};
+                std::vector<std::unique_ptr<Table>> tables;
+            };
+
+            std::array<Stripe, StripeCount> m_stripes;
+        };
+
+        struct Buffer
+        {
+            /**
+            * Records and their postings are allocated from the arena of the buffer and released with it.
+            * Buffers are owned by views, the pointers handed out stay valid while the epoch is pinned
+            */
+            Buffer(size_t tokenReserve, size_t docReserve);
+            ~Buffer();
+            TokenRecord* record(TermId termId);
+            const TokenRecord* find(TermId termId) const;
+            void erase(TermId termId);
+
+            Arena arena;
+            RecordTable records;
+            USet<DocId> docs;
+            std::atomic<size_t> postingCount{0};
+            /**
+            * records erased from records, destroyed along with the buffer as readers may still hold them
+            */
+            std::mutex erasedMtx;
+            std::vector<TokenRecord*> erased;
+        };
+        using BufferPtr = std::shared_ptr<Buffer>;
+
+        struct View
+        {
+            BufferPtr active;
+            /**
+            * buffers that no longer accept postings but have not been published as segments yet
+            */
+            std::vector<BufferPtr> sealing;
+            std::vector<SegmentPtr> segments;
+        };
+        using DfDeltas = std::vector<std::pair<TermId, size_t>>;
+
+        /**
+        * the published view, valid while the calling thread keeps the epoch pinned
+        */
+        const View* view() const;
+        void adjustDf(TermId termId, size_t delta, bool increase);
+        bool sealLocked(size_t& retracted);
+        void mergeLocked(const std::vector<SegmentPtr>& inputs, size_t& retracted);
+        std::vector<SegmentPtr> pickMerge(const View& view) const;
+        void match(const query::Evaluator& evaluator, const std::vector<float>& idfs, const ranking::Bm25& bm25,
+                   bool isRanked, ranking::TopDocs& top) const;
+        void publish(const std::function<void(View&)>& update, const SegmentPtr& segment, const DfDeltas& deltas);
+
+    private:
+        const float m_maxLoadFactor;
+        const SegmentPolicy m_policy;
+        const size_t m_tokenReserve;
+        const size_t m_docReserve;
+        const size_t m_shardIdx;
+        const size_t m_shardCount;
+        const TermInternerPtr m_terms;
+        /**
+        * token -> the number of documents with postings of the token, deleted documents included
+        * until their postings are merged away
+        */
+        SUMap<TermId, size_t> m_vocabulary;
         /**
-        * word -> [document_path, position]
+        * the tokens of m_vocabulary in order
         */
-        SUMap<std::string, TokenRecordPtr, Xxh64Hasher> m_record;
+        TermDictionary m_dictionary;
         DocTrace m_docTrace;
-        const float m_maxLoadFactor;
+        /**
+        * writers hold m_ingestMtx shared for the duration of a document, so a document is never split
+        * between two buffers. Maintenance holds m_maintenanceMtx, view updates are made under m_viewMtx
+        */
+        mutable std::shared_mutex m_ingestMtx;
+        std::mutex m_maintenanceMtx;
+        mutable std::mutex m_viewMtx;
+        /**
+        * Readers load the view with a plain acquire and keep the epoch pinned while they use it and
+        * whatever it owns, so a query touches no reference count and no lock. A replaced view is retired
+        * through the epoch along with the buffers and segments only it owned
+        */
+        std::atomic<const View*> m_view{nullptr};
+        /**
+        * tokens erased while a segment was being built, they are erased from it once it is published
+        */
+        std::vector<TermId> m_erasedLog;
+        bool m_isMaintaining{false};
+        std::atomic<bool> m_mergeHint{false};
     };
 
     using ShardPtr = std::shared_ptr<Shard>;
-}
\ No newline at end of file
+}
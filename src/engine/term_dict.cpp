@@ -0,0 +1,212 @@
+#include "term_dict.h"
+#include <algorithm>
+#include <mutex>
+
+namespace core
+{
+    namespace wildcard
+    {
+        bool isPattern(std::string_view text)
+        {
+            return text.find_first_of("*?") != std::string_view::npos;
+        }
+
+        bool matches(std::string_view pattern, std::string_view term)
+        {
+            /**
+            * greedy matching, on a mismatch the last * takes one more character, which keeps it linear
+            * in the number of * times the length of the term
+            */
+            size_t p = 0;
+            size_t t = 0;
+            size_t star = std::string_view::npos;
+            size_t resume = 0;
+            while (t < term.size())
+            {
+                if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == term[t]))
+                {
+                    p++;
+                    t++;
+                }
+                else if (p < pattern.size() && pattern[p] == '*')
+                {
+                    star = p++;
+                    resume = t;
+                }
+                else if (star != std::string_view::npos)
+                {
+                    p = star + 1;
+                    t = ++resume;
+                }
+                else
+                {
+                    return false;
+                }
+            }
+            while (p < pattern.size() && pattern[p] == '*')
+            {
+                p++;
+            }
+            return p == pattern.size();
+        }
+
+        std::string_view literalPrefix(std::string_view pattern)
+        {
+            return pattern.substr(0, std::min(pattern.find_first_of("*?"), pattern.size()));
+        }
+    }
+
+    void TermDictionary::insert(std::string_view term)
+    {
+        std::unique_lock lock(m_mtx);
+        m_terms.emplace(term);
+    }
+
+    void TermDictionary::erase(std::string_view term)
+    {
+        std::unique_lock lock(m_mtx);
+        const auto it = m_terms.find(term);
+        if (it != m_terms.end())
+        {
+            m_terms.erase(it);
+        }
+    }
+
+    bool TermDictionary::contains(const std::string& term) const
+    {
+        std::shared_lock lock(m_mtx);
+        return m_terms.count(term) > 0;
+    }
+
+    size_t TermDictionary::size() const
+    {
+        std::shared_lock lock(m_mtx);
+        return m_terms.size();
+    }
+
+    std::vector<std::string> TermDictionary::range(const std::string& from, const std::string& to, size_t limit,
+                                                   bool& truncated) const
+    {
+        std::shared_lock lock(m_mtx);
+        std::vector<std::string> res;
+        truncated = false;
+        for (auto it = m_terms.lower_bound(from); it != m_terms.end() && (to.empty() || *it < to); ++it)
+        {
+            if (res.size() == limit)
+            {
+                truncated = true;
+                break;
+            }
+            res.push_back(*it);
+        }
+        return res;
+    }
+
+    std::vector<std::string> TermDictionary::match(const std::string& pattern, size_t limit, bool& truncated) const
+    {
+        /**
+        * only the terms starting with the literal prefix of the pattern are visited, a pattern starting
+        * with a wildcard walks the whole dictionary
+        */
+        const std::string_view prefix = wildcard::literalPrefix(pattern);
+        const bool isPrefix = pattern.size() == prefix.size() + 1 && pattern.back() == '*';
+
+        std::shared_lock lock(m_mtx);
+        std::vector<std::string> res;
+        truncated = false;
+        for (auto it = m_terms.lower_bound(prefix); it != m_terms.end() && it->compare(0, prefix.size(), prefix) == 0;
+             ++it)
+        {
+            if (!isPrefix && !wildcard::matches(pattern, *it))
+            {
+                continue;
+            }
+            if (res.size() == limit)
+            {
+                truncated = true;
+                break;
+            }
+            res.push_back(*it);
+        }
+        return res;
+    }
+
+    std::vector<TermMatch> TermDictionary::fuzzyMatch(const std::string& term, size_t maxEdits) const
+    {
+        /**
+        * Runs the Levenshtein automaton of term over the sorted terms: row d of the edit distance table
+        * describes the state reached after the first d characters of a candidate. Consecutive terms share
+        * prefixes, so only the rows past the common prefix are recomputed. Once every entry of a row
+        * exceeds maxEdits no extension of that prefix can match and the walk seeks past all of them
+        */
+        maxEdits = std::min(maxEdits, fuzzy::MaxEdits);
+        const size_t width = term.size() + 1;
+        std::vector<size_t> rows(width);
+        for (size_t j = 0; j < width; j++)
+        {
+            rows[j] = j;
+        }
+
+        std::shared_lock lock(m_mtx);
+        std::vector<TermMatch> res;
+        std::string previous;
+        auto it = m_terms.begin();
+        while (it != m_terms.end())
+        {
+            const std::string& candidate = *it;
+            const size_t common = std::mismatch(previous.begin(), previous.end(), candidate.begin(),
+                                                candidate.end()).first - previous.begin();
+            rows.resize(width * (candidate.size() + 1));
+
+            size_t depth = common + 1;
+            bool isDead = false;
+            for (; depth <= candidate.size(); depth++)
+            {
+                const size_t* above = rows.data() + (depth - 1) * width;
+                size_t* row = rows.data() + depth * width;
+                row[0] = depth;
+                size_t best = row[0];
+                for (size_t j = 1; j < width; j++)
+                {
+                    const size_t cost = candidate[depth - 1] == term[j - 1] ? 0 : 1;
+                    row[j] = std::min({above[j] + 1, row[j - 1] + 1, above[j - 1] + cost});
+                    best = std::min(best, row[j]);
+                }
+                if (best > maxEdits)
+                {
+                    isDead = true;
+                    break;
+                }
+            }
+
+            if (!isDead)
+            {
+                const size_t distance = rows[candidate.size() * width + term.size()];
+                if (distance <= maxEdits)
+                {
+                    res.push_back({candidate, distance});
+                }
+                previous = candidate;
+                ++it;
+                continue;
+            }
+
+            /**
+            * skips every term starting with the first depth characters of the candidate
+            */
+            std::string next = candidate.substr(0, depth);
+            while (!next.empty() && static_cast<unsigned char>(next.back()) == 0xFF)
+            {
+                next.pop_back();
+            }
+            if (next.empty())
+            {
+                break;
+            }
+            next.back() = static_cast<char>(static_cast<unsigned char>(next.back()) + 1);
+            previous = candidate.substr(0, depth);
+            it = m_terms.lower_bound(next);
+        }
+        return res;
+    }
+}
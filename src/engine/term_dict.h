@@ -0,0 +1,70 @@
+#pragma once
+
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace core
+{
+    namespace wildcard
+    {
+        /**
+        * Patterns are terms with wildcards, * stands for any run of characters and ? for a single one
+        */
+        bool isPattern(std::string_view text);
+        bool matches(std::string_view pattern, std::string_view term);
+        /**
+        * the part of the pattern before its first wildcard, every match starts with it
+        */
+        std::string_view literalPrefix(std::string_view pattern);
+    }
+
+    namespace fuzzy
+    {
+        /**
+        * fuzzy matching is limited to two edits, beyond that nearly every short term matches
+        */
+        constexpr size_t MaxEdits = 2;
+    }
+
+    struct TermMatch
+    {
+        std::string term;
+        /**
+        * the Levenshtein distance to the term looked for
+        */
+        size_t distance;
+        size_t docFreq{0};
+    };
+
+    class TermDictionary
+    {
+        /**
+        * TermDictionary keeps the terms of a shard in lexicographical order, next to the hashed vocabulary,
+        * so that prefixes, ranges and patterns expand by walking a sorted run of terms instead of scanning
+        * the whole vocabulary. Terms are added and removed as the vocabulary gains and loses them.
+        * Expansions are bounded: at most limit terms are returned, truncated tells whether more would match
+        */
+    public:
+        void insert(std::string_view term);
+        void erase(std::string_view term);
+        bool contains(const std::string& term) const;
+        size_t size() const;
+        /**
+        * terms in [from, to), an empty to leaves the range open
+        */
+        std::vector<std::string> range(const std::string& from, const std::string& to, size_t limit,
+                                       bool& truncated) const;
+        std::vector<std::string> match(const std::string& pattern, size_t limit, bool& truncated) const;
+        /**
+        * terms within maxEdits insertions, deletions and substitutions of term, in lexicographical order
+        */
+        std::vector<TermMatch> fuzzyMatch(const std::string& term, size_t maxEdits) const;
+
+    private:
+        mutable std::shared_mutex m_mtx;
+        std::set<std::string, std::less<>> m_terms;
+    };
+}
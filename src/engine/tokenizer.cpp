@@ -0,0 +1,499 @@
+#include "tokenizer.h"
+#include "unicode.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define ANECHKA_AVX2_DISPATCH
+#endif
+
+namespace core
+{
+    namespace detail
+    {
+        /**
+        * Every classifier handles a block of 64 bytes: the token bytes of the block make up the returned
+        * word, bit i standing for byte i, and the lowercased block is written to dst unless it is null.
+        * Letters are recognized branch-free: after folding the case bit, a letter is a byte in ['a', 'z'],
+        * which a wrapping add moves to the bottom of the signed range, so one signed compare tells them apart
+        */
+#if !defined(__SSE2__)
+        static uint64_t classifyBlockScalar(const char* src, char* dst)
+        {
+            uint64_t mask = 0;
+            for (size_t i = 0; i < 64; i++)
+            {
+                const char ch = src[i];
+                mask |= uint64_t{isTokenByte(ch)} << i;
+                if (dst)
+                {
+                    dst[i] = ch >= 'A' && ch <= 'Z' ? static_cast<char>(ch | 0x20) : ch;
+                }
+            }
+            return mask;
+        }
+#endif
+
+#if defined(__SSE2__)
+        static uint64_t classifyBlockSse2(const char* src, char* dst)
+        {
+            const __m128i caseBit = _mm_set1_epi8(0x20);
+            const __m128i toLower = _mm_set1_epi8(static_cast<char>(128 - 'a'));
+            const __m128i toUpper = _mm_set1_epi8(static_cast<char>(128 - 'A'));
+            const __m128i bound = _mm_set1_epi8(static_cast<char>(-128 + 26));
+            const __m128i apostrophe = _mm_set1_epi8('\'');
+
+            uint64_t mask = 0;
+            for (size_t i = 0; i < 64; i += 16)
+            {
+                const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                const __m128i letters =
+                    _mm_cmplt_epi8(_mm_add_epi8(_mm_or_si128(bytes, caseBit), toLower), bound);
+                const __m128i tokenBytes = _mm_or_si128(letters, _mm_cmpeq_epi8(bytes, apostrophe));
+                mask |= uint64_t(uint32_t(_mm_movemask_epi8(tokenBytes))) << i;
+                if (dst)
+                {
+                    const __m128i upper = _mm_cmplt_epi8(_mm_add_epi8(bytes, toUpper), bound);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                                     _mm_or_si128(bytes, _mm_and_si128(upper, caseBit)));
+                }
+            }
+            return mask;
+        }
+#endif
+
+#if defined(ANECHKA_AVX2_DISPATCH)
+        __attribute__((target("avx2"))) static uint64_t classifyBlockAvx2(const char* src, char* dst)
+        {
+            const __m256i caseBit = _mm256_set1_epi8(0x20);
+            const __m256i toLower = _mm256_set1_epi8(static_cast<char>(128 - 'a'));
+            const __m256i toUpper = _mm256_set1_epi8(static_cast<char>(128 - 'A'));
+            const __m256i bound = _mm256_set1_epi8(static_cast<char>(-128 + 26));
+            const __m256i apostrophe = _mm256_set1_epi8('\'');
+
+            uint64_t mask = 0;
+            for (size_t i = 0; i < 64; i += 32)
+            {
+                const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                const __m256i letters =
+                    _mm256_cmpgt_epi8(bound, _mm256_add_epi8(_mm256_or_si256(bytes, caseBit), toLower));
+                const __m256i tokenBytes = _mm256_or_si256(letters, _mm256_cmpeq_epi8(bytes, apostrophe));
+                mask |= uint64_t(uint32_t(_mm256_movemask_epi8(tokenBytes))) << i;
+                if (dst)
+                {
+                    const __m256i upper = _mm256_cmpgt_epi8(bound, _mm256_add_epi8(bytes, toUpper));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                                        _mm256_or_si256(bytes, _mm256_and_si256(upper, caseBit)));
+                }
+            }
+            return mask;
+        }
+#endif
+
+        template<typename Block>
+        static void classifyWith(Block block, const char* text, size_t size, char* lowered, uint64_t* mask)
+        {
+            const size_t full = size / 64;
+            for (size_t b = 0; b < full; b++)
+            {
+                mask[b] = block(text + b * 64, lowered ? lowered + b * 64 : nullptr);
+            }
+            const size_t tail = size % 64;
+            if (tail == 0)
+            {
+                return;
+            }
+            /**
+            * the tail is padded with zero bytes, which are no token bytes
+            */
+            char src[64] = {};
+            char dst[64];
+            std::memcpy(src, text + full * 64, tail);
+            mask[full] = block(src, lowered ? dst : nullptr);
+            if (lowered)
+            {
+                std::memcpy(lowered + full * 64, dst, tail);
+            }
+        }
+
+#if defined(ANECHKA_AVX2_DISPATCH)
+        __attribute__((target("avx2"))) static void classifyAvx2(const char* text, size_t size, char* lowered,
+                                                                  uint64_t* mask)
+        {
+            classifyWith(classifyBlockAvx2, text, size, lowered, mask);
+        }
+#endif
+
+        void classify(const char* text, size_t size, char* lowered, uint64_t* mask)
+        {
+#if defined(ANECHKA_AVX2_DISPATCH)
+            static const bool hasAvx2 = __builtin_cpu_supports("avx2");
+            if (hasAvx2)
+            {
+                classifyAvx2(text, size, lowered, mask);
+                return;
+            }
+#endif
+#if defined(__SSE2__)
+            classifyWith(classifyBlockSse2, text, size, lowered, mask);
+#else
+            classifyWith(classifyBlockScalar, text, size, lowered, mask);
+#endif
+        }
+
+        template<typename Block>
+        static bool isAsciiWith(Block block, const char* text, size_t size)
+        {
+            /**
+            * blocks of 64 bytes are OR-ed together, a byte with its high bit set anywhere makes the text non-ASCII
+            */
+            const size_t full = size / 64 * 64;
+            for (size_t i = 0; i < full; i += 64)
+            {
+                if (!block(text + i))
+                {
+                    return false;
+                }
+            }
+            return std::all_of(text + full, text + size, [](char ch) {
+                return static_cast<unsigned char>(ch) < 0x80;
+            });
+        }
+
+#if defined(__SSE2__)
+        static bool isAsciiBlockSse2(const char* src)
+        {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+            for (size_t i = 16; i < 64; i += 16)
+            {
+                bytes = _mm_or_si128(bytes, _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+            }
+            return _mm_movemask_epi8(bytes) == 0;
+        }
+#endif
+
+#if defined(ANECHKA_AVX2_DISPATCH)
+        __attribute__((target("avx2"))) static bool isAsciiBlockAvx2(const char* src)
+        {
+            const __m256i bytes = _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)),
+                                                  _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 32)));
+            return _mm256_movemask_epi8(bytes) == 0;
+        }
+
+        __attribute__((target("avx2"))) static bool isAsciiAvx2(const char* text, size_t size)
+        {
+            return isAsciiWith(isAsciiBlockAvx2, text, size);
+        }
+#endif
+
+        bool isAscii(const char* text, size_t size)
+        {
+#if defined(ANECHKA_AVX2_DISPATCH)
+            static const bool hasAvx2 = __builtin_cpu_supports("avx2");
+            if (hasAvx2)
+            {
+                return isAsciiAvx2(text, size);
+            }
+#endif
+#if defined(__SSE2__)
+            return isAsciiWith(isAsciiBlockSse2, text, size);
+#else
+            return std::all_of(text, text + size, [](char ch) {
+                return static_cast<unsigned char>(ch) < 0x80;
+            });
+#endif
+        }
+
+        static size_t afterLastSeparator(const char* text, size_t size)
+        {
+            /**
+            * the end of the last separator of the text, 0 if there is none. Code points are decoded from
+            * the end back, one cut short by the end of the text or otherwise invalid is no separator here
+            */
+            for (size_t end = size; end > 0;)
+            {
+                if (static_cast<unsigned char>(text[end - 1]) < 0x80)
+                {
+                    if (!isTokenByte(text[end - 1]))
+                    {
+                        return end;
+                    }
+                    end--;
+                    continue;
+                }
+                size_t begin = end - 1;
+                while (begin > 0 && end - begin < 4 && (text[begin] & 0xC0) == 0x80)
+                {
+                    begin--;
+                }
+                size_t i = begin;
+                char32_t cp;
+                if (unicode::decode(text, end, i, cp) && i == end &&
+                    unicode::wordClass(cp) == unicode::WordClass::Other)
+                {
+                    return end;
+                }
+                end = begin;
+            }
+            return 0;
+        }
+
+        static size_t nextBit(const std::vector<uint64_t>& mask, size_t from, size_t size, bool isSet)
+        {
+            /**
+            * the first byte at or after from that is a token byte if isSet and a separator otherwise
+            */
+            if (from >= size)
+            {
+                return size;
+            }
+            size_t word = from / 64;
+            uint64_t bits = (isSet ? mask[word] : ~mask[word]) & (~uint64_t{0} << (from % 64));
+            while (bits == 0)
+            {
+                if (++word == mask.size())
+                {
+                    return size;
+                }
+                bits = isSet ? mask[word] : ~mask[word];
+            }
+            return std::min(word * 64 + __builtin_ctzll(bits), size);
+        }
+    }
+
+    TokenizedText::TokenizedText(std::string_view text, bool toLowercase, bool toNfc, size_t offset, size_t ordinal)
+    {
+        if (text.empty())
+        {
+            return;
+        }
+        /**
+        * an ASCII text is in NFC already
+        */
+        if (detail::isAscii(text.data(), text.size()))
+        {
+            tokenizeAscii(text, toLowercase, offset, ordinal);
+            return;
+        }
+        tokenizeUtf8(text, toLowercase, toNfc, offset, ordinal);
+    }
+
+    void TokenizedText::tokenizeAscii(std::string_view text, bool toLowercase, size_t offset, size_t ordinal)
+    {
+        const size_t size = text.size();
+        if (toLowercase)
+        {
+            m_owned.resize(size);
+        }
+        std::vector<uint64_t> mask((size + 63) / 64);
+        detail::classify(text.data(), size, toLowercase ? m_owned.data() : nullptr, mask.data());
+
+        const char* data = toLowercase ? m_owned.data() : text.data();
+        for (size_t end = 0;;)
+        {
+            const size_t begin = detail::nextBit(mask, end, size, true);
+            if (begin == size)
+            {
+                break;
+            }
+            end = detail::nextBit(mask, begin, size, false);
+            m_tokens.emplace_back(std::string_view(data + begin, end - begin),
+                                  position::pack(offset + end, ordinal + m_tokens.size()));
+        }
+    }
+
+    void TokenizedText::tokenizeUtf8(std::string_view text, bool toLowercase, bool toNfc, size_t offset,
+                                     size_t ordinal)
+    {
+        /**
+        * Token boundaries are found first, as byte ranges of the text. Transformed tokens are appended to
+        * m_owned, which may grow meanwhile, so their views are taken once all of them are in
+        */
+        std::vector<std::pair<size_t, size_t>> spans;
+        size_t begin = std::string_view::npos;
+        unicode::WordClass run = unicode::WordClass::Other;
+        for (size_t i = 0; i < text.size();)
+        {
+            const size_t at = i;
+            char32_t cp;
+            unicode::WordClass cls = unicode::WordClass::Other;
+            if (static_cast<unsigned char>(text[i]) < 0x80)
+            {
+                cls = detail::isTokenByte(text[i]) ? unicode::WordClass::Letter : unicode::WordClass::Other;
+                i++;
+            }
+            else if (unicode::decode(text.data(), text.size(), i, cp))
+            {
+                cls = unicode::wordClass(cp);
+            }
+
+            /**
+            * an extending code point with no token before it is dropped along with the separator it extends
+            */
+            if (cls == unicode::WordClass::Extend || (cls == run && cls != unicode::WordClass::Ideograph))
+            {
+                continue;
+            }
+            if (begin != std::string_view::npos)
+            {
+                spans.emplace_back(begin, at);
+            }
+            begin = cls != unicode::WordClass::Other ? at : std::string_view::npos;
+            run = cls;
+        }
+        if (begin != std::string_view::npos)
+        {
+            spans.emplace_back(begin, text.size());
+        }
+
+        if (!toLowercase && !toNfc)
+        {
+            for (const auto& [first, last]: spans)
+            {
+                m_tokens.emplace_back(text.substr(first, last - first),
+                                      position::pack(offset + last, ordinal + m_tokens.size()));
+            }
+            return;
+        }
+
+        std::vector<size_t> ends;
+        std::u32string cps;
+        for (const auto& [first, last]: spans)
+        {
+            cps.clear();
+            bool isStable = true;
+            for (size_t i = first; i < last;)
+            {
+                char32_t cp;
+                unicode::decode(text.data(), last, i, cp);
+                cp = toLowercase ? unicode::foldCase(cp) : cp;
+                isStable = isStable && unicode::isNfcStable(cp);
+                cps += cp;
+            }
+            if (toNfc && !isStable)
+            {
+                unicode::toNfc(cps);
+            }
+            for (const char32_t cp: cps)
+            {
+                unicode::encode(cp, m_owned);
+            }
+            ends.push_back(m_owned.size());
+        }
+        for (size_t t = 0, first = 0; t < spans.size(); first = ends[t++])
+        {
+            m_tokens.emplace_back(std::string_view(m_owned.data() + first, ends[t] - first),
+                                  position::pack(offset + spans[t].second, ordinal + t));
+        }
+    }
+
+    const std::vector<TokenView>& TokenizedText::tokens() const
+    {
+        return m_tokens;
+    }
+
+    size_t TokenizedText::size() const
+    {
+        return m_tokens.size();
+    }
+
+    TokenStream::TokenStream(const std::string& path, bool toLowercase, bool toNfc, size_t windowSize)
+        : m_toLowercase(toLowercase)
+        , m_toNfc(toNfc)
+        , m_window(windowSize > 0 ? windowSize : 1)
+    {
+        if ((m_fd = open(path.c_str(), O_RDONLY | O_CLOEXEC)) == -1)
+        {
+            throw std::invalid_argument("Invalid filepath");
+        }
+        posix_fadvise(m_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+
+    TokenStream::~TokenStream()
+    {
+        close(m_fd);
+    }
+
+    bool TokenStream::next()
+    {
+        /**
+        * the bytes past the cut of the previous window are moved to the front only now, as its tokens
+        * may point into them
+        */
+        std::memmove(m_window.data(), m_window.data() + m_cut, m_filled - m_cut);
+        m_filled -= m_cut;
+        m_offset += m_cut;
+        m_cut = 0;
+        m_text.reset();
+        while (!m_isOver && m_filled < m_window.size())
+        {
+            const ssize_t res = read(m_fd, m_window.data() + m_filled, m_window.size() - m_filled);
+            if (res < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (res <= 0)
+            {
+                m_isFailed = res < 0;
+                m_isOver = true;
+                break;
+            }
+            m_filled += res;
+        }
+        if (m_filled == 0)
+        {
+            return false;
+        }
+
+        m_cut = m_filled;
+        if (!m_isOver)
+        {
+            m_cut = detail::afterLastSeparator(m_window.data(), m_filled);
+            if (m_cut == 0)
+            {
+                m_cut = m_filled;
+                for (size_t back = 0; back < 3 && m_cut > 0 && (m_window[m_cut - 1] & 0xC0) == 0x80; back++)
+                {
+                    m_cut--;
+                }
+                if (m_cut > 0 && (m_window[m_cut - 1] & 0xC0) == 0xC0)
+                {
+                    m_cut--;
+                }
+                m_cut = m_cut > 0 ? m_cut : m_filled;
+            }
+        }
+        m_text = std::make_unique<const TokenizedText>(std::string_view(m_window.data(), m_cut), m_toLowercase,
+                                                       m_toNfc, m_offset, m_count);
+        m_count += m_text->size();
+        return true;
+    }
+
+    const std::vector<TokenView>& TokenStream::tokens() const
+    {
+        static const std::vector<TokenView> none;
+        return m_text ? m_text->tokens() : none;
+    }
+
+    std::string_view TokenStream::text() const
+    {
+        return m_text ? std::string_view(m_window.data(), m_cut) : std::string_view();
+    }
+
+    size_t TokenStream::size() const
+    {
+        return m_count;
+    }
+
+    bool TokenStream::isFailed() const
+    {
+        return m_isFailed;
+    }
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "segment.h"
+#include "common.h"
+#include <string_view>
+
+namespace core
+{
+    /**
+    * a token and its position, see position::pack. The offset of a token is the offset of its end
+    */
+    using TokenView = std::pair<std::string_view, size_t>;
+
+    class TokenizedText
+    {
+        /**
+        * TokenizedText splits a UTF-8 text into tokens, see unicode::WordClass. A text is checked for being
+        * pure ASCII first, a vector at a time, as most are. Tokens of an ASCII text are maximal runs of
+        * letters and apostrophes: bytes are classified 32 (AVX2) or 16 (SSE2) at a time into a bitmap of
+        * token bytes, lowercasing happens in the same pass, and token boundaries are then read off the
+        * bitmap 64 bytes at a time. Any other text is decoded a code point at a time, invalid sequences
+        * separate tokens. Lowercasing is simple case folding there, and tokens are optionally brought to NFC.
+        *
+        * Tokens are views into the text or, when lowercased or normalized, into a copy owned by this,
+        * so the text has to outlive the tokens and no token is allocated on its own.
+        */
+    public:
+        /**
+        * offset and ordinal are those of the text within its document, for a document tokenized a window at a time
+        */
+        TokenizedText(std::string_view text, bool toLowercase, bool toNfc = false, size_t offset = 0,
+                      size_t ordinal = 0);
+        TokenizedText(const TokenizedText& other) = delete;
+        TokenizedText& operator=(const TokenizedText& other) = delete;
+        const std::vector<TokenView>& tokens() const;
+        size_t size() const;
+
+    private:
+        void tokenizeAscii(std::string_view text, bool toLowercase, size_t offset, size_t ordinal);
+        void tokenizeUtf8(std::string_view text, bool toLowercase, bool toNfc, size_t offset, size_t ordinal);
+
+    private:
+        std::string m_owned;
+        std::vector<TokenView> m_tokens;
+    };
+
+    class TokenStream
+    {
+        /**
+        * TokenStream tokenizes a file a window at a time, so a file of any size takes no more memory than a
+        * window and its tokens. Windows are filled with plain reads. A window ends after its last separator,
+        * a code point of no token, and the token cut short by it is carried over to the start of the next one, positions
+        * count from the start of the file. Only a token filling a whole window is split, at the end of the
+        * window or of the last code point that fits in it
+        */
+    public:
+        static constexpr size_t WindowSize = size_t{1} << 20;
+
+        TokenStream(const std::string& path, bool toLowercase, bool toNfc, size_t windowSize = WindowSize);
+        ~TokenStream();
+        TokenStream(const TokenStream& other) = delete;
+        TokenStream& operator=(const TokenStream& other) = delete;
+        /**
+        * tokenizes the next window, false once the file is over. The tokens of a window are valid until the
+        * next call
+        */
+        bool next();
+        const std::vector<TokenView>& tokens() const;
+        /**
+        * the part of the file the tokens of the window come from
+        */
+        std::string_view text() const;
+        /**
+        * the tokens of every window so far
+        */
+        size_t size() const;
+        bool isFailed() const;
+
+    private:
+        int m_fd;
+        const bool m_toLowercase;
+        const bool m_toNfc;
+        std::vector<char> m_window;
+        size_t m_filled{0};
+        size_t m_cut{0};
+        size_t m_offset{0};
+        size_t m_count{0};
+        bool m_isOver{false};
+        bool m_isFailed{false};
+        std::unique_ptr<const TokenizedText> m_text;
+    };
+
+    namespace detail
+    {
+        /**
+        * the byte-at-a-time classifier, the reference for the vectorized ones
+        */
+        inline bool isTokenByte(char ch)
+        {
+            return utils::isLetter(ch) || ch == '\'';
+        }
+
+        /**
+        * writes the token-byte bitmap of text to mask, ceil(size / 64) words, and the lowercased text to
+        * lowered unless it is null. The widest instruction set supported by the CPU is picked at runtime
+        */
+        void classify(const char* text, size_t size, char* lowered, uint64_t* mask);
+        bool isAscii(const char* text, size_t size);
+    }
+}
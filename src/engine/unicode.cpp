@@ -0,0 +1,323 @@
+#include "unicode.h"
+#include "unicode/gen/unicode_data.h"
+#include <algorithm>
+#include <iterator>
+
+namespace core::unicode
+{
+    /**
+    * Hangul syllables are composed and decomposed algorithmically, see section 3.12 of the Unicode standard
+    */
+    static constexpr char32_t HangulBase = 0xAC00;
+    static constexpr char32_t LeadBase = 0x1100;
+    static constexpr char32_t VowelBase = 0x1161;
+    static constexpr char32_t TrailBase = 0x11A7;
+    static constexpr char32_t VowelCount = 21;
+    static constexpr char32_t TrailCount = 28;
+    static constexpr char32_t LeadCount = 19;
+    static constexpr char32_t HangulCount = LeadCount * VowelCount * TrailCount;
+
+    template<size_t N>
+    static uint8_t rangeValue(const data::Range (&table)[N], char32_t cp)
+    {
+        const auto it = std::upper_bound(std::begin(table), std::end(table), cp,
+                                         [](char32_t cp, const data::Range& range) {
+                                             return cp < range.first;
+                                         });
+        return it == std::begin(table) ? 0 : std::prev(it)->value;
+    }
+
+    WordClass wordClass(char32_t cp)
+    {
+        return static_cast<WordClass>(rangeValue(data::WordClasses, cp));
+    }
+
+    char32_t foldCase(char32_t cp)
+    {
+        if (cp < 0x80)
+        {
+            return cp >= 'A' && cp <= 'Z' ? cp | 0x20 : cp;
+        }
+        if (cp == 0x2019)
+        {
+            return '\'';
+        }
+        const auto it = std::lower_bound(std::begin(data::Folds), std::end(data::Folds), cp,
+                                         [](const data::Mapping& mapping, char32_t cp) {
+                                             return mapping.from < cp;
+                                         });
+        return it != std::end(data::Folds) && it->from == cp ? it->to : cp;
+    }
+
+    uint8_t combiningClass(char32_t cp)
+    {
+        return cp < 0x300 ? 0 : rangeValue(data::CombiningClasses, cp);
+    }
+
+    bool isNfcStable(char32_t cp)
+    {
+        return cp < 0x300 || !rangeValue(data::Unstable, cp);
+    }
+
+    bool decode(const char* data, size_t size, size_t& i, char32_t& cp)
+    {
+        const auto byte = [data](size_t at) {
+            return static_cast<unsigned char>(data[at]);
+        };
+        const unsigned char lead = byte(i);
+        size_t length;
+        char32_t min;
+        if (lead < 0x80)
+        {
+            cp = lead;
+            i++;
+            return true;
+        }
+        else if ((lead & 0xE0) == 0xC0)
+        {
+            length = 2;
+            min = 0x80;
+            cp = lead & 0x1F;
+        }
+        else if ((lead & 0xF0) == 0xE0)
+        {
+            length = 3;
+            min = 0x800;
+            cp = lead & 0x0F;
+        }
+        else if ((lead & 0xF8) == 0xF0)
+        {
+            length = 4;
+            min = 0x10000;
+            cp = lead & 0x07;
+        }
+        else
+        {
+            i++;
+            return false;
+        }
+
+        if (size - i < length)
+        {
+            i++;
+            return false;
+        }
+        for (size_t k = 1; k < length; k++)
+        {
+            if ((byte(i + k) & 0xC0) != 0x80)
+            {
+                i++;
+                return false;
+            }
+            cp = cp << 6 | (byte(i + k) & 0x3F);
+        }
+        /**
+        * overlong forms, surrogates and code points past the last plane are invalid
+        */
+        if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+        {
+            i++;
+            return false;
+        }
+        i += length;
+        return true;
+    }
+
+    bool isValid(std::string_view text)
+    {
+        for (size_t i = 0; i < text.size();)
+        {
+            if (static_cast<unsigned char>(text[i]) < 0x80)
+            {
+                i++;
+                continue;
+            }
+            char32_t cp;
+            if (!decode(text.data(), text.size(), i, cp))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void encode(char32_t cp, std::string& out)
+    {
+        if (cp < 0x80)
+        {
+            out += static_cast<char>(cp);
+        }
+        else if (cp < 0x800)
+        {
+            out += static_cast<char>(0xC0 | cp >> 6);
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        }
+        else if (cp < 0x10000)
+        {
+            out += static_cast<char>(0xE0 | cp >> 12);
+            out += static_cast<char>(0x80 | (cp >> 6 & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        }
+        else
+        {
+            out += static_cast<char>(0xF0 | cp >> 18);
+            out += static_cast<char>(0x80 | (cp >> 12 & 0x3F));
+            out += static_cast<char>(0x80 | (cp >> 6 & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        }
+    }
+
+    static void decompose(char32_t cp, std::u32string& out)
+    {
+        if (cp >= HangulBase && cp < HangulBase + HangulCount)
+        {
+            const char32_t idx = cp - HangulBase;
+            out += LeadBase + idx / (VowelCount * TrailCount);
+            out += VowelBase + idx % (VowelCount * TrailCount) / TrailCount;
+            if (idx % TrailCount != 0)
+            {
+                out += TrailBase + idx % TrailCount;
+            }
+            return;
+        }
+        const auto it = std::lower_bound(std::begin(data::Decompositions), std::end(data::Decompositions), cp,
+                                         [](const data::Decomposition& decomposition, char32_t cp) {
+                                             return decomposition.cp < cp;
+                                         });
+        if (it == std::end(data::Decompositions) || it->cp != cp)
+        {
+            out += cp;
+            return;
+        }
+        decompose(it->first, out);
+        if (it->second != 0)
+        {
+            decompose(it->second, out);
+        }
+    }
+
+    static bool compose(char32_t first, char32_t second, char32_t& composite)
+    {
+        if (first >= LeadBase && first < LeadBase + LeadCount && second >= VowelBase &&
+            second < VowelBase + VowelCount)
+        {
+            composite = HangulBase + ((first - LeadBase) * VowelCount + second - VowelBase) * TrailCount;
+            return true;
+        }
+        if (first >= HangulBase && first < HangulBase + HangulCount && (first - HangulBase) % TrailCount == 0 &&
+            second > TrailBase && second < TrailBase + TrailCount)
+        {
+            composite = first + second - TrailBase;
+            return true;
+        }
+        const auto it = std::lower_bound(std::begin(data::Compositions), std::end(data::Compositions),
+                                         std::make_pair(first, second),
+                                         [](const data::Composition& composition, std::pair<char32_t, char32_t> key) {
+                                             return std::make_pair(char32_t{composition.first},
+                                                                   char32_t{composition.second}) < key;
+                                         });
+        if (it == std::end(data::Compositions) || it->first != first || it->second != second)
+        {
+            return false;
+        }
+        composite = it->composite;
+        return true;
+    }
+
+    void toNfc(std::u32string& cps)
+    {
+        std::u32string decomposed;
+        for (const char32_t cp: cps)
+        {
+            decompose(cp, decomposed);
+        }
+
+        /**
+        * canonical ordering: marks following a starter are sorted by combining class, stable among equal ones
+        */
+        for (size_t i = 1; i < decomposed.size(); i++)
+        {
+            const uint8_t ccc = combiningClass(decomposed[i]);
+            for (size_t k = i; ccc != 0 && k > 0 && combiningClass(decomposed[k - 1]) > ccc; k--)
+            {
+                std::swap(decomposed[k - 1], decomposed[k]);
+            }
+        }
+
+        /**
+        * a code point combines with the last starter unless a code point of the same or a higher combining
+        * class, or another starter, stands in between
+        */
+        cps.clear();
+        size_t starter = 0;
+        bool hasStarter = false;
+        uint8_t lastCcc = 0;
+        for (const char32_t cp: decomposed)
+        {
+            const uint8_t ccc = combiningClass(cp);
+            char32_t composite;
+            if (hasStarter && (cps.size() - 1 == starter || (lastCcc != 0 && lastCcc < ccc)) &&
+                compose(cps[starter], cp, composite))
+            {
+                cps[starter] = composite;
+                continue;
+            }
+            if (ccc == 0)
+            {
+                starter = cps.size();
+                hasStarter = true;
+            }
+            lastCcc = ccc;
+            cps += cp;
+        }
+    }
+
+    static std::u32string decodeAll(const std::string& text)
+    {
+        /**
+        * invalid sequences turn into the replacement character
+        */
+        std::u32string cps;
+        for (size_t i = 0; i < text.size();)
+        {
+            char32_t cp;
+            cps += decode(text.data(), text.size(), i, cp) ? cp : 0xFFFD;
+        }
+        return cps;
+    }
+
+    void foldCase(std::string& text)
+    {
+        if (std::all_of(text.begin(), text.end(), [](char ch) {
+                return static_cast<unsigned char>(ch) < 0x80;
+            }))
+        {
+            std::transform(text.begin(), text.end(), text.begin(), [](char ch) {
+                return static_cast<char>(foldCase(static_cast<unsigned char>(ch)));
+            });
+            return;
+        }
+        std::string folded;
+        folded.reserve(text.size());
+        for (const char32_t cp: decodeAll(text))
+        {
+            encode(foldCase(cp), folded);
+        }
+        text = std::move(folded);
+    }
+
+    void toNfc(std::string& text)
+    {
+        std::u32string cps = decodeAll(text);
+        if (std::all_of(cps.begin(), cps.end(), isNfcStable))
+        {
+            return;
+        }
+        toNfc(cps);
+        text.clear();
+        for (const char32_t cp: cps)
+        {
+            encode(cp, text);
+        }
+    }
+}
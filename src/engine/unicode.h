@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace core::unicode
+{
+    /**
+    * The classes of code points the tokenizer tells apart, after the word boundary rules of UAX #29:
+    * runs of letters and runs of katakana make up tokens, every ideograph is a token of its own, and
+    * combining marks and format characters stay with the code point they follow. Apostrophes count as
+    * letters, as ' does for ASCII texts, digits separate tokens. The tables are generated from the
+    * Unicode character database by src/engine/unicode/generator.py
+    */
+    enum class WordClass : uint8_t
+    {
+        Other,
+        Letter,
+        Katakana,
+        Ideograph,
+        Extend,
+    };
+
+    WordClass wordClass(char32_t cp);
+    /**
+    * simple case folding, mapping a code point to a single one, the typographic apostrophe folds into '
+    */
+    char32_t foldCase(char32_t cp);
+    uint8_t combiningClass(char32_t cp);
+    /**
+    * false for code points NFC may change or combine with the one before, a text of none is in NFC
+    */
+    bool isNfcStable(char32_t cp);
+
+    /**
+    * decodes the code point at data[i] and moves i past it. An invalid sequence is skipped a byte at a
+    * time, decode returns false for it
+    */
+    bool decode(const char* data, size_t size, size_t& i, char32_t& cp);
+    bool isValid(std::string_view text);
+    void encode(char32_t cp, std::string& out);
+    /**
+    * canonical decomposition followed by canonical composition, in place
+    */
+    void toNfc(std::u32string& cps);
+
+    /**
+    * foldCase and toNfc for a whole UTF-8 text, ASCII texts are handled a byte at a time
+    */
+    void foldCase(std::string& text);
+    void toNfc(std::string& text);
+}
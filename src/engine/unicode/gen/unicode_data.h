@@ -0,0 +1,1283 @@
+#pragma once
+
+// generated by src/engine/unicode/generator.py from Unicode 14.0.0, do not edit
+
+#include <cstdint>
+
+namespace core::unicode::data
+{
+    struct Range
+    {
+        uint32_t first;
+        uint8_t value;
+    };
+
+    struct Mapping
+    {
+        uint32_t from;
+        uint32_t to;
+    };
+
+    struct Decomposition
+    {
+        uint32_t cp;
+        uint32_t first;
+        uint32_t second;
+    };
+
+    struct Composition
+    {
+        uint32_t first;
+        uint32_t second;
+        uint32_t composite;
+    };
+
+    constexpr Range WordClasses[] = {
+        {0, 0}, {39, 1}, {40, 0}, {65, 1}, {91, 0}, {97, 1},
+        {123, 0}, {170, 1}, {171, 0}, {173, 4}, {174, 0}, {181, 1},
+        {182, 0}, {186, 1}, {187, 0}, {192, 1}, {215, 0}, {216, 1},
+        {247, 0}, {248, 1}, {706, 0}, {710, 1}, {722, 0}, {736, 1},
+        {741, 0}, {748, 1}, {749, 0}, {750, 1}, {751, 0}, {768, 4},
+        {880, 1}, {885, 0}, {886, 1}, {888, 0}, {890, 1}, {894, 0},
+        {895, 1}, {896, 0}, {902, 1}, {903, 0}, {904, 1}, {907, 0},
+        {908, 1}, {909, 0}, {910, 1}, {930, 0}, {931, 1}, {1014, 0},
+        {1015, 1}, {1154, 0}, {1155, 4}, {1162, 1}, {1328, 0}, {1329, 1},
+        {1367, 0}, {1369, 1}, {1370, 0}, {1376, 1}, {1417, 0}, {1425, 4},
+        {1470, 0}, {1471, 4}, {1472, 0}, {1473, 4}, {1475, 0}, {1476, 4},
+        {1478, 0}, {1479, 4}, {1480, 0}, {1488, 1}, {1515, 0}, {1519, 1},
+        {1523, 0}, {1536, 4}, {1542, 0}, {1552, 4}, {1563, 0}, {1564, 4},
+        {1565, 0}, {1568, 1}, {1611, 4}, {1632, 0}, {1646, 1}, {1648, 4},
+        {1649, 1}, {1748, 0}, {1749, 1}, {1750, 4}, {1758, 0}, {1759, 4},
+        {1765, 1}, {1767, 4}, {1769, 0}, {1770, 4}, {1774, 1}, {1776, 0},
+        {1786, 1}, {1789, 0}, {1791, 1}, {1792, 0}, {1807, 4}, {1808, 1},
+        {1809, 4}, {1810, 1}, {1840, 4}, {1867, 0}, {1869, 1}, {1958, 4},
+        {1969, 1}, {1970, 0}, {1994, 1}, {2027, 4}, {2036, 1}, {2038, 0},
+        {2042, 1}, {2043, 0}, {2045, 4}, {2046, 0}, {2048, 1}, {2070, 4},
+        {2074, 1}, {2075, 4}, {2084, 1}, {2085, 4}, {2088, 1}, {2089, 4},
+        {2094, 0}, {2112, 1}, {2137, 4}, {2140, 0}, {2144, 1}, {2155, 0},
+        {2160, 1}, {2184, 0}, {2185, 1}, {2191, 0}, {2192, 4}, {2194, 0},
+        {2200, 4}, {2208, 1}, {2250, 4}, {2308, 1}, {2362, 4}, {2365, 1},
+        {2366, 4}, {2384, 1}, {2385, 4}, {2392, 1}, {2402, 4}, {2404, 0},
+        {2417, 1}, {2433, 4}, {2436, 0}, {2437, 1}, {2445, 0}, {2447, 1},
+        {2449, 0}, {2451, 1}, {2473, 0}, {2474, 1}, {2481, 0}, {2482, 1},
+        {2483, 0}, {2486, 1}, {2490, 0}, {2492, 4}, {2493, 1}, {2494, 4},
+        {2501, 0}, {2503, 4}, {2505, 0}, {2507, 4}, {2510, 1}, {2511, 0},
+        {2519, 4}, {2520, 0}, {2524, 1}, {2526, 0}, {2527, 1}, {2530, 4},
+        {2532, 0}, {2544, 1}, {2546, 0}, {2556, 1}, {2557, 0}, {2558, 4},
+        {2559, 0}, {2561, 4}, {2564, 0}, {2565, 1}, {2571, 0}, {2575, 1},
+        {2577, 0}, {2579, 1}, {2601, 0}, {2602, 1}, {2609, 0}, {2610, 1},
+        {2612, 0}, {2613, 1}, {2615, 0}, {2616, 1}, {2618, 0}, {2620, 4},
+        {2621, 0}, {2622, 4}, {2627, 0}, {2631, 4}, {2633, 0}, {2635, 4},
+        {2638, 0}, {2641, 4}, {2642, 0}, {2649, 1}, {2653, 0}, {2654, 1},
+        {2655, 0}, {2672, 4}, {2674, 1}, {2677, 4}, {2678, 0}, {2689, 4},
+        {2692, 0}, {2693, 1}, {2702, 0}, {2703, 1}, {2706, 0}, {2707, 1},
+        {2729, 0}, {2730, 1}, {2737, 0}, {2738, 1}, {2740, 0}, {2741, 1},
+        {2746, 0}, {2748, 4}, {2749, 1}, {2750, 4}, {2758, 0}, {2759, 4},
+        {2762, 0}, {2763, 4}, {2766, 0}, {2768, 1}, {2769, 0}, {2784, 1},
+        {2786, 4}, {2788, 0}, {2809, 1}, {2810, 4}, {2816, 0}, {2817, 4},
+        {2820, 0}, {2821, 1}, {2829, 0}, {2831, 1}, {2833, 0}, {2835, 1},
+        {2857, 0}, {2858, 1}, {2865, 0}, {2866, 1}, {2868, 0}, {2869, 1},
+        {2874, 0}, {2876, 4}, {2877, 1}, {2878, 4}, {2885, 0}, {2887, 4},
+        {2889, 0}, {2891, 4}, {2894, 0}, {2901, 4}, {2904, 0}, {2908, 1},
+        {2910, 0}, {2911, 1}, {2914, 4}, {2916, 0}, {2929, 1}, {2930, 0},
+        {2946, 4}, {2947, 1}, {2948, 0}, {2949, 1}, {2955, 0}, {2958, 1},
+        {2961, 0}, {2962, 1}, {2966, 0}, {2969, 1}, {2971, 0}, {2972, 1},
+        {2973, 0}, {2974, 1}, {2976, 0}, {2979, 1}, {2981, 0}, {2984, 1},
+        {2987, 0}, {2990, 1}, {3002, 0}, {3006, 4}, {3011, 0}, {3014, 4},
+        {3017, 0}, {3018, 4}, {3022, 0}, {3024, 1}, {3025, 0}, {3031, 4},
+        {3032, 0}, {3072, 4}, {3077, 1}, {3085, 0}, {3086, 1}, {3089, 0},
+        {3090, 1}, {3113, 0}, {3114, 1}, {3130, 0}, {3132, 4}, {3133, 1},
+        {3134, 4}, {3141, 0}, {3142, 4}, {3145, 0}, {3146, 4}, {3150, 0},
+        {3157, 4}, {3159, 0}, {3160, 1}, {3163, 0}, {3165, 1}, {3166, 0},
+        {3168, 1}, {3170, 4}, {3172, 0}, {3200, 1}, {3201, 4}, {3204, 0},
+        {3205, 1}, {3213, 0}, {3214, 1}, {3217, 0}, {3218, 1}, {3241, 0},
+        {3242, 1}, {3252, 0}, {3253, 1}, {3258, 0}, {3260, 4}, {3261, 1},
+        {3262, 4}, {3269, 0}, {3270, 4}, {3273, 0}, {3274, 4}, {3278, 0},
+        {3285, 4}, {3287, 0}, {3293, 1}, {3295, 0}, {3296, 1}, {3298, 4},
+        {3300, 0}, {3313, 1}, {3315, 0}, {3328, 4}, {3332, 1}, {3341, 0},
+        {3342, 1}, {3345, 0}, {3346, 1}, {3387, 4}, {3389, 1}, {3390, 4},
+        {3397, 0}, {3398, 4}, {3401, 0}, {3402, 4}, {3406, 1}, {3407, 0},
+        {3412, 1}, {3415, 4}, {3416, 0}, {3423, 1}, {3426, 4}, {3428, 0},
+        {3450, 1}, {3456, 0}, {3457, 4}, {3460, 0}, {3461, 1}, {3479, 0},
+        {3482, 1}, {3506, 0}, {3507, 1}, {3516, 0}, {3517, 1}, {3518, 0},
+        {3520, 1}, {3527, 0}, {3530, 4}, {3531, 0}, {3535, 4}, {3541, 0},
+        {3542, 4}, {3543, 0}, {3544, 4}, {3552, 0}, {3570, 4}, {3572, 0},
+        {3585, 1}, {3633, 4}, {3634, 1}, {3636, 4}, {3643, 0}, {3648, 1},
+        {3655, 4}, {3663, 0}, {3713, 1}, {3715, 0}, {3716, 1}, {3717, 0},
+        {3718, 1}, {3723, 0}, {3724, 1}, {3748, 0}, {3749, 1}, {3750, 0},
+        {3751, 1}, {3761, 4}, {3762, 1}, {3764, 4}, {3773, 1}, {3774, 0},
+        {3776, 1}, {3781, 0}, {3782, 1}, {3783, 0}, {3784, 4}, {3790, 0},
+        {3804, 1}, {3808, 0}, {3840, 1}, {3841, 0}, {3864, 4}, {3866, 0},
+        {3893, 4}, {3894, 0}, {3895, 4}, {3896, 0}, {3897, 4}, {3898, 0},
+        {3902, 4}, {3904, 1}, {3912, 0}, {3913, 1}, {3949, 0}, {3953, 4},
+        {3973, 0}, {3974, 4}, {3976, 1}, {3981, 4}, {3992, 0}, {3993, 4},
+        {4029, 0}, {4038, 4}, {4039, 0}, {4096, 1}, {4139, 4}, {4159, 1},
+        {4160, 0}, {4176, 1}, {4182, 4}, {4186, 1}, {4190, 4}, {4193, 1},
+        {4194, 4}, {4197, 1}, {4199, 4}, {4206, 1}, {4209, 4}, {4213, 1},
+        {4226, 4}, {4238, 1}, {4239, 4}, {4240, 0}, {4250, 4}, {4254, 0},
+        {4256, 1}, {4294, 0}, {4295, 1}, {4296, 0}, {4301, 1}, {4302, 0},
+        {4304, 1}, {4347, 0}, {4348, 1}, {4681, 0}, {4682, 1}, {4686, 0},
+        {4688, 1}, {4695, 0}, {4696, 1}, {4697, 0}, {4698, 1}, {4702, 0},
+        {4704, 1}, {4745, 0}, {4746, 1}, {4750, 0}, {4752, 1}, {4785, 0},
+        {4786, 1}, {4790, 0}, {4792, 1}, {4799, 0}, {4800, 1}, {4801, 0},
+        {4802, 1}, {4806, 0}, {4808, 1}, {4823, 0}, {4824, 1}, {4881, 0},
+        {4882, 1}, {4886, 0}, {4888, 1}, {4955, 0}, {4957, 4}, {4960, 0},
+        {4992, 1}, {5008, 0}, {5024, 1}, {5110, 0}, {5112, 1}, {5118, 0},
+        {5121, 1}, {5741, 0}, {5743, 1}, {5760, 0}, {5761, 1}, {5787, 0},
+        {5792, 1}, {5867, 0}, {5870, 1}, {5881, 0}, {5888, 1}, {5906, 4},
+        {5910, 0}, {5919, 1}, {5938, 4}, {5941, 0}, {5952, 1}, {5970, 4},
+        {5972, 0}, {5984, 1}, {5997, 0}, {5998, 1}, {6001, 0}, {6002, 4},
+        {6004, 0}, {6016, 1}, {6068, 4}, {6100, 0}, {6103, 1}, {6104, 0},
+        {6108, 1}, {6109, 4}, {6110, 0}, {6155, 4}, {6160, 0}, {6176, 1},
+        {6265, 0}, {6272, 1}, {6277, 4}, {6279, 1}, {6313, 4}, {6314, 1},
+        {6315, 0}, {6320, 1}, {6390, 0}, {6400, 1}, {6431, 0}, {6432, 4},
+        {6444, 0}, {6448, 4}, {6460, 0}, {6480, 1}, {6510, 0}, {6512, 1},
+        {6517, 0}, {6528, 1}, {6572, 0}, {6576, 1}, {6602, 0}, {6656, 1},
+        {6679, 4}, {6684, 0}, {6688, 1}, {6741, 4}, {6751, 0}, {6752, 4},
+        {6781, 0}, {6783, 4}, {6784, 0}, {6823, 1}, {6824, 0}, {6832, 4},
+        {6863, 0}, {6912, 4}, {6917, 1}, {6964, 4}, {6981, 1}, {6989, 0},
+        {7019, 4}, {7028, 0}, {7040, 4}, {7043, 1}, {7073, 4}, {7086, 1},
+        {7088, 0}, {7098, 1}, {7142, 4}, {7156, 0}, {7168, 1}, {7204, 4},
+        {7224, 0}, {7245, 1}, {7248, 0}, {7258, 1}, {7294, 0}, {7296, 1},
+        {7305, 0}, {7312, 1}, {7355, 0}, {7357, 1}, {7360, 0}, {7376, 4},
+        {7379, 0}, {7380, 4}, {7401, 1}, {7405, 4}, {7406, 1}, {7412, 4},
+        {7413, 1}, {7415, 4}, {7418, 1}, {7419, 0}, {7424, 1}, {7616, 4},
+        {7680, 1}, {7958, 0}, {7960, 1}, {7966, 0}, {7968, 1}, {8006, 0},
+        {8008, 1}, {8014, 0}, {8016, 1}, {8024, 0}, {8025, 1}, {8026, 0},
+        {8027, 1}, {8028, 0}, {8029, 1}, {8030, 0}, {8031, 1}, {8062, 0},
+        {8064, 1}, {8117, 0}, {8118, 1}, {8125, 0}, {8126, 1}, {8127, 0},
+        {8130, 1}, {8133, 0}, {8134, 1}, {8141, 0}, {8144, 1}, {8148, 0},
+        {8150, 1}, {8156, 0}, {8160, 1}, {8173, 0}, {8178, 1}, {8181, 0},
+        {8182, 1}, {8189, 0}, {8204, 4}, {8208, 0}, {8217, 1}, {8218, 0},
+        {8234, 4}, {8239, 0}, {8288, 4}, {8293, 0}, {8294, 4}, {8304, 0},
+        {8305, 1}, {8306, 0}, {8319, 1}, {8320, 0}, {8336, 1}, {8349, 0},
+        {8400, 4}, {8433, 0}, {8450, 1}, {8451, 0}, {8455, 1}, {8456, 0},
+        {8458, 1}, {8468, 0}, {8469, 1}, {8470, 0}, {8473, 1}, {8478, 0},
+        {8484, 1}, {8485, 0}, {8486, 1}, {8487, 0}, {8488, 1}, {8489, 0},
+        {8490, 1}, {8494, 0}, {8495, 1}, {8506, 0}, {8508, 1}, {8512, 0},
+        {8517, 1}, {8522, 0}, {8526, 1}, {8527, 0}, {8544, 1}, {8585, 0},
+        {11264, 1}, {11493, 0}, {11499, 1}, {11503, 4}, {11506, 1}, {11508, 0},
+        {11520, 1}, {11558, 0}, {11559, 1}, {11560, 0}, {11565, 1}, {11566, 0},
+        {11568, 1}, {11624, 0}, {11631, 1}, {11632, 0}, {11647, 4}, {11648, 1},
+        {11671, 0}, {11680, 1}, {11687, 0}, {11688, 1}, {11695, 0}, {11696, 1},
+        {11703, 0}, {11704, 1}, {11711, 0}, {11712, 1}, {11719, 0}, {11720, 1},
+        {11727, 0}, {11728, 1}, {11735, 0}, {11736, 1}, {11743, 0}, {11744, 4},
+        {11776, 0}, {11823, 1}, {11824, 0}, {12293, 3}, {12294, 1}, {12295, 3},
+        {12296, 0}, {12321, 1}, {12330, 4}, {12336, 0}, {12337, 1}, {12342, 0},
+        {12344, 1}, {12349, 0}, {12353, 3}, {12439, 0}, {12441, 4}, {12443, 0},
+        {12445, 3}, {12448, 0}, {12449, 2}, {12539, 0}, {12540, 2}, {12544, 0},
+        {12549, 1}, {12592, 0}, {12593, 1}, {12687, 0}, {12704, 1}, {12736, 0},
+        {12784, 2}, {12800, 0}, {13312, 3}, {19904, 0}, {19968, 3}, {40960, 1},
+        {42125, 0}, {42192, 1}, {42238, 0}, {42240, 1}, {42509, 0}, {42512, 1},
+        {42528, 0}, {42538, 1}, {42540, 0}, {42560, 1}, {42607, 4}, {42611, 0},
+        {42612, 4}, {42622, 0}, {42623, 1}, {42654, 4}, {42656, 1}, {42736, 4},
+        {42738, 0}, {42775, 1}, {42784, 0}, {42786, 1}, {42889, 0}, {42891, 1},
+        {42955, 0}, {42960, 1}, {42962, 0}, {42963, 1}, {42964, 0}, {42965, 1},
+        {42970, 0}, {42994, 1}, {43010, 4}, {43011, 1}, {43014, 4}, {43015, 1},
+        {43019, 4}, {43020, 1}, {43043, 4}, {43048, 0}, {43052, 4}, {43053, 0},
+        {43072, 1}, {43124, 0}, {43136, 4}, {43138, 1}, {43188, 4}, {43206, 0},
+        {43232, 4}, {43250, 1}, {43256, 0}, {43259, 1}, {43260, 0}, {43261, 1},
+        {43263, 4}, {43264, 0}, {43274, 1}, {43302, 4}, {43310, 0}, {43312, 1},
+        {43335, 4}, {43348, 0}, {43360, 1}, {43389, 0}, {43392, 4}, {43396, 1},
+        {43443, 4}, {43457, 0}, {43471, 1}, {43472, 0}, {43488, 1}, {43493, 4},
+        {43494, 1}, {43504, 0}, {43514, 1}, {43519, 0}, {43520, 1}, {43561, 4},
+        {43575, 0}, {43584, 1}, {43587, 4}, {43588, 1}, {43596, 4}, {43598, 0},
+        {43616, 1}, {43639, 0}, {43642, 1}, {43643, 4}, {43646, 1}, {43696, 4},
+        {43697, 1}, {43698, 4}, {43701, 1}, {43703, 4}, {43705, 1}, {43710, 4},
+        {43712, 1}, {43713, 4}, {43714, 1}, {43715, 0}, {43739, 1}, {43742, 0},
+        {43744, 1}, {43755, 4}, {43760, 0}, {43762, 1}, {43765, 4}, {43767, 0},
+        {43777, 1}, {43783, 0}, {43785, 1}, {43791, 0}, {43793, 1}, {43799, 0},
+        {43808, 1}, {43815, 0}, {43816, 1}, {43823, 0}, {43824, 1}, {43867, 0},
+        {43868, 1}, {43882, 0}, {43888, 1}, {44003, 4}, {44011, 0}, {44012, 4},
+        {44014, 0}, {44032, 1}, {55204, 0}, {55216, 1}, {55239, 0}, {55243, 1},
+        {55292, 0}, {63744, 3}, {64110, 0}, {64112, 3}, {64218, 0}, {64256, 1},
+        {64263, 0}, {64275, 1}, {64280, 0}, {64285, 1}, {64286, 4}, {64287, 1},
+        {64297, 0}, {64298, 1}, {64311, 0}, {64312, 1}, {64317, 0}, {64318, 1},
+        {64319, 0}, {64320, 1}, {64322, 0}, {64323, 1}, {64325, 0}, {64326, 1},
+        {64434, 0}, {64467, 1}, {64830, 0}, {64848, 1}, {64912, 0}, {64914, 1},
+        {64968, 0}, {65008, 1}, {65020, 0}, {65024, 4}, {65040, 0}, {65056, 4},
+        {65072, 0}, {65136, 1}, {65141, 0}, {65142, 1}, {65277, 0}, {65279, 4},
+        {65280, 0}, {65313, 1}, {65339, 0}, {65345, 1}, {65371, 0}, {65382, 2},
+        {65440, 1}, {65471, 0}, {65474, 1}, {65480, 0}, {65482, 1}, {65488, 0},
+        {65490, 1}, {65496, 0}, {65498, 1}, {65501, 0}, {65529, 4}, {65532, 0},
+        {65536, 1}, {65548, 0}, {65549, 1}, {65575, 0}, {65576, 1}, {65595, 0},
+        {65596, 1}, {65598, 0}, {65599, 1}, {65614, 0}, {65616, 1}, {65630, 0},
+        {65664, 1}, {65787, 0}, {65856, 1}, {65909, 0}, {66045, 4}, {66046, 0},
+        {66176, 1}, {66205, 0}, {66208, 1}, {66257, 0}, {66272, 4}, {66273, 0},
+        {66304, 1}, {66336, 0}, {66349, 1}, {66379, 0}, {66384, 1}, {66422, 4},
+        {66427, 0}, {66432, 1}, {66462, 0}, {66464, 1}, {66500, 0}, {66504, 1},
+        {66512, 0}, {66513, 1}, {66518, 0}, {66560, 1}, {66718, 0}, {66736, 1},
+        {66772, 0}, {66776, 1}, {66812, 0}, {66816, 1}, {66856, 0}, {66864, 1},
+        {66916, 0}, {66928, 1}, {66939, 0}, {66940, 1}, {66955, 0}, {66956, 1},
+        {66963, 0}, {66964, 1}, {66966, 0}, {66967, 1}, {66978, 0}, {66979, 1},
+        {66994, 0}, {66995, 1}, {67002, 0}, {67003, 1}, {67005, 0}, {67072, 1},
+        {67383, 0}, {67392, 1}, {67414, 0}, {67424, 1}, {67432, 0}, {67456, 1},
+        {67462, 0}, {67463, 1}, {67505, 0}, {67506, 1}, {67515, 0}, {67584, 1},
+        {67590, 0}, {67592, 1}, {67593, 0}, {67594, 1}, {67638, 0}, {67639, 1},
+        {67641, 0}, {67644, 1}, {67645, 0}, {67647, 1}, {67670, 0}, {67680, 1},
+        {67703, 0}, {67712, 1}, {67743, 0}, {67808, 1}, {67827, 0}, {67828, 1},
+        {67830, 0}, {67840, 1}, {67862, 0}, {67872, 1}, {67898, 0}, {67968, 1},
+        {68024, 0}, {68030, 1}, {68032, 0}, {68096, 1}, {68097, 4}, {68100, 0},
+        {68101, 4}, {68103, 0}, {68108, 4}, {68112, 1}, {68116, 0}, {68117, 1},
+        {68120, 0}, {68121, 1}, {68150, 0}, {68152, 4}, {68155, 0}, {68159, 4},
+        {68160, 0}, {68192, 1}, {68221, 0}, {68224, 1}, {68253, 0}, {68288, 1},
+        {68296, 0}, {68297, 1}, {68325, 4}, {68327, 0}, {68352, 1}, {68406, 0},
+        {68416, 1}, {68438, 0}, {68448, 1}, {68467, 0}, {68480, 1}, {68498, 0},
+        {68608, 1}, {68681, 0}, {68736, 1}, {68787, 0}, {68800, 1}, {68851, 0},
+        {68864, 1}, {68900, 4}, {68904, 0}, {69248, 1}, {69290, 0}, {69291, 4},
+        {69293, 0}, {69296, 1}, {69298, 0}, {69376, 1}, {69405, 0}, {69415, 1},
+        {69416, 0}, {69424, 1}, {69446, 4}, {69457, 0}, {69488, 1}, {69506, 4},
+        {69510, 0}, {69552, 1}, {69573, 0}, {69600, 1}, {69623, 0}, {69632, 4},
+        {69635, 1}, {69688, 4}, {69703, 0}, {69744, 4}, {69745, 1}, {69747, 4},
+        {69749, 1}, {69750, 0}, {69759, 4}, {69763, 1}, {69808, 4}, {69819, 0},
+        {69821, 4}, {69822, 0}, {69826, 4}, {69827, 0}, {69837, 4}, {69838, 0},
+        {69840, 1}, {69865, 0}, {69888, 4}, {69891, 1}, {69927, 4}, {69941, 0},
+        {69956, 1}, {69957, 4}, {69959, 1}, {69960, 0}, {69968, 1}, {70003, 4},
+        {70004, 0}, {70006, 1}, {70007, 0}, {70016, 4}, {70019, 1}, {70067, 4},
+        {70081, 1}, {70085, 0}, {70089, 4}, {70093, 0}, {70094, 4}, {70096, 0},
+        {70106, 1}, {70107, 0}, {70108, 1}, {70109, 0}, {70144, 1}, {70162, 0},
+        {70163, 1}, {70188, 4}, {70200, 0}, {70206, 4}, {70207, 0}, {70272, 1},
+        {70279, 0}, {70280, 1}, {70281, 0}, {70282, 1}, {70286, 0}, {70287, 1},
+        {70302, 0}, {70303, 1}, {70313, 0}, {70320, 1}, {70367, 4}, {70379, 0},
+        {70400, 4}, {70404, 0}, {70405, 1}, {70413, 0}, {70415, 1}, {70417, 0},
+        {70419, 1}, {70441, 0}, {70442, 1}, {70449, 0}, {70450, 1}, {70452, 0},
+        {70453, 1}, {70458, 0}, {70459, 4}, {70461, 1}, {70462, 4}, {70469, 0},
+        {70471, 4}, {70473, 0}, {70475, 4}, {70478, 0}, {70480, 1}, {70481, 0},
+        {70487, 4}, {70488, 0}, {70493, 1}, {70498, 4}, {70500, 0}, {70502, 4},
+        {70509, 0}, {70512, 4}, {70517, 0}, {70656, 1}, {70709, 4}, {70727, 1},
+        {70731, 0}, {70750, 4}, {70751, 1}, {70754, 0}, {70784, 1}, {70832, 4},
+        {70852, 1}, {70854, 0}, {70855, 1}, {70856, 0}, {71040, 1}, {71087, 4},
+        {71094, 0}, {71096, 4}, {71105, 0}, {71128, 1}, {71132, 4}, {71134, 0},
+        {71168, 1}, {71216, 4}, {71233, 0}, {71236, 1}, {71237, 0}, {71296, 1},
+        {71339, 4}, {71352, 1}, {71353, 0}, {71424, 1}, {71451, 0}, {71453, 4},
+        {71468, 0}, {71488, 1}, {71495, 0}, {71680, 1}, {71724, 4}, {71739, 0},
+        {71840, 1}, {71904, 0}, {71935, 1}, {71943, 0}, {71945, 1}, {71946, 0},
+        {71948, 1}, {71956, 0}, {71957, 1}, {71959, 0}, {71960, 1}, {71984, 4},
+        {71990, 0}, {71991, 4}, {71993, 0}, {71995, 4}, {71999, 1}, {72000, 4},
+        {72001, 1}, {72002, 4}, {72004, 0}, {72096, 1}, {72104, 0}, {72106, 1},
+        {72145, 4}, {72152, 0}, {72154, 4}, {72161, 1}, {72162, 0}, {72163, 1},
+        {72164, 4}, {72165, 0}, {72192, 1}, {72193, 4}, {72203, 1}, {72243, 4},
+        {72250, 1}, {72251, 4}, {72255, 0}, {72263, 4}, {72264, 0}, {72272, 1},
+        {72273, 4}, {72284, 1}, {72330, 4}, {72346, 0}, {72349, 1}, {72350, 0},
+        {72368, 1}, {72441, 0}, {72704, 1}, {72713, 0}, {72714, 1}, {72751, 4},
+        {72759, 0}, {72760, 4}, {72768, 1}, {72769, 0}, {72818, 1}, {72848, 0},
+        {72850, 4}, {72872, 0}, {72873, 4}, {72887, 0}, {72960, 1}, {72967, 0},
+        {72968, 1}, {72970, 0}, {72971, 1}, {73009, 4}, {73015, 0}, {73018, 4},
+        {73019, 0}, {73020, 4}, {73022, 0}, {73023, 4}, {73030, 1}, {73031, 4},
+        {73032, 0}, {73056, 1}, {73062, 0}, {73063, 1}, {73065, 0}, {73066, 1},
+        {73098, 4}, {73103, 0}, {73104, 4}, {73106, 0}, {73107, 4}, {73112, 1},
+        {73113, 0}, {73440, 1}, {73459, 4}, {73463, 0}, {73648, 1}, {73649, 0},
+        {73728, 1}, {74650, 0}, {74752, 1}, {74863, 0}, {74880, 1}, {75076, 0},
+        {77712, 1}, {77809, 0}, {77824, 1}, {78895, 0}, {78896, 4}, {78905, 0},
+        {82944, 1}, {83527, 0}, {92160, 1}, {92729, 0}, {92736, 1}, {92767, 0},
+        {92784, 1}, {92863, 0}, {92880, 1}, {92910, 0}, {92912, 4}, {92917, 0},
+        {92928, 1}, {92976, 4}, {92983, 0}, {92992, 1}, {92996, 0}, {93027, 1},
+        {93048, 0}, {93053, 1}, {93072, 0}, {93760, 1}, {93824, 0}, {93952, 1},
+        {94027, 0}, {94031, 4}, {94032, 1}, {94033, 4}, {94088, 0}, {94095, 4},
+        {94099, 1}, {94112, 0}, {94176, 1}, {94178, 0}, {94179, 1}, {94180, 4},
+        {94181, 0}, {94192, 4}, {94194, 0}, {94208, 1}, {100344, 0}, {100352, 1},
+        {101590, 0}, {101632, 1}, {101641, 0}, {110576, 2}, {110580, 0}, {110581, 2},
+        {110588, 0}, {110589, 2}, {110591, 0}, {110592, 2}, {110593, 3}, {110594, 1},
+        {110879, 3}, {110880, 2}, {110883, 0}, {110928, 3}, {110931, 0}, {110948, 2},
+        {110952, 0}, {110960, 1}, {111356, 0}, {113664, 1}, {113771, 0}, {113776, 1},
+        {113789, 0}, {113792, 1}, {113801, 0}, {113808, 1}, {113818, 0}, {113821, 4},
+        {113823, 0}, {113824, 4}, {113828, 0}, {118528, 4}, {118574, 0}, {118576, 4},
+        {118599, 0}, {119141, 4}, {119146, 0}, {119149, 4}, {119171, 0}, {119173, 4},
+        {119180, 0}, {119210, 4}, {119214, 0}, {119362, 4}, {119365, 0}, {119808, 1},
+        {119893, 0}, {119894, 1}, {119965, 0}, {119966, 1}, {119968, 0}, {119970, 1},
+        {119971, 0}, {119973, 1}, {119975, 0}, {119977, 1}, {119981, 0}, {119982, 1},
+        {119994, 0}, {119995, 1}, {119996, 0}, {119997, 1}, {120004, 0}, {120005, 1},
+        {120070, 0}, {120071, 1}, {120075, 0}, {120077, 1}, {120085, 0}, {120086, 1},
+        {120093, 0}, {120094, 1}, {120122, 0}, {120123, 1}, {120127, 0}, {120128, 1},
+        {120133, 0}, {120134, 1}, {120135, 0}, {120138, 1}, {120145, 0}, {120146, 1},
+        {120486, 0}, {120488, 1}, {120513, 0}, {120514, 1}, {120539, 0}, {120540, 1},
+        {120571, 0}, {120572, 1}, {120597, 0}, {120598, 1}, {120629, 0}, {120630, 1},
+        {120655, 0}, {120656, 1}, {120687, 0}, {120688, 1}, {120713, 0}, {120714, 1},
+        {120745, 0}, {120746, 1}, {120771, 0}, {120772, 1}, {120780, 0}, {121344, 4},
+        {121399, 0}, {121403, 4}, {121453, 0}, {121461, 4}, {121462, 0}, {121476, 4},
+        {121477, 0}, {121499, 4}, {121504, 0}, {121505, 4}, {121520, 0}, {122624, 1},
+        {122655, 0}, {122880, 4}, {122887, 0}, {122888, 4}, {122905, 0}, {122907, 4},
+        {122914, 0}, {122915, 4}, {122917, 0}, {122918, 4}, {122923, 0}, {123136, 1},
+        {123181, 0}, {123184, 4}, {123191, 1}, {123198, 0}, {123214, 1}, {123215, 0},
+        {123536, 1}, {123566, 4}, {123567, 0}, {123584, 1}, {123628, 4}, {123632, 0},
+        {124896, 1}, {124903, 0}, {124904, 1}, {124908, 0}, {124909, 1}, {124911, 0},
+        {124912, 1}, {124927, 0}, {124928, 1}, {125125, 0}, {125136, 4}, {125143, 0},
+        {125184, 1}, {125252, 4}, {125259, 1}, {125260, 0}, {126464, 1}, {126468, 0},
+        {126469, 1}, {126496, 0}, {126497, 1}, {126499, 0}, {126500, 1}, {126501, 0},
+        {126503, 1}, {126504, 0}, {126505, 1}, {126515, 0}, {126516, 1}, {126520, 0},
+        {126521, 1}, {126522, 0}, {126523, 1}, {126524, 0}, {126530, 1}, {126531, 0},
+        {126535, 1}, {126536, 0}, {126537, 1}, {126538, 0}, {126539, 1}, {126540, 0},
+        {126541, 1}, {126544, 0}, {126545, 1}, {126547, 0}, {126548, 1}, {126549, 0},
+        {126551, 1}, {126552, 0}, {126553, 1}, {126554, 0}, {126555, 1}, {126556, 0},
+        {126557, 1}, {126558, 0}, {126559, 1}, {126560, 0}, {126561, 1}, {126563, 0},
+        {126564, 1}, {126565, 0}, {126567, 1}, {126571, 0}, {126572, 1}, {126579, 0},
+        {126580, 1}, {126584, 0}, {126585, 1}, {126589, 0}, {126590, 1}, {126591, 0},
+        {126592, 1}, {126602, 0}, {126603, 1}, {126620, 0}, {126625, 1}, {126628, 0},
+        {126629, 1}, {126634, 0}, {126635, 1}, {126652, 0}, {131072, 3}, {173792, 0},
+        {173824, 3}, {177977, 0}, {177984, 3}, {178206, 0}, {178208, 3}, {183970, 0},
+        {183984, 3}, {191457, 0}, {194560, 3}, {195102, 0}, {196608, 3}, {201547, 0},
+        {917505, 4}, {917506, 0}, {917536, 4}, {917632, 0}, {917760, 4}, {918000, 0},
+    };
+
+    constexpr Range CombiningClasses[] = {
+        {0, 0}, {768, 230}, {789, 232}, {790, 220}, {794, 232}, {795, 216},
+        {796, 220}, {801, 202}, {803, 220}, {807, 202}, {809, 220}, {820, 1},
+        {825, 220}, {829, 230}, {837, 240}, {838, 230}, {839, 220}, {842, 230},
+        {845, 220}, {847, 0}, {848, 230}, {851, 220}, {855, 230}, {856, 232},
+        {857, 220}, {859, 230}, {860, 233}, {861, 234}, {863, 233}, {864, 234},
+        {866, 233}, {867, 230}, {880, 0}, {1155, 230}, {1160, 0}, {1425, 220},
+        {1426, 230}, {1430, 220}, {1431, 230}, {1434, 222}, {1435, 220}, {1436, 230},
+        {1442, 220}, {1448, 230}, {1450, 220}, {1451, 230}, {1453, 222}, {1454, 228},
+        {1455, 230}, {1456, 10}, {1457, 11}, {1458, 12}, {1459, 13}, {1460, 14},
+        {1461, 15}, {1462, 16}, {1463, 17}, {1464, 18}, {1465, 19}, {1467, 20},
+        {1468, 21}, {1469, 22}, {1470, 0}, {1471, 23}, {1472, 0}, {1473, 24},
+        {1474, 25}, {1475, 0}, {1476, 230}, {1477, 220}, {1478, 0}, {1479, 18},
+        {1480, 0}, {1552, 230}, {1560, 30}, {1561, 31}, {1562, 32}, {1563, 0},
+        {1611, 27}, {1612, 28}, {1613, 29}, {1614, 30}, {1615, 31}, {1616, 32},
+        {1617, 33}, {1618, 34}, {1619, 230}, {1621, 220}, {1623, 230}, {1628, 220},
+        {1629, 230}, {1631, 220}, {1632, 0}, {1648, 35}, {1649, 0}, {1750, 230},
+        {1757, 0}, {1759, 230}, {1763, 220}, {1764, 230}, {1765, 0}, {1767, 230},
+        {1769, 0}, {1770, 220}, {1771, 230}, {1773, 220}, {1774, 0}, {1809, 36},
+        {1810, 0}, {1840, 230}, {1841, 220}, {1842, 230}, {1844, 220}, {1845, 230},
+        {1847, 220}, {1850, 230}, {1851, 220}, {1853, 230}, {1854, 220}, {1855, 230},
+        {1858, 220}, {1859, 230}, {1860, 220}, {1861, 230}, {1862, 220}, {1863, 230},
+        {1864, 220}, {1865, 230}, {1867, 0}, {2027, 230}, {2034, 220}, {2035, 230},
+        {2036, 0}, {2045, 220}, {2046, 0}, {2070, 230}, {2074, 0}, {2075, 230},
+        {2084, 0}, {2085, 230}, {2088, 0}, {2089, 230}, {2094, 0}, {2137, 220},
+        {2140, 0}, {2200, 230}, {2201, 220}, {2204, 230}, {2208, 0}, {2250, 230},
+        {2255, 220}, {2260, 230}, {2274, 0}, {2275, 220}, {2276, 230}, {2278, 220},
+        {2279, 230}, {2281, 220}, {2282, 230}, {2285, 220}, {2288, 27}, {2289, 28},
+        {2290, 29}, {2291, 230}, {2294, 220}, {2295, 230}, {2297, 220}, {2299, 230},
+        {2304, 0}, {2364, 7}, {2365, 0}, {2381, 9}, {2382, 0}, {2385, 230},
+        {2386, 220}, {2387, 230}, {2389, 0}, {2492, 7}, {2493, 0}, {2509, 9},
+        {2510, 0}, {2558, 230}, {2559, 0}, {2620, 7}, {2621, 0}, {2637, 9},
+        {2638, 0}, {2748, 7}, {2749, 0}, {2765, 9}, {2766, 0}, {2876, 7},
+        {2877, 0}, {2893, 9}, {2894, 0}, {3021, 9}, {3022, 0}, {3132, 7},
+        {3133, 0}, {3149, 9}, {3150, 0}, {3157, 84}, {3158, 91}, {3159, 0},
+        {3260, 7}, {3261, 0}, {3277, 9}, {3278, 0}, {3387, 9}, {3389, 0},
+        {3405, 9}, {3406, 0}, {3530, 9}, {3531, 0}, {3640, 103}, {3642, 9},
+        {3643, 0}, {3656, 107}, {3660, 0}, {3768, 118}, {3770, 9}, {3771, 0},
+        {3784, 122}, {3788, 0}, {3864, 220}, {3866, 0}, {3893, 220}, {3894, 0},
+        {3895, 220}, {3896, 0}, {3897, 216}, {3898, 0}, {3953, 129}, {3954, 130},
+        {3955, 0}, {3956, 132}, {3957, 0}, {3962, 130}, {3966, 0}, {3968, 130},
+        {3969, 0}, {3970, 230}, {3972, 9}, {3973, 0}, {3974, 230}, {3976, 0},
+        {4038, 220}, {4039, 0}, {4151, 7}, {4152, 0}, {4153, 9}, {4155, 0},
+        {4237, 220}, {4238, 0}, {4957, 230}, {4960, 0}, {5908, 9}, {5910, 0},
+        {5940, 9}, {5941, 0}, {6098, 9}, {6099, 0}, {6109, 230}, {6110, 0},
+        {6313, 228}, {6314, 0}, {6457, 222}, {6458, 230}, {6459, 220}, {6460, 0},
+        {6679, 230}, {6680, 220}, {6681, 0}, {6752, 9}, {6753, 0}, {6773, 230},
+        {6781, 0}, {6783, 220}, {6784, 0}, {6832, 230}, {6837, 220}, {6843, 230},
+        {6845, 220}, {6846, 0}, {6847, 220}, {6849, 230}, {6851, 220}, {6853, 230},
+        {6858, 220}, {6859, 230}, {6863, 0}, {6964, 7}, {6965, 0}, {6980, 9},
+        {6981, 0}, {7019, 230}, {7020, 220}, {7021, 230}, {7028, 0}, {7082, 9},
+        {7084, 0}, {7142, 7}, {7143, 0}, {7154, 9}, {7156, 0}, {7223, 7},
+        {7224, 0}, {7376, 230}, {7379, 0}, {7380, 1}, {7381, 220}, {7386, 230},
+        {7388, 220}, {7392, 230}, {7393, 0}, {7394, 1}, {7401, 0}, {7405, 220},
+        {7406, 0}, {7412, 230}, {7413, 0}, {7416, 230}, {7418, 0}, {7616, 230},
+        {7618, 220}, {7619, 230}, {7626, 220}, {7627, 230}, {7629, 234}, {7630, 214},
+        {7631, 220}, {7632, 202}, {7633, 230}, {7670, 232}, {7671, 228}, {7673, 220},
+        {7674, 218}, {7675, 230}, {7676, 233}, {7677, 220}, {7678, 230}, {7679, 220},
+        {7680, 0}, {8400, 230}, {8402, 1}, {8404, 230}, {8408, 1}, {8411, 230},
+        {8413, 0}, {8417, 230}, {8418, 0}, {8421, 1}, {8423, 230}, {8424, 220},
+        {8425, 230}, {8426, 1}, {8428, 220}, {8432, 230}, {8433, 0}, {11503, 230},
+        {11506, 0}, {11647, 9}, {11648, 0}, {11744, 230}, {11776, 0}, {12330, 218},
+        {12331, 228}, {12332, 232}, {12333, 222}, {12334, 224}, {12336, 0}, {12441, 8},
+        {12443, 0}, {42607, 230}, {42608, 0}, {42612, 230}, {42622, 0}, {42654, 230},
+        {42656, 0}, {42736, 230}, {42738, 0}, {43014, 9}, {43015, 0}, {43052, 9},
+        {43053, 0}, {43204, 9}, {43205, 0}, {43232, 230}, {43250, 0}, {43307, 220},
+        {43310, 0}, {43347, 9}, {43348, 0}, {43443, 7}, {43444, 0}, {43456, 9},
+        {43457, 0}, {43696, 230}, {43697, 0}, {43698, 230}, {43700, 220}, {43701, 0},
+        {43703, 230}, {43705, 0}, {43710, 230}, {43712, 0}, {43713, 230}, {43714, 0},
+        {43766, 9}, {43767, 0}, {44013, 9}, {44014, 0}, {64286, 26}, {64287, 0},
+        {65056, 230}, {65063, 220}, {65070, 230}, {65072, 0}, {66045, 220}, {66046, 0},
+        {66272, 220}, {66273, 0}, {66422, 230}, {66427, 0}, {68109, 220}, {68110, 0},
+        {68111, 230}, {68112, 0}, {68152, 230}, {68153, 1}, {68154, 220}, {68155, 0},
+        {68159, 9}, {68160, 0}, {68325, 230}, {68326, 220}, {68327, 0}, {68900, 230},
+        {68904, 0}, {69291, 230}, {69293, 0}, {69446, 220}, {69448, 230}, {69451, 220},
+        {69452, 230}, {69453, 220}, {69457, 0}, {69506, 230}, {69507, 220}, {69508, 230},
+        {69509, 220}, {69510, 0}, {69702, 9}, {69703, 0}, {69744, 9}, {69745, 0},
+        {69759, 9}, {69760, 0}, {69817, 9}, {69818, 7}, {69819, 0}, {69888, 230},
+        {69891, 0}, {69939, 9}, {69941, 0}, {70003, 7}, {70004, 0}, {70080, 9},
+        {70081, 0}, {70090, 7}, {70091, 0}, {70197, 9}, {70198, 7}, {70199, 0},
+        {70377, 7}, {70378, 9}, {70379, 0}, {70459, 7}, {70461, 0}, {70477, 9},
+        {70478, 0}, {70502, 230}, {70509, 0}, {70512, 230}, {70517, 0}, {70722, 9},
+        {70723, 0}, {70726, 7}, {70727, 0}, {70750, 230}, {70751, 0}, {70850, 9},
+        {70851, 7}, {70852, 0}, {71103, 9}, {71104, 7}, {71105, 0}, {71231, 9},
+        {71232, 0}, {71350, 9}, {71351, 7}, {71352, 0}, {71467, 9}, {71468, 0},
+        {71737, 9}, {71738, 7}, {71739, 0}, {71997, 9}, {71999, 0}, {72003, 7},
+        {72004, 0}, {72160, 9}, {72161, 0}, {72244, 9}, {72245, 0}, {72263, 9},
+        {72264, 0}, {72345, 9}, {72346, 0}, {72767, 9}, {72768, 0}, {73026, 7},
+        {73027, 0}, {73028, 9}, {73030, 0}, {73111, 9}, {73112, 0}, {92912, 1},
+        {92917, 0}, {92976, 230}, {92983, 0}, {94192, 6}, {94194, 0}, {113822, 1},
+        {113823, 0}, {119141, 216}, {119143, 1}, {119146, 0}, {119149, 226}, {119150, 216},
+        {119155, 0}, {119163, 220}, {119171, 0}, {119173, 230}, {119178, 220}, {119180, 0},
+        {119210, 230}, {119214, 0}, {119362, 230}, {119365, 0}, {122880, 230}, {122887, 0},
+        {122888, 230}, {122905, 0}, {122907, 230}, {122914, 0}, {122915, 230}, {122917, 0},
+        {122918, 230}, {122923, 0}, {123184, 230}, {123191, 0}, {123566, 230}, {123567, 0},
+        {123628, 230}, {123632, 0}, {125136, 220}, {125143, 0}, {125252, 230}, {125258, 7},
+        {125259, 0},
+    };
+
+    constexpr Range Unstable[] = {
+        {0, 0}, {768, 1}, {847, 0}, {848, 1}, {880, 0}, {884, 1},
+        {885, 0}, {894, 1}, {895, 0}, {903, 1}, {904, 0}, {1155, 1},
+        {1160, 0}, {1425, 1}, {1470, 0}, {1471, 1}, {1472, 0}, {1473, 1},
+        {1475, 0}, {1476, 1}, {1478, 0}, {1479, 1}, {1480, 0}, {1552, 1},
+        {1563, 0}, {1611, 1}, {1632, 0}, {1648, 1}, {1649, 0}, {1750, 1},
+        {1757, 0}, {1759, 1}, {1765, 0}, {1767, 1}, {1769, 0}, {1770, 1},
+        {1774, 0}, {1809, 1}, {1810, 0}, {1840, 1}, {1867, 0}, {2027, 1},
+        {2036, 0}, {2045, 1}, {2046, 0}, {2070, 1}, {2074, 0}, {2075, 1},
+        {2084, 0}, {2085, 1}, {2088, 0}, {2089, 1}, {2094, 0}, {2137, 1},
+        {2140, 0}, {2200, 1}, {2208, 0}, {2250, 1}, {2274, 0}, {2275, 1},
+        {2304, 0}, {2364, 1}, {2365, 0}, {2381, 1}, {2382, 0}, {2385, 1},
+        {2389, 0}, {2392, 1}, {2400, 0}, {2492, 1}, {2493, 0}, {2494, 1},
+        {2495, 0}, {2509, 1}, {2510, 0}, {2519, 1}, {2520, 0}, {2524, 1},
+        {2526, 0}, {2527, 1}, {2528, 0}, {2558, 1}, {2559, 0}, {2611, 1},
+        {2612, 0}, {2614, 1}, {2615, 0}, {2620, 1}, {2621, 0}, {2637, 1},
+        {2638, 0}, {2649, 1}, {2652, 0}, {2654, 1}, {2655, 0}, {2748, 1},
+        {2749, 0}, {2765, 1}, {2766, 0}, {2876, 1}, {2877, 0}, {2878, 1},
+        {2879, 0}, {2893, 1}, {2894, 0}, {2902, 1}, {2904, 0}, {2908, 1},
+        {2910, 0}, {3006, 1}, {3007, 0}, {3021, 1}, {3022, 0}, {3031, 1},
+        {3032, 0}, {3132, 1}, {3133, 0}, {3149, 1}, {3150, 0}, {3157, 1},
+        {3159, 0}, {3260, 1}, {3261, 0}, {3266, 1}, {3267, 0}, {3277, 1},
+        {3278, 0}, {3285, 1}, {3287, 0}, {3387, 1}, {3389, 0}, {3390, 1},
+        {3391, 0}, {3405, 1}, {3406, 0}, {3415, 1}, {3416, 0}, {3530, 1},
+        {3531, 0}, {3535, 1}, {3536, 0}, {3551, 1}, {3552, 0}, {3640, 1},
+        {3643, 0}, {3656, 1}, {3660, 0}, {3768, 1}, {3771, 0}, {3784, 1},
+        {3788, 0}, {3864, 1}, {3866, 0}, {3893, 1}, {3894, 0}, {3895, 1},
+        {3896, 0}, {3897, 1}, {3898, 0}, {3907, 1}, {3908, 0}, {3917, 1},
+        {3918, 0}, {3922, 1}, {3923, 0}, {3927, 1}, {3928, 0}, {3932, 1},
+        {3933, 0}, {3945, 1}, {3946, 0}, {3953, 1}, {3959, 0}, {3960, 1},
+        {3961, 0}, {3962, 1}, {3966, 0}, {3968, 1}, {3973, 0}, {3974, 1},
+        {3976, 0}, {3987, 1}, {3988, 0}, {3997, 1}, {3998, 0}, {4002, 1},
+        {4003, 0}, {4007, 1}, {4008, 0}, {4012, 1}, {4013, 0}, {4025, 1},
+        {4026, 0}, {4038, 1}, {4039, 0}, {4142, 1}, {4143, 0}, {4151, 1},
+        {4152, 0}, {4153, 1}, {4155, 0}, {4237, 1}, {4238, 0}, {4449, 1},
+        {4470, 0}, {4520, 1}, {4547, 0}, {4957, 1}, {4960, 0}, {5908, 1},
+        {5910, 0}, {5940, 1}, {5941, 0}, {6098, 1}, {6099, 0}, {6109, 1},
+        {6110, 0}, {6313, 1}, {6314, 0}, {6457, 1}, {6460, 0}, {6679, 1},
+        {6681, 0}, {6752, 1}, {6753, 0}, {6773, 1}, {6781, 0}, {6783, 1},
+        {6784, 0}, {6832, 1}, {6846, 0}, {6847, 1}, {6863, 0}, {6964, 1},
+        {6966, 0}, {6980, 1}, {6981, 0}, {7019, 1}, {7028, 0}, {7082, 1},
+        {7084, 0}, {7142, 1}, {7143, 0}, {7154, 1}, {7156, 0}, {7223, 1},
+        {7224, 0}, {7376, 1}, {7379, 0}, {7380, 1}, {7393, 0}, {7394, 1},
+        {7401, 0}, {7405, 1}, {7406, 0}, {7412, 1}, {7413, 0}, {7416, 1},
+        {7418, 0}, {7616, 1}, {7680, 0}, {8049, 1}, {8050, 0}, {8051, 1},
+        {8052, 0}, {8053, 1}, {8054, 0}, {8055, 1}, {8056, 0}, {8057, 1},
+        {8058, 0}, {8059, 1}, {8060, 0}, {8061, 1}, {8062, 0}, {8123, 1},
+        {8124, 0}, {8126, 1}, {8127, 0}, {8137, 1}, {8138, 0}, {8139, 1},
+        {8140, 0}, {8147, 1}, {8148, 0}, {8155, 1}, {8156, 0}, {8163, 1},
+        {8164, 0}, {8171, 1}, {8172, 0}, {8174, 1}, {8176, 0}, {8185, 1},
+        {8186, 0}, {8187, 1}, {8188, 0}, {8189, 1}, {8190, 0}, {8192, 1},
+        {8194, 0}, {8400, 1}, {8413, 0}, {8417, 1}, {8418, 0}, {8421, 1},
+        {8433, 0}, {8486, 1}, {8487, 0}, {8490, 1}, {8492, 0}, {9001, 1},
+        {9003, 0}, {10972, 1}, {10973, 0}, {11503, 1}, {11506, 0}, {11647, 1},
+        {11648, 0}, {11744, 1}, {11776, 0}, {12330, 1}, {12336, 0}, {12441, 1},
+        {12443, 0}, {42607, 1}, {42608, 0}, {42612, 1}, {42622, 0}, {42654, 1},
+        {42656, 0}, {42736, 1}, {42738, 0}, {43014, 1}, {43015, 0}, {43052, 1},
+        {43053, 0}, {43204, 1}, {43205, 0}, {43232, 1}, {43250, 0}, {43307, 1},
+        {43310, 0}, {43347, 1}, {43348, 0}, {43443, 1}, {43444, 0}, {43456, 1},
+        {43457, 0}, {43696, 1}, {43697, 0}, {43698, 1}, {43701, 0}, {43703, 1},
+        {43705, 0}, {43710, 1}, {43712, 0}, {43713, 1}, {43714, 0}, {43766, 1},
+        {43767, 0}, {44013, 1}, {44014, 0}, {63744, 1}, {64014, 0}, {64016, 1},
+        {64017, 0}, {64018, 1}, {64019, 0}, {64021, 1}, {64031, 0}, {64032, 1},
+        {64033, 0}, {64034, 1}, {64035, 0}, {64037, 1}, {64039, 0}, {64042, 1},
+        {64110, 0}, {64112, 1}, {64218, 0}, {64285, 1}, {64288, 0}, {64298, 1},
+        {64311, 0}, {64312, 1}, {64317, 0}, {64318, 1}, {64319, 0}, {64320, 1},
+        {64322, 0}, {64323, 1}, {64325, 0}, {64326, 1}, {64335, 0}, {65056, 1},
+        {65072, 0}, {66045, 1}, {66046, 0}, {66272, 1}, {66273, 0}, {66422, 1},
+        {66427, 0}, {68109, 1}, {68110, 0}, {68111, 1}, {68112, 0}, {68152, 1},
+        {68155, 0}, {68159, 1}, {68160, 0}, {68325, 1}, {68327, 0}, {68900, 1},
+        {68904, 0}, {69291, 1}, {69293, 0}, {69446, 1}, {69457, 0}, {69506, 1},
+        {69510, 0}, {69702, 1}, {69703, 0}, {69744, 1}, {69745, 0}, {69759, 1},
+        {69760, 0}, {69817, 1}, {69819, 0}, {69888, 1}, {69891, 0}, {69927, 1},
+        {69928, 0}, {69939, 1}, {69941, 0}, {70003, 1}, {70004, 0}, {70080, 1},
+        {70081, 0}, {70090, 1}, {70091, 0}, {70197, 1}, {70199, 0}, {70377, 1},
+        {70379, 0}, {70459, 1}, {70461, 0}, {70462, 1}, {70463, 0}, {70477, 1},
+        {70478, 0}, {70487, 1}, {70488, 0}, {70502, 1}, {70509, 0}, {70512, 1},
+        {70517, 0}, {70722, 1}, {70723, 0}, {70726, 1}, {70727, 0}, {70750, 1},
+        {70751, 0}, {70832, 1}, {70833, 0}, {70842, 1}, {70843, 0}, {70845, 1},
+        {70846, 0}, {70850, 1}, {70852, 0}, {71087, 1}, {71088, 0}, {71103, 1},
+        {71105, 0}, {71231, 1}, {71232, 0}, {71350, 1}, {71352, 0}, {71467, 1},
+        {71468, 0}, {71737, 1}, {71739, 0}, {71984, 1}, {71985, 0}, {71997, 1},
+        {71999, 0}, {72003, 1}, {72004, 0}, {72160, 1}, {72161, 0}, {72244, 1},
+        {72245, 0}, {72263, 1}, {72264, 0}, {72345, 1}, {72346, 0}, {72767, 1},
+        {72768, 0}, {73026, 1}, {73027, 0}, {73028, 1}, {73030, 0}, {73111, 1},
+        {73112, 0}, {92912, 1}, {92917, 0}, {92976, 1}, {92983, 0}, {94192, 1},
+        {94194, 0}, {113822, 1}, {113823, 0}, {119134, 1}, {119146, 0}, {119149, 1},
+        {119155, 0}, {119163, 1}, {119171, 0}, {119173, 1}, {119180, 0}, {119210, 1},
+        {119214, 0}, {119227, 1}, {119233, 0}, {119362, 1}, {119365, 0}, {122880, 1},
+        {122887, 0}, {122888, 1}, {122905, 0}, {122907, 1}, {122914, 0}, {122915, 1},
+        {122917, 0}, {122918, 1}, {122923, 0}, {123184, 1}, {123191, 0}, {123566, 1},
+        {123567, 0}, {123628, 1}, {123632, 0}, {125136, 1}, {125143, 0}, {125252, 1},
+        {125259, 0}, {194560, 1}, {195102, 0},
+    };
+
+    constexpr Mapping Folds[] = {
+        {65, 97}, {66, 98}, {67, 99}, {68, 100}, {69, 101}, {70, 102},
+        {71, 103}, {72, 104}, {73, 105}, {74, 106}, {75, 107}, {76, 108},
+        {77, 109}, {78, 110}, {79, 111}, {80, 112}, {81, 113}, {82, 114},
+        {83, 115}, {84, 116}, {85, 117}, {86, 118}, {87, 119}, {88, 120},
+        {89, 121}, {90, 122}, {181, 956}, {192, 224}, {193, 225}, {194, 226},
+        {195, 227}, {196, 228}, {197, 229}, {198, 230}, {199, 231}, {200, 232},
+        {201, 233}, {202, 234}, {203, 235}, {204, 236}, {205, 237}, {206, 238},
+        {207, 239}, {208, 240}, {209, 241}, {210, 242}, {211, 243}, {212, 244},
+        {213, 245}, {214, 246}, {216, 248}, {217, 249}, {218, 250}, {219, 251},
+        {220, 252}, {221, 253}, {222, 254}, {256, 257}, {258, 259}, {260, 261},
+        {262, 263}, {264, 265}, {266, 267}, {268, 269}, {270, 271}, {272, 273},
+        {274, 275}, {276, 277}, {278, 279}, {280, 281}, {282, 283}, {284, 285},
+        {286, 287}, {288, 289}, {290, 291}, {292, 293}, {294, 295}, {296, 297},
+        {298, 299}, {300, 301}, {302, 303}, {306, 307}, {308, 309}, {310, 311},
+        {313, 314}, {315, 316}, {317, 318}, {319, 320}, {321, 322}, {323, 324},
+        {325, 326}, {327, 328}, {330, 331}, {332, 333}, {334, 335}, {336, 337},
+        {338, 339}, {340, 341}, {342, 343}, {344, 345}, {346, 347}, {348, 349},
+        {350, 351}, {352, 353}, {354, 355}, {356, 357}, {358, 359}, {360, 361},
+        {362, 363}, {364, 365}, {366, 367}, {368, 369}, {370, 371}, {372, 373},
+        {374, 375}, {376, 255}, {377, 378}, {379, 380}, {381, 382}, {383, 115},
+        {385, 595}, {386, 387}, {388, 389}, {390, 596}, {391, 392}, {393, 598},
+        {394, 599}, {395, 396}, {398, 477}, {399, 601}, {400, 603}, {401, 402},
+        {403, 608}, {404, 611}, {406, 617}, {407, 616}, {408, 409}, {412, 623},
+        {413, 626}, {415, 629}, {416, 417}, {418, 419}, {420, 421}, {422, 640},
+        {423, 424}, {425, 643}, {428, 429}, {430, 648}, {431, 432}, {433, 650},
+        {434, 651}, {435, 436}, {437, 438}, {439, 658}, {440, 441}, {444, 445},
+        {452, 454}, {453, 454}, {455, 457}, {456, 457}, {458, 460}, {459, 460},
+        {461, 462}, {463, 464}, {465, 466}, {467, 468}, {469, 470}, {471, 472},
+        {473, 474}, {475, 476}, {478, 479}, {480, 481}, {482, 483}, {484, 485},
+        {486, 487}, {488, 489}, {490, 491}, {492, 493}, {494, 495}, {497, 499},
+        {498, 499}, {500, 501}, {502, 405}, {503, 447}, {504, 505}, {506, 507},
+        {508, 509}, {510, 511}, {512, 513}, {514, 515}, {516, 517}, {518, 519},
+        {520, 521}, {522, 523}, {524, 525}, {526, 527}, {528, 529}, {530, 531},
+        {532, 533}, {534, 535}, {536, 537}, {538, 539}, {540, 541}, {542, 543},
+        {544, 414}, {546, 547}, {548, 549}, {550, 551}, {552, 553}, {554, 555},
+        {556, 557}, {558, 559}, {560, 561}, {562, 563}, {570, 11365}, {571, 572},
+        {573, 410}, {574, 11366}, {577, 578}, {579, 384}, {580, 649}, {581, 652},
+        {582, 583}, {584, 585}, {586, 587}, {588, 589}, {590, 591}, {837, 953},
+        {880, 881}, {882, 883}, {886, 887}, {895, 1011}, {902, 940}, {904, 941},
+        {905, 942}, {906, 943}, {908, 972}, {910, 973}, {911, 974}, {913, 945},
+        {914, 946}, {915, 947}, {916, 948}, {917, 949}, {918, 950}, {919, 951},
+        {920, 952}, {921, 953}, {922, 954}, {923, 955}, {924, 956}, {925, 957},
+        {926, 958}, {927, 959}, {928, 960}, {929, 961}, {931, 963}, {932, 964},
+        {933, 965}, {934, 966}, {935, 967}, {936, 968}, {937, 969}, {938, 970},
+        {939, 971}, {962, 963}, {975, 983}, {976, 946}, {977, 952}, {981, 966},
+        {982, 960}, {984, 985}, {986, 987}, {988, 989}, {990, 991}, {992, 993},
+        {994, 995}, {996, 997}, {998, 999}, {1000, 1001}, {1002, 1003}, {1004, 1005},
+        {1006, 1007}, {1008, 954}, {1009, 961}, {1012, 952}, {1013, 949}, {1015, 1016},
+        {1017, 1010}, {1018, 1019}, {1021, 891}, {1022, 892}, {1023, 893}, {1024, 1104},
+        {1025, 1105}, {1026, 1106}, {1027, 1107}, {1028, 1108}, {1029, 1109}, {1030, 1110},
+        {1031, 1111}, {1032, 1112}, {1033, 1113}, {1034, 1114}, {1035, 1115}, {1036, 1116},
+        {1037, 1117}, {1038, 1118}, {1039, 1119}, {1040, 1072}, {1041, 1073}, {1042, 1074},
+        {1043, 1075}, {1044, 1076}, {1045, 1077}, {1046, 1078}, {1047, 1079}, {1048, 1080},
+        {1049, 1081}, {1050, 1082}, {1051, 1083}, {1052, 1084}, {1053, 1085}, {1054, 1086},
+        {1055, 1087}, {1056, 1088}, {1057, 1089}, {1058, 1090}, {1059, 1091}, {1060, 1092},
+        {1061, 1093}, {1062, 1094}, {1063, 1095}, {1064, 1096}, {1065, 1097}, {1066, 1098},
+        {1067, 1099}, {1068, 1100}, {1069, 1101}, {1070, 1102}, {1071, 1103}, {1120, 1121},
+        {1122, 1123}, {1124, 1125}, {1126, 1127}, {1128, 1129}, {1130, 1131}, {1132, 1133},
+        {1134, 1135}, {1136, 1137}, {1138, 1139}, {1140, 1141}, {1142, 1143}, {1144, 1145},
+        {1146, 1147}, {1148, 1149}, {1150, 1151}, {1152, 1153}, {1162, 1163}, {1164, 1165},
+        {1166, 1167}, {1168, 1169}, {1170, 1171}, {1172, 1173}, {1174, 1175}, {1176, 1177},
+        {1178, 1179}, {1180, 1181}, {1182, 1183}, {1184, 1185}, {1186, 1187}, {1188, 1189},
+        {1190, 1191}, {1192, 1193}, {1194, 1195}, {1196, 1197}, {1198, 1199}, {1200, 1201},
+        {1202, 1203}, {1204, 1205}, {1206, 1207}, {1208, 1209}, {1210, 1211}, {1212, 1213},
+        {1214, 1215}, {1216, 1231}, {1217, 1218}, {1219, 1220}, {1221, 1222}, {1223, 1224},
+        {1225, 1226}, {1227, 1228}, {1229, 1230}, {1232, 1233}, {1234, 1235}, {1236, 1237},
+        {1238, 1239}, {1240, 1241}, {1242, 1243}, {1244, 1245}, {1246, 1247}, {1248, 1249},
+        {1250, 1251}, {1252, 1253}, {1254, 1255}, {1256, 1257}, {1258, 1259}, {1260, 1261},
+        {1262, 1263}, {1264, 1265}, {1266, 1267}, {1268, 1269}, {1270, 1271}, {1272, 1273},
+        {1274, 1275}, {1276, 1277}, {1278, 1279}, {1280, 1281}, {1282, 1283}, {1284, 1285},
+        {1286, 1287}, {1288, 1289}, {1290, 1291}, {1292, 1293}, {1294, 1295}, {1296, 1297},
+        {1298, 1299}, {1300, 1301}, {1302, 1303}, {1304, 1305}, {1306, 1307}, {1308, 1309},
+        {1310, 1311}, {1312, 1313}, {1314, 1315}, {1316, 1317}, {1318, 1319}, {1320, 1321},
+        {1322, 1323}, {1324, 1325}, {1326, 1327}, {1329, 1377}, {1330, 1378}, {1331, 1379},
+        {1332, 1380}, {1333, 1381}, {1334, 1382}, {1335, 1383}, {1336, 1384}, {1337, 1385},
+        {1338, 1386}, {1339, 1387}, {1340, 1388}, {1341, 1389}, {1342, 1390}, {1343, 1391},
+        {1344, 1392}, {1345, 1393}, {1346, 1394}, {1347, 1395}, {1348, 1396}, {1349, 1397},
+        {1350, 1398}, {1351, 1399}, {1352, 1400}, {1353, 1401}, {1354, 1402}, {1355, 1403},
+        {1356, 1404}, {1357, 1405}, {1358, 1406}, {1359, 1407}, {1360, 1408}, {1361, 1409},
+        {1362, 1410}, {1363, 1411}, {1364, 1412}, {1365, 1413}, {1366, 1414}, {4256, 11520},
+        {4257, 11521}, {4258, 11522}, {4259, 11523}, {4260, 11524}, {4261, 11525}, {4262, 11526},
+        {4263, 11527}, {4264, 11528}, {4265, 11529}, {4266, 11530}, {4267, 11531}, {4268, 11532},
+        {4269, 11533}, {4270, 11534}, {4271, 11535}, {4272, 11536}, {4273, 11537}, {4274, 11538},
+        {4275, 11539}, {4276, 11540}, {4277, 11541}, {4278, 11542}, {4279, 11543}, {4280, 11544},
+        {4281, 11545}, {4282, 11546}, {4283, 11547}, {4284, 11548}, {4285, 11549}, {4286, 11550},
+        {4287, 11551}, {4288, 11552}, {4289, 11553}, {4290, 11554}, {4291, 11555}, {4292, 11556},
+        {4293, 11557}, {4295, 11559}, {4301, 11565}, {5024, 43888}, {5025, 43889}, {5026, 43890},
+        {5027, 43891}, {5028, 43892}, {5029, 43893}, {5030, 43894}, {5031, 43895}, {5032, 43896},
+        {5033, 43897}, {5034, 43898}, {5035, 43899}, {5036, 43900}, {5037, 43901}, {5038, 43902},
+        {5039, 43903}, {5040, 43904}, {5041, 43905}, {5042, 43906}, {5043, 43907}, {5044, 43908},
+        {5045, 43909}, {5046, 43910}, {5047, 43911}, {5048, 43912}, {5049, 43913}, {5050, 43914},
+        {5051, 43915}, {5052, 43916}, {5053, 43917}, {5054, 43918}, {5055, 43919}, {5056, 43920},
+        {5057, 43921}, {5058, 43922}, {5059, 43923}, {5060, 43924}, {5061, 43925}, {5062, 43926},
+        {5063, 43927}, {5064, 43928}, {5065, 43929}, {5066, 43930}, {5067, 43931}, {5068, 43932},
+        {5069, 43933}, {5070, 43934}, {5071, 43935}, {5072, 43936}, {5073, 43937}, {5074, 43938},
+        {5075, 43939}, {5076, 43940}, {5077, 43941}, {5078, 43942}, {5079, 43943}, {5080, 43944},
+        {5081, 43945}, {5082, 43946}, {5083, 43947}, {5084, 43948}, {5085, 43949}, {5086, 43950},
+        {5087, 43951}, {5088, 43952}, {5089, 43953}, {5090, 43954}, {5091, 43955}, {5092, 43956},
+        {5093, 43957}, {5094, 43958}, {5095, 43959}, {5096, 43960}, {5097, 43961}, {5098, 43962},
+        {5099, 43963}, {5100, 43964}, {5101, 43965}, {5102, 43966}, {5103, 43967}, {5104, 5112},
+        {5105, 5113}, {5106, 5114}, {5107, 5115}, {5108, 5116}, {5109, 5117}, {5112, 5104},
+        {5113, 5105}, {5114, 5106}, {5115, 5107}, {5116, 5108}, {5117, 5109}, {7296, 1074},
+        {7297, 1076}, {7298, 1086}, {7299, 1089}, {7300, 1090}, {7301, 1090}, {7302, 1098},
+        {7303, 1123}, {7304, 42571}, {7312, 4304}, {7313, 4305}, {7314, 4306}, {7315, 4307},
+        {7316, 4308}, {7317, 4309}, {7318, 4310}, {7319, 4311}, {7320, 4312}, {7321, 4313},
+        {7322, 4314}, {7323, 4315}, {7324, 4316}, {7325, 4317}, {7326, 4318}, {7327, 4319},
+        {7328, 4320}, {7329, 4321}, {7330, 4322}, {7331, 4323}, {7332, 4324}, {7333, 4325},
+        {7334, 4326}, {7335, 4327}, {7336, 4328}, {7337, 4329}, {7338, 4330}, {7339, 4331},
+        {7340, 4332}, {7341, 4333}, {7342, 4334}, {7343, 4335}, {7344, 4336}, {7345, 4337},
+        {7346, 4338}, {7347, 4339}, {7348, 4340}, {7349, 4341}, {7350, 4342}, {7351, 4343},
+        {7352, 4344}, {7353, 4345}, {7354, 4346}, {7357, 4349}, {7358, 4350}, {7359, 4351},
+        {7680, 7681}, {7682, 7683}, {7684, 7685}, {7686, 7687}, {7688, 7689}, {7690, 7691},
+        {7692, 7693}, {7694, 7695}, {7696, 7697}, {7698, 7699}, {7700, 7701}, {7702, 7703},
+        {7704, 7705}, {7706, 7707}, {7708, 7709}, {7710, 7711}, {7712, 7713}, {7714, 7715},
+        {7716, 7717}, {7718, 7719}, {7720, 7721}, {7722, 7723}, {7724, 7725}, {7726, 7727},
+        {7728, 7729}, {7730, 7731}, {7732, 7733}, {7734, 7735}, {7736, 7737}, {7738, 7739},
+        {7740, 7741}, {7742, 7743}, {7744, 7745}, {7746, 7747}, {7748, 7749}, {7750, 7751},
+        {7752, 7753}, {7754, 7755}, {7756, 7757}, {7758, 7759}, {7760, 7761}, {7762, 7763},
+        {7764, 7765}, {7766, 7767}, {7768, 7769}, {7770, 7771}, {7772, 7773}, {7774, 7775},
+        {7776, 7777}, {7778, 7779}, {7780, 7781}, {7782, 7783}, {7784, 7785}, {7786, 7787},
+        {7788, 7789}, {7790, 7791}, {7792, 7793}, {7794, 7795}, {7796, 7797}, {7798, 7799},
+        {7800, 7801}, {7802, 7803}, {7804, 7805}, {7806, 7807}, {7808, 7809}, {7810, 7811},
+        {7812, 7813}, {7814, 7815}, {7816, 7817}, {7818, 7819}, {7820, 7821}, {7822, 7823},
+        {7824, 7825}, {7826, 7827}, {7828, 7829}, {7835, 7777}, {7838, 223}, {7840, 7841},
+        {7842, 7843}, {7844, 7845}, {7846, 7847}, {7848, 7849}, {7850, 7851}, {7852, 7853},
+        {7854, 7855}, {7856, 7857}, {7858, 7859}, {7860, 7861}, {7862, 7863}, {7864, 7865},
+        {7866, 7867}, {7868, 7869}, {7870, 7871}, {7872, 7873}, {7874, 7875}, {7876, 7877},
+        {7878, 7879}, {7880, 7881}, {7882, 7883}, {7884, 7885}, {7886, 7887}, {7888, 7889},
+        {7890, 7891}, {7892, 7893}, {7894, 7895}, {7896, 7897}, {7898, 7899}, {7900, 7901},
+        {7902, 7903}, {7904, 7905}, {7906, 7907}, {7908, 7909}, {7910, 7911}, {7912, 7913},
+        {7914, 7915}, {7916, 7917}, {7918, 7919}, {7920, 7921}, {7922, 7923}, {7924, 7925},
+        {7926, 7927}, {7928, 7929}, {7930, 7931}, {7932, 7933}, {7934, 7935}, {7944, 7936},
+        {7945, 7937}, {7946, 7938}, {7947, 7939}, {7948, 7940}, {7949, 7941}, {7950, 7942},
+        {7951, 7943}, {7960, 7952}, {7961, 7953}, {7962, 7954}, {7963, 7955}, {7964, 7956},
+        {7965, 7957}, {7976, 7968}, {7977, 7969}, {7978, 7970}, {7979, 7971}, {7980, 7972},
+        {7981, 7973}, {7982, 7974}, {7983, 7975}, {7992, 7984}, {7993, 7985}, {7994, 7986},
+        {7995, 7987}, {7996, 7988}, {7997, 7989}, {7998, 7990}, {7999, 7991}, {8008, 8000},
+        {8009, 8001}, {8010, 8002}, {8011, 8003}, {8012, 8004}, {8013, 8005}, {8025, 8017},
+        {8027, 8019}, {8029, 8021}, {8031, 8023}, {8040, 8032}, {8041, 8033}, {8042, 8034},
+        {8043, 8035}, {8044, 8036}, {8045, 8037}, {8046, 8038}, {8047, 8039}, {8072, 8064},
+        {8073, 8065}, {8074, 8066}, {8075, 8067}, {8076, 8068}, {8077, 8069}, {8078, 8070},
+        {8079, 8071}, {8088, 8080}, {8089, 8081}, {8090, 8082}, {8091, 8083}, {8092, 8084},
+        {8093, 8085}, {8094, 8086}, {8095, 8087}, {8104, 8096}, {8105, 8097}, {8106, 8098},
+        {8107, 8099}, {8108, 8100}, {8109, 8101}, {8110, 8102}, {8111, 8103}, {8120, 8112},
+        {8121, 8113}, {8122, 8048}, {8123, 8049}, {8124, 8115}, {8126, 953}, {8136, 8050},
+        {8137, 8051}, {8138, 8052}, {8139, 8053}, {8140, 8131}, {8152, 8144}, {8153, 8145},
+        {8154, 8054}, {8155, 8055}, {8168, 8160}, {8169, 8161}, {8170, 8058}, {8171, 8059},
+        {8172, 8165}, {8184, 8056}, {8185, 8057}, {8186, 8060}, {8187, 8061}, {8188, 8179},
+        {8486, 969}, {8490, 107}, {8491, 229}, {8498, 8526}, {8544, 8560}, {8545, 8561},
+        {8546, 8562}, {8547, 8563}, {8548, 8564}, {8549, 8565}, {8550, 8566}, {8551, 8567},
+        {8552, 8568}, {8553, 8569}, {8554, 8570}, {8555, 8571}, {8556, 8572}, {8557, 8573},
+        {8558, 8574}, {8559, 8575}, {8579, 8580}, {9398, 9424}, {9399, 9425}, {9400, 9426},
+        {9401, 9427}, {9402, 9428}, {9403, 9429}, {9404, 9430}, {9405, 9431}, {9406, 9432},
+        {9407, 9433}, {9408, 9434}, {9409, 9435}, {9410, 9436}, {9411, 9437}, {9412, 9438},
+        {9413, 9439}, {9414, 9440}, {9415, 9441}, {9416, 9442}, {9417, 9443}, {9418, 9444},
+        {9419, 9445}, {9420, 9446}, {9421, 9447}, {9422, 9448}, {9423, 9449}, {11264, 11312},
+        {11265, 11313}, {11266, 11314}, {11267, 11315}, {11268, 11316}, {11269, 11317}, {11270, 11318},
+        {11271, 11319}, {11272, 11320}, {11273, 11321}, {11274, 11322}, {11275, 11323}, {11276, 11324},
+        {11277, 11325}, {11278, 11326}, {11279, 11327}, {11280, 11328}, {11281, 11329}, {11282, 11330},
+        {11283, 11331}, {11284, 11332}, {11285, 11333}, {11286, 11334}, {11287, 11335}, {11288, 11336},
+        {11289, 11337}, {11290, 11338}, {11291, 11339}, {11292, 11340}, {11293, 11341}, {11294, 11342},
+        {11295, 11343}, {11296, 11344}, {11297, 11345}, {11298, 11346}, {11299, 11347}, {11300, 11348},
+        {11301, 11349}, {11302, 11350}, {11303, 11351}, {11304, 11352}, {11305, 11353}, {11306, 11354},
+        {11307, 11355}, {11308, 11356}, {11309, 11357}, {11310, 11358}, {11311, 11359}, {11360, 11361},
+        {11362, 619}, {11363, 7549}, {11364, 637}, {11367, 11368}, {11369, 11370}, {11371, 11372},
+        {11373, 593}, {11374, 625}, {11375, 592}, {11376, 594}, {11378, 11379}, {11381, 11382},
+        {11390, 575}, {11391, 576}, {11392, 11393}, {11394, 11395}, {11396, 11397}, {11398, 11399},
+        {11400, 11401}, {11402, 11403}, {11404, 11405}, {11406, 11407}, {11408, 11409}, {11410, 11411},
+        {11412, 11413}, {11414, 11415}, {11416, 11417}, {11418, 11419}, {11420, 11421}, {11422, 11423},
+        {11424, 11425}, {11426, 11427}, {11428, 11429}, {11430, 11431}, {11432, 11433}, {11434, 11435},
+        {11436, 11437}, {11438, 11439}, {11440, 11441}, {11442, 11443}, {11444, 11445}, {11446, 11447},
+        {11448, 11449}, {11450, 11451}, {11452, 11453}, {11454, 11455}, {11456, 11457}, {11458, 11459},
+        {11460, 11461}, {11462, 11463}, {11464, 11465}, {11466, 11467}, {11468, 11469}, {11470, 11471},
+        {11472, 11473}, {11474, 11475}, {11476, 11477}, {11478, 11479}, {11480, 11481}, {11482, 11483},
+        {11484, 11485}, {11486, 11487}, {11488, 11489}, {11490, 11491}, {11499, 11500}, {11501, 11502},
+        {11506, 11507}, {42560, 42561}, {42562, 42563}, {42564, 42565}, {42566, 42567}, {42568, 42569},
+        {42570, 42571}, {42572, 42573}, {42574, 42575}, {42576, 42577}, {42578, 42579}, {42580, 42581},
+        {42582, 42583}, {42584, 42585}, {42586, 42587}, {42588, 42589}, {42590, 42591}, {42592, 42593},
+        {42594, 42595}, {42596, 42597}, {42598, 42599}, {42600, 42601}, {42602, 42603}, {42604, 42605},
+        {42624, 42625}, {42626, 42627}, {42628, 42629}, {42630, 42631}, {42632, 42633}, {42634, 42635},
+        {42636, 42637}, {42638, 42639}, {42640, 42641}, {42642, 42643}, {42644, 42645}, {42646, 42647},
+        {42648, 42649}, {42650, 42651}, {42786, 42787}, {42788, 42789}, {42790, 42791}, {42792, 42793},
+        {42794, 42795}, {42796, 42797}, {42798, 42799}, {42802, 42803}, {42804, 42805}, {42806, 42807},
+        {42808, 42809}, {42810, 42811}, {42812, 42813}, {42814, 42815}, {42816, 42817}, {42818, 42819},
+        {42820, 42821}, {42822, 42823}, {42824, 42825}, {42826, 42827}, {42828, 42829}, {42830, 42831},
+        {42832, 42833}, {42834, 42835}, {42836, 42837}, {42838, 42839}, {42840, 42841}, {42842, 42843},
+        {42844, 42845}, {42846, 42847}, {42848, 42849}, {42850, 42851}, {42852, 42853}, {42854, 42855},
+        {42856, 42857}, {42858, 42859}, {42860, 42861}, {42862, 42863}, {42873, 42874}, {42875, 42876},
+        {42877, 7545}, {42878, 42879}, {42880, 42881}, {42882, 42883}, {42884, 42885}, {42886, 42887},
+        {42891, 42892}, {42893, 613}, {42896, 42897}, {42898, 42899}, {42902, 42903}, {42904, 42905},
+        {42906, 42907}, {42908, 42909}, {42910, 42911}, {42912, 42913}, {42914, 42915}, {42916, 42917},
+        {42918, 42919}, {42920, 42921}, {42922, 614}, {42923, 604}, {42924, 609}, {42925, 620},
+        {42926, 618}, {42928, 670}, {42929, 647}, {42930, 669}, {42931, 43859}, {42932, 42933},
+        {42934, 42935}, {42936, 42937}, {42938, 42939}, {42940, 42941}, {42942, 42943}, {42944, 42945},
+        {42946, 42947}, {42948, 42900}, {42949, 642}, {42950, 7566}, {42951, 42952}, {42953, 42954},
+        {42960, 42961}, {42966, 42967}, {42968, 42969}, {42997, 42998}, {43888, 5024}, {43889, 5025},
+        {43890, 5026}, {43891, 5027}, {43892, 5028}, {43893, 5029}, {43894, 5030}, {43895, 5031},
+        {43896, 5032}, {43897, 5033}, {43898, 5034}, {43899, 5035}, {43900, 5036}, {43901, 5037},
+        {43902, 5038}, {43903, 5039}, {43904, 5040}, {43905, 5041}, {43906, 5042}, {43907, 5043},
+        {43908, 5044}, {43909, 5045}, {43910, 5046}, {43911, 5047}, {43912, 5048}, {43913, 5049},
+        {43914, 5050}, {43915, 5051}, {43916, 5052}, {43917, 5053}, {43918, 5054}, {43919, 5055},
+        {43920, 5056}, {43921, 5057}, {43922, 5058}, {43923, 5059}, {43924, 5060}, {43925, 5061},
+        {43926, 5062}, {43927, 5063}, {43928, 5064}, {43929, 5065}, {43930, 5066}, {43931, 5067},
+        {43932, 5068}, {43933, 5069}, {43934, 5070}, {43935, 5071}, {43936, 5072}, {43937, 5073},
+        {43938, 5074}, {43939, 5075}, {43940, 5076}, {43941, 5077}, {43942, 5078}, {43943, 5079},
+        {43944, 5080}, {43945, 5081}, {43946, 5082}, {43947, 5083}, {43948, 5084}, {43949, 5085},
+        {43950, 5086}, {43951, 5087}, {43952, 5088}, {43953, 5089}, {43954, 5090}, {43955, 5091},
+        {43956, 5092}, {43957, 5093}, {43958, 5094}, {43959, 5095}, {43960, 5096}, {43961, 5097},
+        {43962, 5098}, {43963, 5099}, {43964, 5100}, {43965, 5101}, {43966, 5102}, {43967, 5103},
+        {65313, 65345}, {65314, 65346}, {65315, 65347}, {65316, 65348}, {65317, 65349}, {65318, 65350},
+        {65319, 65351}, {65320, 65352}, {65321, 65353}, {65322, 65354}, {65323, 65355}, {65324, 65356},
+        {65325, 65357}, {65326, 65358}, {65327, 65359}, {65328, 65360}, {65329, 65361}, {65330, 65362},
+        {65331, 65363}, {65332, 65364}, {65333, 65365}, {65334, 65366}, {65335, 65367}, {65336, 65368},
+        {65337, 65369}, {65338, 65370}, {66560, 66600}, {66561, 66601}, {66562, 66602}, {66563, 66603},
+        {66564, 66604}, {66565, 66605}, {66566, 66606}, {66567, 66607}, {66568, 66608}, {66569, 66609},
+        {66570, 66610}, {66571, 66611}, {66572, 66612}, {66573, 66613}, {66574, 66614}, {66575, 66615},
+        {66576, 66616}, {66577, 66617}, {66578, 66618}, {66579, 66619}, {66580, 66620}, {66581, 66621},
+        {66582, 66622}, {66583, 66623}, {66584, 66624}, {66585, 66625}, {66586, 66626}, {66587, 66627},
+        {66588, 66628}, {66589, 66629}, {66590, 66630}, {66591, 66631}, {66592, 66632}, {66593, 66633},
+        {66594, 66634}, {66595, 66635}, {66596, 66636}, {66597, 66637}, {66598, 66638}, {66599, 66639},
+        {66736, 66776}, {66737, 66777}, {66738, 66778}, {66739, 66779}, {66740, 66780}, {66741, 66781},
+        {66742, 66782}, {66743, 66783}, {66744, 66784}, {66745, 66785}, {66746, 66786}, {66747, 66787},
+        {66748, 66788}, {66749, 66789}, {66750, 66790}, {66751, 66791}, {66752, 66792}, {66753, 66793},
+        {66754, 66794}, {66755, 66795}, {66756, 66796}, {66757, 66797}, {66758, 66798}, {66759, 66799},
+        {66760, 66800}, {66761, 66801}, {66762, 66802}, {66763, 66803}, {66764, 66804}, {66765, 66805},
+        {66766, 66806}, {66767, 66807}, {66768, 66808}, {66769, 66809}, {66770, 66810}, {66771, 66811},
+        {66928, 66967}, {66929, 66968}, {66930, 66969}, {66931, 66970}, {66932, 66971}, {66933, 66972},
+        {66934, 66973}, {66935, 66974}, {66936, 66975}, {66937, 66976}, {66938, 66977}, {66940, 66979},
+        {66941, 66980}, {66942, 66981}, {66943, 66982}, {66944, 66983}, {66945, 66984}, {66946, 66985},
+        {66947, 66986}, {66948, 66987}, {66949, 66988}, {66950, 66989}, {66951, 66990}, {66952, 66991},
+        {66953, 66992}, {66954, 66993}, {66956, 66995}, {66957, 66996}, {66958, 66997}, {66959, 66998},
+        {66960, 66999}, {66961, 67000}, {66962, 67001}, {66964, 67003}, {66965, 67004}, {68736, 68800},
+        {68737, 68801}, {68738, 68802}, {68739, 68803}, {68740, 68804}, {68741, 68805}, {68742, 68806},
+        {68743, 68807}, {68744, 68808}, {68745, 68809}, {68746, 68810}, {68747, 68811}, {68748, 68812},
+        {68749, 68813}, {68750, 68814}, {68751, 68815}, {68752, 68816}, {68753, 68817}, {68754, 68818},
+        {68755, 68819}, {68756, 68820}, {68757, 68821}, {68758, 68822}, {68759, 68823}, {68760, 68824},
+        {68761, 68825}, {68762, 68826}, {68763, 68827}, {68764, 68828}, {68765, 68829}, {68766, 68830},
+        {68767, 68831}, {68768, 68832}, {68769, 68833}, {68770, 68834}, {68771, 68835}, {68772, 68836},
+        {68773, 68837}, {68774, 68838}, {68775, 68839}, {68776, 68840}, {68777, 68841}, {68778, 68842},
+        {68779, 68843}, {68780, 68844}, {68781, 68845}, {68782, 68846}, {68783, 68847}, {68784, 68848},
+        {68785, 68849}, {68786, 68850}, {71840, 71872}, {71841, 71873}, {71842, 71874}, {71843, 71875},
+        {71844, 71876}, {71845, 71877}, {71846, 71878}, {71847, 71879}, {71848, 71880}, {71849, 71881},
+        {71850, 71882}, {71851, 71883}, {71852, 71884}, {71853, 71885}, {71854, 71886}, {71855, 71887},
+        {71856, 71888}, {71857, 71889}, {71858, 71890}, {71859, 71891}, {71860, 71892}, {71861, 71893},
+        {71862, 71894}, {71863, 71895}, {71864, 71896}, {71865, 71897}, {71866, 71898}, {71867, 71899},
+        {71868, 71900}, {71869, 71901}, {71870, 71902}, {71871, 71903}, {93760, 93792}, {93761, 93793},
+        {93762, 93794}, {93763, 93795}, {93764, 93796}, {93765, 93797}, {93766, 93798}, {93767, 93799},
+        {93768, 93800}, {93769, 93801}, {93770, 93802}, {93771, 93803}, {93772, 93804}, {93773, 93805},
+        {93774, 93806}, {93775, 93807}, {93776, 93808}, {93777, 93809}, {93778, 93810}, {93779, 93811},
+        {93780, 93812}, {93781, 93813}, {93782, 93814}, {93783, 93815}, {93784, 93816}, {93785, 93817},
+        {93786, 93818}, {93787, 93819}, {93788, 93820}, {93789, 93821}, {93790, 93822}, {93791, 93823},
+        {125184, 125218}, {125185, 125219}, {125186, 125220}, {125187, 125221}, {125188, 125222}, {125189, 125223},
+        {125190, 125224}, {125191, 125225}, {125192, 125226}, {125193, 125227}, {125194, 125228}, {125195, 125229},
+        {125196, 125230}, {125197, 125231}, {125198, 125232}, {125199, 125233}, {125200, 125234}, {125201, 125235},
+        {125202, 125236}, {125203, 125237}, {125204, 125238}, {125205, 125239}, {125206, 125240}, {125207, 125241},
+        {125208, 125242}, {125209, 125243}, {125210, 125244}, {125211, 125245}, {125212, 125246}, {125213, 125247},
+        {125214, 125248}, {125215, 125249}, {125216, 125250}, {125217, 125251},
+    };
+
+    constexpr Decomposition Decompositions[] = {
+        {192, 65, 768}, {193, 65, 769}, {194, 65, 770}, {195, 65, 771}, {196, 65, 776}, {197, 65, 778},
+        {199, 67, 807}, {200, 69, 768}, {201, 69, 769}, {202, 69, 770}, {203, 69, 776}, {204, 73, 768},
+        {205, 73, 769}, {206, 73, 770}, {207, 73, 776}, {209, 78, 771}, {210, 79, 768}, {211, 79, 769},
+        {212, 79, 770}, {213, 79, 771}, {214, 79, 776}, {217, 85, 768}, {218, 85, 769}, {219, 85, 770},
+        {220, 85, 776}, {221, 89, 769}, {224, 97, 768}, {225, 97, 769}, {226, 97, 770}, {227, 97, 771},
+        {228, 97, 776}, {229, 97, 778}, {231, 99, 807}, {232, 101, 768}, {233, 101, 769}, {234, 101, 770},
+        {235, 101, 776}, {236, 105, 768}, {237, 105, 769}, {238, 105, 770}, {239, 105, 776}, {241, 110, 771},
+        {242, 111, 768}, {243, 111, 769}, {244, 111, 770}, {245, 111, 771}, {246, 111, 776}, {249, 117, 768},
+        {250, 117, 769}, {251, 117, 770}, {252, 117, 776}, {253, 121, 769}, {255, 121, 776}, {256, 65, 772},
+        {257, 97, 772}, {258, 65, 774}, {259, 97, 774}, {260, 65, 808}, {261, 97, 808}, {262, 67, 769},
+        {263, 99, 769}, {264, 67, 770}, {265, 99, 770}, {266, 67, 775}, {267, 99, 775}, {268, 67, 780},
+        {269, 99, 780}, {270, 68, 780}, {271, 100, 780}, {274, 69, 772}, {275, 101, 772}, {276, 69, 774},
+        {277, 101, 774}, {278, 69, 775}, {279, 101, 775}, {280, 69, 808}, {281, 101, 808}, {282, 69, 780},
+        {283, 101, 780}, {284, 71, 770}, {285, 103, 770}, {286, 71, 774}, {287, 103, 774}, {288, 71, 775},
+        {289, 103, 775}, {290, 71, 807}, {291, 103, 807}, {292, 72, 770}, {293, 104, 770}, {296, 73, 771},
+        {297, 105, 771}, {298, 73, 772}, {299, 105, 772}, {300, 73, 774}, {301, 105, 774}, {302, 73, 808},
+        {303, 105, 808}, {304, 73, 775}, {308, 74, 770}, {309, 106, 770}, {310, 75, 807}, {311, 107, 807},
+        {313, 76, 769}, {314, 108, 769}, {315, 76, 807}, {316, 108, 807}, {317, 76, 780}, {318, 108, 780},
+        {323, 78, 769}, {324, 110, 769}, {325, 78, 807}, {326, 110, 807}, {327, 78, 780}, {328, 110, 780},
+        {332, 79, 772}, {333, 111, 772}, {334, 79, 774}, {335, 111, 774}, {336, 79, 779}, {337, 111, 779},
+        {340, 82, 769}, {341, 114, 769}, {342, 82, 807}, {343, 114, 807}, {344, 82, 780}, {345, 114, 780},
+        {346, 83, 769}, {347, 115, 769}, {348, 83, 770}, {349, 115, 770}, {350, 83, 807}, {351, 115, 807},
+        {352, 83, 780}, {353, 115, 780}, {354, 84, 807}, {355, 116, 807}, {356, 84, 780}, {357, 116, 780},
+        {360, 85, 771}, {361, 117, 771}, {362, 85, 772}, {363, 117, 772}, {364, 85, 774}, {365, 117, 774},
+        {366, 85, 778}, {367, 117, 778}, {368, 85, 779}, {369, 117, 779}, {370, 85, 808}, {371, 117, 808},
+        {372, 87, 770}, {373, 119, 770}, {374, 89, 770}, {375, 121, 770}, {376, 89, 776}, {377, 90, 769},
+        {378, 122, 769}, {379, 90, 775}, {380, 122, 775}, {381, 90, 780}, {382, 122, 780}, {416, 79, 795},
+        {417, 111, 795}, {431, 85, 795}, {432, 117, 795}, {461, 65, 780}, {462, 97, 780}, {463, 73, 780},
+        {464, 105, 780}, {465, 79, 780}, {466, 111, 780}, {467, 85, 780}, {468, 117, 780}, {469, 220, 772},
+        {470, 252, 772}, {471, 220, 769}, {472, 252, 769}, {473, 220, 780}, {474, 252, 780}, {475, 220, 768},
+        {476, 252, 768}, {478, 196, 772}, {479, 228, 772}, {480, 550, 772}, {481, 551, 772}, {482, 198, 772},
+        {483, 230, 772}, {486, 71, 780}, {487, 103, 780}, {488, 75, 780}, {489, 107, 780}, {490, 79, 808},
+        {491, 111, 808}, {492, 490, 772}, {493, 491, 772}, {494, 439, 780}, {495, 658, 780}, {496, 106, 780},
+        {500, 71, 769}, {501, 103, 769}, {504, 78, 768}, {505, 110, 768}, {506, 197, 769}, {507, 229, 769},
+        {508, 198, 769}, {509, 230, 769}, {510, 216, 769}, {511, 248, 769}, {512, 65, 783}, {513, 97, 783},
+        {514, 65, 785}, {515, 97, 785}, {516, 69, 783}, {517, 101, 783}, {518, 69, 785}, {519, 101, 785},
+        {520, 73, 783}, {521, 105, 783}, {522, 73, 785}, {523, 105, 785}, {524, 79, 783}, {525, 111, 783},
+        {526, 79, 785}, {527, 111, 785}, {528, 82, 783}, {529, 114, 783}, {530, 82, 785}, {531, 114, 785},
+        {532, 85, 783}, {533, 117, 783}, {534, 85, 785}, {535, 117, 785}, {536, 83, 806}, {537, 115, 806},
+        {538, 84, 806}, {539, 116, 806}, {542, 72, 780}, {543, 104, 780}, {550, 65, 775}, {551, 97, 775},
+        {552, 69, 807}, {553, 101, 807}, {554, 214, 772}, {555, 246, 772}, {556, 213, 772}, {557, 245, 772},
+        {558, 79, 775}, {559, 111, 775}, {560, 558, 772}, {561, 559, 772}, {562, 89, 772}, {563, 121, 772},
+        {832, 768, 0}, {833, 769, 0}, {835, 787, 0}, {836, 776, 769}, {884, 697, 0}, {894, 59, 0},
+        {901, 168, 769}, {902, 913, 769}, {903, 183, 0}, {904, 917, 769}, {905, 919, 769}, {906, 921, 769},
+        {908, 927, 769}, {910, 933, 769}, {911, 937, 769}, {912, 970, 769}, {938, 921, 776}, {939, 933, 776},
+        {940, 945, 769}, {941, 949, 769}, {942, 951, 769}, {943, 953, 769}, {944, 971, 769}, {970, 953, 776},
+        {971, 965, 776}, {972, 959, 769}, {973, 965, 769}, {974, 969, 769}, {979, 978, 769}, {980, 978, 776},
+        {1024, 1045, 768}, {1025, 1045, 776}, {1027, 1043, 769}, {1031, 1030, 776}, {1036, 1050, 769}, {1037, 1048, 768},
+        {1038, 1059, 774}, {1049, 1048, 774}, {1081, 1080, 774}, {1104, 1077, 768}, {1105, 1077, 776}, {1107, 1075, 769},
+        {1111, 1110, 776}, {1116, 1082, 769}, {1117, 1080, 768}, {1118, 1091, 774}, {1142, 1140, 783}, {1143, 1141, 783},
+        {1217, 1046, 774}, {1218, 1078, 774}, {1232, 1040, 774}, {1233, 1072, 774}, {1234, 1040, 776}, {1235, 1072, 776},
+        {1238, 1045, 774}, {1239, 1077, 774}, {1242, 1240, 776}, {1243, 1241, 776}, {1244, 1046, 776}, {1245, 1078, 776},
+        {1246, 1047, 776}, {1247, 1079, 776}, {1250, 1048, 772}, {1251, 1080, 772}, {1252, 1048, 776}, {1253, 1080, 776},
+        {1254, 1054, 776}, {1255, 1086, 776}, {1258, 1256, 776}, {1259, 1257, 776}, {1260, 1069, 776}, {1261, 1101, 776},
+        {1262, 1059, 772}, {1263, 1091, 772}, {1264, 1059, 776}, {1265, 1091, 776}, {1266, 1059, 779}, {1267, 1091, 779},
+        {1268, 1063, 776}, {1269, 1095, 776}, {1272, 1067, 776}, {1273, 1099, 776}, {1570, 1575, 1619}, {1571, 1575, 1620},
+        {1572, 1608, 1620}, {1573, 1575, 1621}, {1574, 1610, 1620}, {1728, 1749, 1620}, {1730, 1729, 1620}, {1747, 1746, 1620},
+        {2345, 2344, 2364}, {2353, 2352, 2364}, {2356, 2355, 2364}, {2392, 2325, 2364}, {2393, 2326, 2364}, {2394, 2327, 2364},
+        {2395, 2332, 2364}, {2396, 2337, 2364}, {2397, 2338, 2364}, {2398, 2347, 2364}, {2399, 2351, 2364}, {2507, 2503, 2494},
+        {2508, 2503, 2519}, {2524, 2465, 2492}, {2525, 2466, 2492}, {2527, 2479, 2492}, {2611, 2610, 2620}, {2614, 2616, 2620},
+        {2649, 2582, 2620}, {2650, 2583, 2620}, {2651, 2588, 2620}, {2654, 2603, 2620}, {2888, 2887, 2902}, {2891, 2887, 2878},
+        {2892, 2887, 2903}, {2908, 2849, 2876}, {2909, 2850, 2876}, {2964, 2962, 3031}, {3018, 3014, 3006}, {3019, 3015, 3006},
+        {3020, 3014, 3031}, {3144, 3142, 3158}, {3264, 3263, 3285}, {3271, 3270, 3285}, {3272, 3270, 3286}, {3274, 3270, 3266},
+        {3275, 3274, 3285}, {3402, 3398, 3390}, {3403, 3399, 3390}, {3404, 3398, 3415}, {3546, 3545, 3530}, {3548, 3545, 3535},
+        {3549, 3548, 3530}, {3550, 3545, 3551}, {3907, 3906, 4023}, {3917, 3916, 4023}, {3922, 3921, 4023}, {3927, 3926, 4023},
+        {3932, 3931, 4023}, {3945, 3904, 4021}, {3955, 3953, 3954}, {3957, 3953, 3956}, {3958, 4018, 3968}, {3960, 4019, 3968},
+        {3969, 3953, 3968}, {3987, 3986, 4023}, {3997, 3996, 4023}, {4002, 4001, 4023}, {4007, 4006, 4023}, {4012, 4011, 4023},
+        {4025, 3984, 4021}, {4134, 4133, 4142}, {6918, 6917, 6965}, {6920, 6919, 6965}, {6922, 6921, 6965}, {6924, 6923, 6965},
+        {6926, 6925, 6965}, {6930, 6929, 6965}, {6971, 6970, 6965}, {6973, 6972, 6965}, {6976, 6974, 6965}, {6977, 6975, 6965},
+        {6979, 6978, 6965}, {7680, 65, 805}, {7681, 97, 805}, {7682, 66, 775}, {7683, 98, 775}, {7684, 66, 803},
+        {7685, 98, 803}, {7686, 66, 817}, {7687, 98, 817}, {7688, 199, 769}, {7689, 231, 769}, {7690, 68, 775},
+        {7691, 100, 775}, {7692, 68, 803}, {7693, 100, 803}, {7694, 68, 817}, {7695, 100, 817}, {7696, 68, 807},
+        {7697, 100, 807}, {7698, 68, 813}, {7699, 100, 813}, {7700, 274, 768}, {7701, 275, 768}, {7702, 274, 769},
+        {7703, 275, 769}, {7704, 69, 813}, {7705, 101, 813}, {7706, 69, 816}, {7707, 101, 816}, {7708, 552, 774},
+        {7709, 553, 774}, {7710, 70, 775}, {7711, 102, 775}, {7712, 71, 772}, {7713, 103, 772}, {7714, 72, 775},
+        {7715, 104, 775}, {7716, 72, 803}, {7717, 104, 803}, {7718, 72, 776}, {7719, 104, 776}, {7720, 72, 807},
+        {7721, 104, 807}, {7722, 72, 814}, {7723, 104, 814}, {7724, 73, 816}, {7725, 105, 816}, {7726, 207, 769},
+        {7727, 239, 769}, {7728, 75, 769}, {7729, 107, 769}, {7730, 75, 803}, {7731, 107, 803}, {7732, 75, 817},
+        {7733, 107, 817}, {7734, 76, 803}, {7735, 108, 803}, {7736, 7734, 772}, {7737, 7735, 772}, {7738, 76, 817},
+        {7739, 108, 817}, {7740, 76, 813}, {7741, 108, 813}, {7742, 77, 769}, {7743, 109, 769}, {7744, 77, 775},
+        {7745, 109, 775}, {7746, 77, 803}, {7747, 109, 803}, {7748, 78, 775}, {7749, 110, 775}, {7750, 78, 803},
+        {7751, 110, 803}, {7752, 78, 817}, {7753, 110, 817}, {7754, 78, 813}, {7755, 110, 813}, {7756, 213, 769},
+        {7757, 245, 769}, {7758, 213, 776}, {7759, 245, 776}, {7760, 332, 768}, {7761, 333, 768}, {7762, 332, 769},
+        {7763, 333, 769}, {7764, 80, 769}, {7765, 112, 769}, {7766, 80, 775}, {7767, 112, 775}, {7768, 82, 775},
+        {7769, 114, 775}, {7770, 82, 803}, {7771, 114, 803}, {7772, 7770, 772}, {7773, 7771, 772}, {7774, 82, 817},
+        {7775, 114, 817}, {7776, 83, 775}, {7777, 115, 775}, {7778, 83, 803}, {7779, 115, 803}, {7780, 346, 775},
+        {7781, 347, 775}, {7782, 352, 775}, {7783, 353, 775}, {7784, 7778, 775}, {7785, 7779, 775}, {7786, 84, 775},
+        {7787, 116, 775}, {7788, 84, 803}, {7789, 116, 803}, {7790, 84, 817}, {7791, 116, 817}, {7792, 84, 813},
+        {7793, 116, 813}, {7794, 85, 804}, {7795, 117, 804}, {7796, 85, 816}, {7797, 117, 816}, {7798, 85, 813},
+        {7799, 117, 813}, {7800, 360, 769}, {7801, 361, 769}, {7802, 362, 776}, {7803, 363, 776}, {7804, 86, 771},
+        {7805, 118, 771}, {7806, 86, 803}, {7807, 118, 803}, {7808, 87, 768}, {7809, 119, 768}, {7810, 87, 769},
+        {7811, 119, 769}, {7812, 87, 776}, {7813, 119, 776}, {7814, 87, 775}, {7815, 119, 775}, {7816, 87, 803},
+        {7817, 119, 803}, {7818, 88, 775}, {7819, 120, 775}, {7820, 88, 776}, {7821, 120, 776}, {7822, 89, 775},
+        {7823, 121, 775}, {7824, 90, 770}, {7825, 122, 770}, {7826, 90, 803}, {7827, 122, 803}, {7828, 90, 817},
+        {7829, 122, 817}, {7830, 104, 817}, {7831, 116, 776}, {7832, 119, 778}, {7833, 121, 778}, {7835, 383, 775},
+        {7840, 65, 803}, {7841, 97, 803}, {7842, 65, 777}, {7843, 97, 777}, {7844, 194, 769}, {7845, 226, 769},
+        {7846, 194, 768}, {7847, 226, 768}, {7848, 194, 777}, {7849, 226, 777}, {7850, 194, 771}, {7851, 226, 771},
+        {7852, 7840, 770}, {7853, 7841, 770}, {7854, 258, 769}, {7855, 259, 769}, {7856, 258, 768}, {7857, 259, 768},
+        {7858, 258, 777}, {7859, 259, 777}, {7860, 258, 771}, {7861, 259, 771}, {7862, 7840, 774}, {7863, 7841, 774},
+        {7864, 69, 803}, {7865, 101, 803}, {7866, 69, 777}, {7867, 101, 777}, {7868, 69, 771}, {7869, 101, 771},
+        {7870, 202, 769}, {7871, 234, 769}, {7872, 202, 768}, {7873, 234, 768}, {7874, 202, 777}, {7875, 234, 777},
+        {7876, 202, 771}, {7877, 234, 771}, {7878, 7864, 770}, {7879, 7865, 770}, {7880, 73, 777}, {7881, 105, 777},
+        {7882, 73, 803}, {7883, 105, 803}, {7884, 79, 803}, {7885, 111, 803}, {7886, 79, 777}, {7887, 111, 777},
+        {7888, 212, 769}, {7889, 244, 769}, {7890, 212, 768}, {7891, 244, 768}, {7892, 212, 777}, {7893, 244, 777},
+        {7894, 212, 771}, {7895, 244, 771}, {7896, 7884, 770}, {7897, 7885, 770}, {7898, 416, 769}, {7899, 417, 769},
+        {7900, 416, 768}, {7901, 417, 768}, {7902, 416, 777}, {7903, 417, 777}, {7904, 416, 771}, {7905, 417, 771},
+        {7906, 416, 803}, {7907, 417, 803}, {7908, 85, 803}, {7909, 117, 803}, {7910, 85, 777}, {7911, 117, 777},
+        {7912, 431, 769}, {7913, 432, 769}, {7914, 431, 768}, {7915, 432, 768}, {7916, 431, 777}, {7917, 432, 777},
+        {7918, 431, 771}, {7919, 432, 771}, {7920, 431, 803}, {7921, 432, 803}, {7922, 89, 768}, {7923, 121, 768},
+        {7924, 89, 803}, {7925, 121, 803}, {7926, 89, 777}, {7927, 121, 777}, {7928, 89, 771}, {7929, 121, 771},
+        {7936, 945, 787}, {7937, 945, 788}, {7938, 7936, 768}, {7939, 7937, 768}, {7940, 7936, 769}, {7941, 7937, 769},
+        {7942, 7936, 834}, {7943, 7937, 834}, {7944, 913, 787}, {7945, 913, 788}, {7946, 7944, 768}, {7947, 7945, 768},
+        {7948, 7944, 769}, {7949, 7945, 769}, {7950, 7944, 834}, {7951, 7945, 834}, {7952, 949, 787}, {7953, 949, 788},
+        {7954, 7952, 768}, {7955, 7953, 768}, {7956, 7952, 769}, {7957, 7953, 769}, {7960, 917, 787}, {7961, 917, 788},
+        {7962, 7960, 768}, {7963, 7961, 768}, {7964, 7960, 769}, {7965, 7961, 769}, {7968, 951, 787}, {7969, 951, 788},
+        {7970, 7968, 768}, {7971, 7969, 768}, {7972, 7968, 769}, {7973, 7969, 769}, {7974, 7968, 834}, {7975, 7969, 834},
+        {7976, 919, 787}, {7977, 919, 788}, {7978, 7976, 768}, {7979, 7977, 768}, {7980, 7976, 769}, {7981, 7977, 769},
+        {7982, 7976, 834}, {7983, 7977, 834}, {7984, 953, 787}, {7985, 953, 788}, {7986, 7984, 768}, {7987, 7985, 768},
+        {7988, 7984, 769}, {7989, 7985, 769}, {7990, 7984, 834}, {7991, 7985, 834}, {7992, 921, 787}, {7993, 921, 788},
+        {7994, 7992, 768}, {7995, 7993, 768}, {7996, 7992, 769}, {7997, 7993, 769}, {7998, 7992, 834}, {7999, 7993, 834},
+        {8000, 959, 787}, {8001, 959, 788}, {8002, 8000, 768}, {8003, 8001, 768}, {8004, 8000, 769}, {8005, 8001, 769},
+        {8008, 927, 787}, {8009, 927, 788}, {8010, 8008, 768}, {8011, 8009, 768}, {8012, 8008, 769}, {8013, 8009, 769},
+        {8016, 965, 787}, {8017, 965, 788}, {8018, 8016, 768}, {8019, 8017, 768}, {8020, 8016, 769}, {8021, 8017, 769},
+        {8022, 8016, 834}, {8023, 8017, 834}, {8025, 933, 788}, {8027, 8025, 768}, {8029, 8025, 769}, {8031, 8025, 834},
+        {8032, 969, 787}, {8033, 969, 788}, {8034, 8032, 768}, {8035, 8033, 768}, {8036, 8032, 769}, {8037, 8033, 769},
+        {8038, 8032, 834}, {8039, 8033, 834}, {8040, 937, 787}, {8041, 937, 788}, {8042, 8040, 768}, {8043, 8041, 768},
+        {8044, 8040, 769}, {8045, 8041, 769}, {8046, 8040, 834}, {8047, 8041, 834}, {8048, 945, 768}, {8049, 940, 0},
+        {8050, 949, 768}, {8051, 941, 0}, {8052, 951, 768}, {8053, 942, 0}, {8054, 953, 768}, {8055, 943, 0},
+        {8056, 959, 768}, {8057, 972, 0}, {8058, 965, 768}, {8059, 973, 0}, {8060, 969, 768}, {8061, 974, 0},
+        {8064, 7936, 837}, {8065, 7937, 837}, {8066, 7938, 837}, {8067, 7939, 837}, {8068, 7940, 837}, {8069, 7941, 837},
+        {8070, 7942, 837}, {8071, 7943, 837}, {8072, 7944, 837}, {8073, 7945, 837}, {8074, 7946, 837}, {8075, 7947, 837},
+        {8076, 7948, 837}, {8077, 7949, 837}, {8078, 7950, 837}, {8079, 7951, 837}, {8080, 7968, 837}, {8081, 7969, 837},
+        {8082, 7970, 837}, {8083, 7971, 837}, {8084, 7972, 837}, {8085, 7973, 837}, {8086, 7974, 837}, {8087, 7975, 837},
+        {8088, 7976, 837}, {8089, 7977, 837}, {8090, 7978, 837}, {8091, 7979, 837}, {8092, 7980, 837}, {8093, 7981, 837},
+        {8094, 7982, 837}, {8095, 7983, 837}, {8096, 8032, 837}, {8097, 8033, 837}, {8098, 8034, 837}, {8099, 8035, 837},
+        {8100, 8036, 837}, {8101, 8037, 837}, {8102, 8038, 837}, {8103, 8039, 837}, {8104, 8040, 837}, {8105, 8041, 837},
+        {8106, 8042, 837}, {8107, 8043, 837}, {8108, 8044, 837}, {8109, 8045, 837}, {8110, 8046, 837}, {8111, 8047, 837},
+        {8112, 945, 774}, {8113, 945, 772}, {8114, 8048, 837}, {8115, 945, 837}, {8116, 940, 837}, {8118, 945, 834},
+        {8119, 8118, 837}, {8120, 913, 774}, {8121, 913, 772}, {8122, 913, 768}, {8123, 902, 0}, {8124, 913, 837},
+        {8126, 953, 0}, {8129, 168, 834}, {8130, 8052, 837}, {8131, 951, 837}, {8132, 942, 837}, {8134, 951, 834},
+        {8135, 8134, 837}, {8136, 917, 768}, {8137, 904, 0}, {8138, 919, 768}, {8139, 905, 0}, {8140, 919, 837},
+        {8141, 8127, 768}, {8142, 8127, 769}, {8143, 8127, 834}, {8144, 953, 774}, {8145, 953, 772}, {8146, 970, 768},
+        {8147, 912, 0}, {8150, 953, 834}, {8151, 970, 834}, {8152, 921, 774}, {8153, 921, 772}, {8154, 921, 768},
+        {8155, 906, 0}, {8157, 8190, 768}, {8158, 8190, 769}, {8159, 8190, 834}, {8160, 965, 774}, {8161, 965, 772},
+        {8162, 971, 768}, {8163, 944, 0}, {8164, 961, 787}, {8165, 961, 788}, {8166, 965, 834}, {8167, 971, 834},
+        {8168, 933, 774}, {8169, 933, 772}, {8170, 933, 768}, {8171, 910, 0}, {8172, 929, 788}, {8173, 168, 768},
+        {8174, 901, 0}, {8175, 96, 0}, {8178, 8060, 837}, {8179, 969, 837}, {8180, 974, 837}, {8182, 969, 834},
+        {8183, 8182, 837}, {8184, 927, 768}, {8185, 908, 0}, {8186, 937, 768}, {8187, 911, 0}, {8188, 937, 837},
+        {8189, 180, 0}, {8192, 8194, 0}, {8193, 8195, 0}, {8486, 937, 0}, {8490, 75, 0}, {8491, 197, 0},
+        {8602, 8592, 824}, {8603, 8594, 824}, {8622, 8596, 824}, {8653, 8656, 824}, {8654, 8660, 824}, {8655, 8658, 824},
+        {8708, 8707, 824}, {8713, 8712, 824}, {8716, 8715, 824}, {8740, 8739, 824}, {8742, 8741, 824}, {8769, 8764, 824},
+        {8772, 8771, 824}, {8775, 8773, 824}, {8777, 8776, 824}, {8800, 61, 824}, {8802, 8801, 824}, {8813, 8781, 824},
+        {8814, 60, 824}, {8815, 62, 824}, {8816, 8804, 824}, {8817, 8805, 824}, {8820, 8818, 824}, {8821, 8819, 824},
+        {8824, 8822, 824}, {8825, 8823, 824}, {8832, 8826, 824}, {8833, 8827, 824}, {8836, 8834, 824}, {8837, 8835, 824},
+        {8840, 8838, 824}, {8841, 8839, 824}, {8876, 8866, 824}, {8877, 8872, 824}, {8878, 8873, 824}, {8879, 8875, 824},
+        {8928, 8828, 824}, {8929, 8829, 824}, {8930, 8849, 824}, {8931, 8850, 824}, {8938, 8882, 824}, {8939, 8883, 824},
+        {8940, 8884, 824}, {8941, 8885, 824}, {9001, 12296, 0}, {9002, 12297, 0}, {10972, 10973, 824}, {12364, 12363, 12441},
+        {12366, 12365, 12441}, {12368, 12367, 12441}, {12370, 12369, 12441}, {12372, 12371, 12441}, {12374, 12373, 12441}, {12376, 12375, 12441},
+        {12378, 12377, 12441}, {12380, 12379, 12441}, {12382, 12381, 12441}, {12384, 12383, 12441}, {12386, 12385, 12441}, {12389, 12388, 12441},
+        {12391, 12390, 12441}, {12393, 12392, 12441}, {12400, 12399, 12441}, {12401, 12399, 12442}, {12403, 12402, 12441}, {12404, 12402, 12442},
+        {12406, 12405, 12441}, {12407, 12405, 12442}, {12409, 12408, 12441}, {12410, 12408, 12442}, {12412, 12411, 12441}, {12413, 12411, 12442},
+        {12436, 12358, 12441}, {12446, 12445, 12441}, {12460, 12459, 12441}, {12462, 12461, 12441}, {12464, 12463, 12441}, {12466, 12465, 12441},
+        {12468, 12467, 12441}, {12470, 12469, 12441}, {12472, 12471, 12441}, {12474, 12473, 12441}, {12476, 12475, 12441}, {12478, 12477, 12441},
+        {12480, 12479, 12441}, {12482, 12481, 12441}, {12485, 12484, 12441}, {12487, 12486, 12441}, {12489, 12488, 12441}, {12496, 12495, 12441},
+        {12497, 12495, 12442}, {12499, 12498, 12441}, {12500, 12498, 12442}, {12502, 12501, 12441}, {12503, 12501, 12442}, {12505, 12504, 12441},
+        {12506, 12504, 12442}, {12508, 12507, 12441}, {12509, 12507, 12442}, {12532, 12454, 12441}, {12535, 12527, 12441}, {12536, 12528, 12441},
+        {12537, 12529, 12441}, {12538, 12530, 12441}, {12542, 12541, 12441}, {63744, 35912, 0}, {63745, 26356, 0}, {63746, 36554, 0},
+        {63747, 36040, 0}, {63748, 28369, 0}, {63749, 20018, 0}, {63750, 21477, 0}, {63751, 40860, 0}, {63752, 40860, 0},
+        {63753, 22865, 0}, {63754, 37329, 0}, {63755, 21895, 0}, {63756, 22856, 0}, {63757, 25078, 0}, {63758, 30313, 0},
+        {63759, 32645, 0}, {63760, 34367, 0}, {63761, 34746, 0}, {63762, 35064, 0}, {63763, 37007, 0}, {63764, 27138, 0},
+        {63765, 27931, 0}, {63766, 28889, 0}, {63767, 29662, 0}, {63768, 33853, 0}, {63769, 37226, 0}, {63770, 39409, 0},
+        {63771, 20098, 0}, {63772, 21365, 0}, {63773, 27396, 0}, {63774, 29211, 0}, {63775, 34349, 0}, {63776, 40478, 0},
+        {63777, 23888, 0}, {63778, 28651, 0}, {63779, 34253, 0}, {63780, 35172, 0}, {63781, 25289, 0}, {63782, 33240, 0},
+        {63783, 34847, 0}, {63784, 24266, 0}, {63785, 26391, 0}, {63786, 28010, 0}, {63787, 29436, 0}, {63788, 37070, 0},
+        {63789, 20358, 0}, {63790, 20919, 0}, {63791, 21214, 0}, {63792, 25796, 0}, {63793, 27347, 0}, {63794, 29200, 0},
+        {63795, 30439, 0}, {63796, 32769, 0}, {63797, 34310, 0}, {63798, 34396, 0}, {63799, 36335, 0}, {63800, 38706, 0},
+        {63801, 39791, 0}, {63802, 40442, 0}, {63803, 30860, 0}, {63804, 31103, 0}, {63805, 32160, 0}, {63806, 33737, 0},
+        {63807, 37636, 0}, {63808, 40575, 0}, {63809, 35542, 0}, {63810, 22751, 0}, {63811, 24324, 0}, {63812, 31840, 0},
+        {63813, 32894, 0}, {63814, 29282, 0}, {63815, 30922, 0}, {63816, 36034, 0}, {63817, 38647, 0}, {63818, 22744, 0},
+        {63819, 23650, 0}, {63820, 27155, 0}, {63821, 28122, 0}, {63822, 28431, 0}, {63823, 32047, 0}, {63824, 32311, 0},
+        {63825, 38475, 0}, {63826, 21202, 0}, {63827, 32907, 0}, {63828, 20956, 0}, {63829, 20940, 0}, {63830, 31260, 0},
+        {63831, 32190, 0}, {63832, 33777, 0}, {63833, 38517, 0}, {63834, 35712, 0}, {63835, 25295, 0}, {63836, 27138, 0},
+        {63837, 35582, 0}, {63838, 20025, 0}, {63839, 23527, 0}, {63840, 24594, 0}, {63841, 29575, 0}, {63842, 30064, 0},
+        {63843, 21271, 0}, {63844, 30971, 0}, {63845, 20415, 0}, {63846, 24489, 0}, {63847, 19981, 0}, {63848, 27852, 0},
+        {63849, 25976, 0}, {63850, 32034, 0}, {63851, 21443, 0}, {63852, 22622, 0}, {63853, 30465, 0}, {63854, 33865, 0},
+        {63855, 35498, 0}, {63856, 27578, 0}, {63857, 36784, 0}, {63858, 27784, 0}, {63859, 25342, 0}, {63860, 33509, 0},
+        {63861, 25504, 0}, {63862, 30053, 0}, {63863, 20142, 0}, {63864, 20841, 0}, {63865, 20937, 0}, {63866, 26753, 0},
+        {63867, 31975, 0}, {63868, 33391, 0}, {63869, 35538, 0}, {63870, 37327, 0}, {63871, 21237, 0}, {63872, 21570, 0},
+        {63873, 22899, 0}, {63874, 24300, 0}, {63875, 26053, 0}, {63876, 28670, 0}, {63877, 31018, 0}, {63878, 38317, 0},
+        {63879, 39530, 0}, {63880, 40599, 0}, {63881, 40654, 0}, {63882, 21147, 0}, {63883, 26310, 0}, {63884, 27511, 0},
+        {63885, 36706, 0}, {63886, 24180, 0}, {63887, 24976, 0}, {63888, 25088, 0}, {63889, 25754, 0}, {63890, 28451, 0},
+        {63891, 29001, 0}, {63892, 29833, 0}, {63893, 31178, 0}, {63894, 32244, 0}, {63895, 32879, 0}, {63896, 36646, 0},
+        {63897, 34030, 0}, {63898, 36899, 0}, {63899, 37706, 0}, {63900, 21015, 0}, {63901, 21155, 0}, {63902, 21693, 0},
+        {63903, 28872, 0}, {63904, 35010, 0}, {63905, 35498, 0}, {63906, 24265, 0}, {63907, 24565, 0}, {63908, 25467, 0},
+        {63909, 27566, 0}, {63910, 31806, 0}, {63911, 29557, 0}, {63912, 20196, 0}, {63913, 22265, 0}, {63914, 23527, 0},
+        {63915, 23994, 0}, {63916, 24604, 0}, {63917, 29618, 0}, {63918, 29801, 0}, {63919, 32666, 0}, {63920, 32838, 0},
+        {63921, 37428, 0}, {63922, 38646, 0}, {63923, 38728, 0}, {63924, 38936, 0}, {63925, 20363, 0}, {63926, 31150, 0},
+        {63927, 37300, 0}, {63928, 38584, 0}, {63929, 24801, 0}, {63930, 20102, 0}, {63931, 20698, 0}, {63932, 23534, 0},
+        {63933, 23615, 0}, {63934, 26009, 0}, {63935, 27138, 0}, {63936, 29134, 0}, {63937, 30274, 0}, {63938, 34044, 0},
+        {63939, 36988, 0}, {63940, 40845, 0}, {63941, 26248, 0}, {63942, 38446, 0}, {63943, 21129, 0}, {63944, 26491, 0},
+        {63945, 26611, 0}, {63946, 27969, 0}, {63947, 28316, 0}, {63948, 29705, 0}, {63949, 30041, 0}, {63950, 30827, 0},
+        {63951, 32016, 0}, {63952, 39006, 0}, {63953, 20845, 0}, {63954, 25134, 0}, {63955, 38520, 0}, {63956, 20523, 0},
+        {63957, 23833, 0}, {63958, 28138, 0}, {63959, 36650, 0}, {63960, 24459, 0}, {63961, 24900, 0}, {63962, 26647, 0},
+        {63963, 29575, 0}, {63964, 38534, 0}, {63965, 21033, 0}, {63966, 21519, 0}, {63967, 23653, 0}, {63968, 26131, 0},
+        {63969, 26446, 0}, {63970, 26792, 0}, {63971, 27877, 0}, {63972, 29702, 0}, {63973, 30178, 0}, {63974, 32633, 0},
+        {63975, 35023, 0}, {63976, 35041, 0}, {63977, 37324, 0}, {63978, 38626, 0}, {63979, 21311, 0}, {63980, 28346, 0},
+        {63981, 21533, 0}, {63982, 29136, 0}, {63983, 29848, 0}, {63984, 34298, 0}, {63985, 38563, 0}, {63986, 40023, 0},
+        {63987, 40607, 0}, {63988, 26519, 0}, {63989, 28107, 0}, {63990, 33256, 0}, {63991, 31435, 0}, {63992, 31520, 0},
+        {63993, 31890, 0}, {63994, 29376, 0}, {63995, 28825, 0}, {63996, 35672, 0}, {63997, 20160, 0}, {63998, 33590, 0},
+        {63999, 21050, 0}, {64000, 20999, 0}, {64001, 24230, 0}, {64002, 25299, 0}, {64003, 31958, 0}, {64004, 23429, 0},
+        {64005, 27934, 0}, {64006, 26292, 0}, {64007, 36667, 0}, {64008, 34892, 0}, {64009, 38477, 0}, {64010, 35211, 0},
+        {64011, 24275, 0}, {64012, 20800, 0}, {64013, 21952, 0}, {64016, 22618, 0}, {64018, 26228, 0}, {64021, 20958, 0},
+        {64022, 29482, 0}, {64023, 30410, 0}, {64024, 31036, 0}, {64025, 31070, 0}, {64026, 31077, 0}, {64027, 31119, 0},
+        {64028, 38742, 0}, {64029, 31934, 0}, {64030, 32701, 0}, {64032, 34322, 0}, {64034, 35576, 0}, {64037, 36920, 0},
+        {64038, 37117, 0}, {64042, 39151, 0}, {64043, 39164, 0}, {64044, 39208, 0}, {64045, 40372, 0}, {64046, 37086, 0},
+        {64047, 38583, 0}, {64048, 20398, 0}, {64049, 20711, 0}, {64050, 20813, 0}, {64051, 21193, 0}, {64052, 21220, 0},
+        {64053, 21329, 0}, {64054, 21917, 0}, {64055, 22022, 0}, {64056, 22120, 0}, {64057, 22592, 0}, {64058, 22696, 0},
+        {64059, 23652, 0}, {64060, 23662, 0}, {64061, 24724, 0}, {64062, 24936, 0}, {64063, 24974, 0}, {64064, 25074, 0},
+        {64065, 25935, 0}, {64066, 26082, 0}, {64067, 26257, 0}, {64068, 26757, 0}, {64069, 28023, 0}, {64070, 28186, 0},
+        {64071, 28450, 0}, {64072, 29038, 0}, {64073, 29227, 0}, {64074, 29730, 0}, {64075, 30865, 0}, {64076, 31038, 0},
+        {64077, 31049, 0}, {64078, 31048, 0}, {64079, 31056, 0}, {64080, 31062, 0}, {64081, 31069, 0}, {64082, 31117, 0},
+        {64083, 31118, 0}, {64084, 31296, 0}, {64085, 31361, 0}, {64086, 31680, 0}, {64087, 32244, 0}, {64088, 32265, 0},
+        {64089, 32321, 0}, {64090, 32626, 0}, {64091, 32773, 0}, {64092, 33261, 0}, {64093, 33401, 0}, {64094, 33401, 0},
+        {64095, 33879, 0}, {64096, 35088, 0}, {64097, 35222, 0}, {64098, 35585, 0}, {64099, 35641, 0}, {64100, 36051, 0},
+        {64101, 36104, 0}, {64102, 36790, 0}, {64103, 36920, 0}, {64104, 38627, 0}, {64105, 38911, 0}, {64106, 38971, 0},
+        {64107, 24693, 0}, {64108, 148206, 0}, {64109, 33304, 0}, {64112, 20006, 0}, {64113, 20917, 0}, {64114, 20840, 0},
+        {64115, 20352, 0}, {64116, 20805, 0}, {64117, 20864, 0}, {64118, 21191, 0}, {64119, 21242, 0}, {64120, 21917, 0},
+        {64121, 21845, 0}, {64122, 21913, 0}, {64123, 21986, 0}, {64124, 22618, 0}, {64125, 22707, 0}, {64126, 22852, 0},
+        {64127, 22868, 0}, {64128, 23138, 0}, {64129, 23336, 0}, {64130, 24274, 0}, {64131, 24281, 0}, {64132, 24425, 0},
+        {64133, 24493, 0}, {64134, 24792, 0}, {64135, 24910, 0}, {64136, 24840, 0}, {64137, 24974, 0}, {64138, 24928, 0},
+        {64139, 25074, 0}, {64140, 25140, 0}, {64141, 25540, 0}, {64142, 25628, 0}, {64143, 25682, 0}, {64144, 25942, 0},
+        {64145, 26228, 0}, {64146, 26391, 0}, {64147, 26395, 0}, {64148, 26454, 0}, {64149, 27513, 0}, {64150, 27578, 0},
+        {64151, 27969, 0}, {64152, 28379, 0}, {64153, 28363, 0}, {64154, 28450, 0}, {64155, 28702, 0}, {64156, 29038, 0},
+        {64157, 30631, 0}, {64158, 29237, 0}, {64159, 29359, 0}, {64160, 29482, 0}, {64161, 29809, 0}, {64162, 29958, 0},
+        {64163, 30011, 0}, {64164, 30237, 0}, {64165, 30239, 0}, {64166, 30410, 0}, {64167, 30427, 0}, {64168, 30452, 0},
+        {64169, 30538, 0}, {64170, 30528, 0}, {64171, 30924, 0}, {64172, 31409, 0}, {64173, 31680, 0}, {64174, 31867, 0},
+        {64175, 32091, 0}, {64176, 32244, 0}, {64177, 32574, 0}, {64178, 32773, 0}, {64179, 33618, 0}, {64180, 33775, 0},
+        {64181, 34681, 0}, {64182, 35137, 0}, {64183, 35206, 0}, {64184, 35222, 0}, {64185, 35519, 0}, {64186, 35576, 0},
+        {64187, 35531, 0}, {64188, 35585, 0}, {64189, 35582, 0}, {64190, 35565, 0}, {64191, 35641, 0}, {64192, 35722, 0},
+        {64193, 36104, 0}, {64194, 36664, 0}, {64195, 36978, 0}, {64196, 37273, 0}, {64197, 37494, 0}, {64198, 38524, 0},
+        {64199, 38627, 0}, {64200, 38742, 0}, {64201, 38875, 0}, {64202, 38911, 0}, {64203, 38923, 0}, {64204, 38971, 0},
+        {64205, 39698, 0}, {64206, 40860, 0}, {64207, 141386, 0}, {64208, 141380, 0}, {64209, 144341, 0}, {64210, 15261, 0},
+        {64211, 16408, 0}, {64212, 16441, 0}, {64213, 152137, 0}, {64214, 154832, 0}, {64215, 163539, 0}, {64216, 40771, 0},
+        {64217, 40846, 0}, {64285, 1497, 1460}, {64287, 1522, 1463}, {64298, 1513, 1473}, {64299, 1513, 1474}, {64300, 64329, 1473},
+        {64301, 64329, 1474}, {64302, 1488, 1463}, {64303, 1488, 1464}, {64304, 1488, 1468}, {64305, 1489, 1468}, {64306, 1490, 1468},
+        {64307, 1491, 1468}, {64308, 1492, 1468}, {64309, 1493, 1468}, {64310, 1494, 1468}, {64312, 1496, 1468}, {64313, 1497, 1468},
+        {64314, 1498, 1468}, {64315, 1499, 1468}, {64316, 1500, 1468}, {64318, 1502, 1468}, {64320, 1504, 1468}, {64321, 1505, 1468},
+        {64323, 1507, 1468}, {64324, 1508, 1468}, {64326, 1510, 1468}, {64327, 1511, 1468}, {64328, 1512, 1468}, {64329, 1513, 1468},
+        {64330, 1514, 1468}, {64331, 1493, 1465}, {64332, 1489, 1471}, {64333, 1499, 1471}, {64334, 1508, 1471}, {69786, 69785, 69818},
+        {69788, 69787, 69818}, {69803, 69797, 69818}, {69934, 69937, 69927}, {69935, 69938, 69927}, {70475, 70471, 70462}, {70476, 70471, 70487},
+        {70843, 70841, 70842}, {70844, 70841, 70832}, {70846, 70841, 70845}, {71098, 71096, 71087}, {71099, 71097, 71087}, {71992, 71989, 71984},
+        {119134, 119127, 119141}, {119135, 119128, 119141}, {119136, 119135, 119150}, {119137, 119135, 119151}, {119138, 119135, 119152}, {119139, 119135, 119153},
+        {119140, 119135, 119154}, {119227, 119225, 119141}, {119228, 119226, 119141}, {119229, 119227, 119150}, {119230, 119228, 119150}, {119231, 119227, 119151},
+        {119232, 119228, 119151}, {194560, 20029, 0}, {194561, 20024, 0}, {194562, 20033, 0}, {194563, 131362, 0}, {194564, 20320, 0},
+        {194565, 20398, 0}, {194566, 20411, 0}, {194567, 20482, 0}, {194568, 20602, 0}, {194569, 20633, 0}, {194570, 20711, 0},
+        {194571, 20687, 0}, {194572, 13470, 0}, {194573, 132666, 0}, {194574, 20813, 0}, {194575, 20820, 0}, {194576, 20836, 0},
+        {194577, 20855, 0}, {194578, 132380, 0}, {194579, 13497, 0}, {194580, 20839, 0}, {194581, 20877, 0}, {194582, 132427, 0},
+        {194583, 20887, 0}, {194584, 20900, 0}, {194585, 20172, 0}, {194586, 20908, 0}, {194587, 20917, 0}, {194588, 168415, 0},
+        {194589, 20981, 0}, {194590, 20995, 0}, {194591, 13535, 0}, {194592, 21051, 0}, {194593, 21062, 0}, {194594, 21106, 0},
+        {194595, 21111, 0}, {194596, 13589, 0}, {194597, 21191, 0}, {194598, 21193, 0}, {194599, 21220, 0}, {194600, 21242, 0},
+        {194601, 21253, 0}, {194602, 21254, 0}, {194603, 21271, 0}, {194604, 21321, 0}, {194605, 21329, 0}, {194606, 21338, 0},
+        {194607, 21363, 0}, {194608, 21373, 0}, {194609, 21375, 0}, {194610, 21375, 0}, {194611, 21375, 0}, {194612, 133676, 0},
+        {194613, 28784, 0}, {194614, 21450, 0}, {194615, 21471, 0}, {194616, 133987, 0}, {194617, 21483, 0}, {194618, 21489, 0},
+        {194619, 21510, 0}, {194620, 21662, 0}, {194621, 21560, 0}, {194622, 21576, 0}, {194623, 21608, 0}, {194624, 21666, 0},
+        {194625, 21750, 0}, {194626, 21776, 0}, {194627, 21843, 0}, {194628, 21859, 0}, {194629, 21892, 0}, {194630, 21892, 0},
+        {194631, 21913, 0}, {194632, 21931, 0}, {194633, 21939, 0}, {194634, 21954, 0}, {194635, 22294, 0}, {194636, 22022, 0},
+        {194637, 22295, 0}, {194638, 22097, 0}, {194639, 22132, 0}, {194640, 20999, 0}, {194641, 22766, 0}, {194642, 22478, 0},
+        {194643, 22516, 0}, {194644, 22541, 0}, {194645, 22411, 0}, {194646, 22578, 0}, {194647, 22577, 0}, {194648, 22700, 0},
+        {194649, 136420, 0}, {194650, 22770, 0}, {194651, 22775, 0}, {194652, 22790, 0}, {194653, 22810, 0}, {194654, 22818, 0},
+        {194655, 22882, 0}, {194656, 136872, 0}, {194657, 136938, 0}, {194658, 23020, 0}, {194659, 23067, 0}, {194660, 23079, 0},
+        {194661, 23000, 0}, {194662, 23142, 0}, {194663, 14062, 0}, {194664, 14076, 0}, {194665, 23304, 0}, {194666, 23358, 0},
+        {194667, 23358, 0}, {194668, 137672, 0}, {194669, 23491, 0}, {194670, 23512, 0}, {194671, 23527, 0}, {194672, 23539, 0},
+        {194673, 138008, 0}, {194674, 23551, 0}, {194675, 23558, 0}, {194676, 24403, 0}, {194677, 23586, 0}, {194678, 14209, 0},
+        {194679, 23648, 0}, {194680, 23662, 0}, {194681, 23744, 0}, {194682, 23693, 0}, {194683, 138724, 0}, {194684, 23875, 0},
+        {194685, 138726, 0}, {194686, 23918, 0}, {194687, 23915, 0}, {194688, 23932, 0}, {194689, 24033, 0}, {194690, 24034, 0},
+        {194691, 14383, 0}, {194692, 24061, 0}, {194693, 24104, 0}, {194694, 24125, 0}, {194695, 24169, 0}, {194696, 14434, 0},
+        {194697, 139651, 0}, {194698, 14460, 0}, {194699, 24240, 0}, {194700, 24243, 0}, {194701, 24246, 0}, {194702, 24266, 0},
+        {194703, 172946, 0}, {194704, 24318, 0}, {194705, 140081, 0}, {194706, 140081, 0}, {194707, 33281, 0}, {194708, 24354, 0},
+        {194709, 24354, 0}, {194710, 14535, 0}, {194711, 144056, 0}, {194712, 156122, 0}, {194713, 24418, 0}, {194714, 24427, 0},
+        {194715, 14563, 0}, {194716, 24474, 0}, {194717, 24525, 0}, {194718, 24535, 0}, {194719, 24569, 0}, {194720, 24705, 0},
+        {194721, 14650, 0}, {194722, 14620, 0}, {194723, 24724, 0}, {194724, 141012, 0}, {194725, 24775, 0}, {194726, 24904, 0},
+        {194727, 24908, 0}, {194728, 24910, 0}, {194729, 24908, 0}, {194730, 24954, 0}, {194731, 24974, 0}, {194732, 25010, 0},
+        {194733, 24996, 0}, {194734, 25007, 0}, {194735, 25054, 0}, {194736, 25074, 0}, {194737, 25078, 0}, {194738, 25104, 0},
+        {194739, 25115, 0}, {194740, 25181, 0}, {194741, 25265, 0}, {194742, 25300, 0}, {194743, 25424, 0}, {194744, 142092, 0},
+        {194745, 25405, 0}, {194746, 25340, 0}, {194747, 25448, 0}, {194748, 25475, 0}, {194749, 25572, 0}, {194750, 142321, 0},
+        {194751, 25634, 0}, {194752, 25541, 0}, {194753, 25513, 0}, {194754, 14894, 0}, {194755, 25705, 0}, {194756, 25726, 0},
+        {194757, 25757, 0}, {194758, 25719, 0}, {194759, 14956, 0}, {194760, 25935, 0}, {194761, 25964, 0}, {194762, 143370, 0},
+        {194763, 26083, 0}, {194764, 26360, 0}, {194765, 26185, 0}, {194766, 15129, 0}, {194767, 26257, 0}, {194768, 15112, 0},
+        {194769, 15076, 0}, {194770, 20882, 0}, {194771, 20885, 0}, {194772, 26368, 0}, {194773, 26268, 0}, {194774, 32941, 0},
+        {194775, 17369, 0}, {194776, 26391, 0}, {194777, 26395, 0}, {194778, 26401, 0}, {194779, 26462, 0}, {194780, 26451, 0},
+        {194781, 144323, 0}, {194782, 15177, 0}, {194783, 26618, 0}, {194784, 26501, 0}, {194785, 26706, 0}, {194786, 26757, 0},
+        {194787, 144493, 0}, {194788, 26766, 0}, {194789, 26655, 0}, {194790, 26900, 0}, {194791, 15261, 0}, {194792, 26946, 0},
+        {194793, 27043, 0}, {194794, 27114, 0}, {194795, 27304, 0}, {194796, 145059, 0}, {194797, 27355, 0}, {194798, 15384, 0},
+        {194799, 27425, 0}, {194800, 145575, 0}, {194801, 27476, 0}, {194802, 15438, 0}, {194803, 27506, 0}, {194804, 27551, 0},
+        {194805, 27578, 0}, {194806, 27579, 0}, {194807, 146061, 0}, {194808, 138507, 0}, {194809, 146170, 0}, {194810, 27726, 0},
+        {194811, 146620, 0}, {194812, 27839, 0}, {194813, 27853, 0}, {194814, 27751, 0}, {194815, 27926, 0}, {194816, 27966, 0},
+        {194817, 28023, 0}, {194818, 27969, 0}, {194819, 28009, 0}, {194820, 28024, 0}, {194821, 28037, 0}, {194822, 146718, 0},
+        {194823, 27956, 0}, {194824, 28207, 0}, {194825, 28270, 0}, {194826, 15667, 0}, {194827, 28363, 0}, {194828, 28359, 0},
+        {194829, 147153, 0}, {194830, 28153, 0}, {194831, 28526, 0}, {194832, 147294, 0}, {194833, 147342, 0}, {194834, 28614, 0},
+        {194835, 28729, 0}, {194836, 28702, 0}, {194837, 28699, 0}, {194838, 15766, 0}, {194839, 28746, 0}, {194840, 28797, 0},
+        {194841, 28791, 0}, {194842, 28845, 0}, {194843, 132389, 0}, {194844, 28997, 0}, {194845, 148067, 0}, {194846, 29084, 0},
+        {194847, 148395, 0}, {194848, 29224, 0}, {194849, 29237, 0}, {194850, 29264, 0}, {194851, 149000, 0}, {194852, 29312, 0},
+        {194853, 29333, 0}, {194854, 149301, 0}, {194855, 149524, 0}, {194856, 29562, 0}, {194857, 29579, 0}, {194858, 16044, 0},
+        {194859, 29605, 0}, {194860, 16056, 0}, {194861, 16056, 0}, {194862, 29767, 0}, {194863, 29788, 0}, {194864, 29809, 0},
+        {194865, 29829, 0}, {194866, 29898, 0}, {194867, 16155, 0}, {194868, 29988, 0}, {194869, 150582, 0}, {194870, 30014, 0},
+        {194871, 150674, 0}, {194872, 30064, 0}, {194873, 139679, 0}, {194874, 30224, 0}, {194875, 151457, 0}, {194876, 151480, 0},
+        {194877, 151620, 0}, {194878, 16380, 0}, {194879, 16392, 0}, {194880, 30452, 0}, {194881, 151795, 0}, {194882, 151794, 0},
+        {194883, 151833, 0}, {194884, 151859, 0}, {194885, 30494, 0}, {194886, 30495, 0}, {194887, 30495, 0}, {194888, 30538, 0},
+        {194889, 16441, 0}, {194890, 30603, 0}, {194891, 16454, 0}, {194892, 16534, 0}, {194893, 152605, 0}, {194894, 30798, 0},
+        {194895, 30860, 0}, {194896, 30924, 0}, {194897, 16611, 0}, {194898, 153126, 0}, {194899, 31062, 0}, {194900, 153242, 0},
+        {194901, 153285, 0}, {194902, 31119, 0}, {194903, 31211, 0}, {194904, 16687, 0}, {194905, 31296, 0}, {194906, 31306, 0},
+        {194907, 31311, 0}, {194908, 153980, 0}, {194909, 154279, 0}, {194910, 154279, 0}, {194911, 31470, 0}, {194912, 16898, 0},
+        {194913, 154539, 0}, {194914, 31686, 0}, {194915, 31689, 0}, {194916, 16935, 0}, {194917, 154752, 0}, {194918, 31954, 0},
+        {194919, 17056, 0}, {194920, 31976, 0}, {194921, 31971, 0}, {194922, 32000, 0}, {194923, 155526, 0}, {194924, 32099, 0},
+        {194925, 17153, 0}, {194926, 32199, 0}, {194927, 32258, 0}, {194928, 32325, 0}, {194929, 17204, 0}, {194930, 156200, 0},
+        {194931, 156231, 0}, {194932, 17241, 0}, {194933, 156377, 0}, {194934, 32634, 0}, {194935, 156478, 0}, {194936, 32661, 0},
+        {194937, 32762, 0}, {194938, 32773, 0}, {194939, 156890, 0}, {194940, 156963, 0}, {194941, 32864, 0}, {194942, 157096, 0},
+        {194943, 32880, 0}, {194944, 144223, 0}, {194945, 17365, 0}, {194946, 32946, 0}, {194947, 33027, 0}, {194948, 17419, 0},
+        {194949, 33086, 0}, {194950, 23221, 0}, {194951, 157607, 0}, {194952, 157621, 0}, {194953, 144275, 0}, {194954, 144284, 0},
+        {194955, 33281, 0}, {194956, 33284, 0}, {194957, 36766, 0}, {194958, 17515, 0}, {194959, 33425, 0}, {194960, 33419, 0},
+        {194961, 33437, 0}, {194962, 21171, 0}, {194963, 33457, 0}, {194964, 33459, 0}, {194965, 33469, 0}, {194966, 33510, 0},
+        {194967, 158524, 0}, {194968, 33509, 0}, {194969, 33565, 0}, {194970, 33635, 0}, {194971, 33709, 0}, {194972, 33571, 0},
+        {194973, 33725, 0}, {194974, 33767, 0}, {194975, 33879, 0}, {194976, 33619, 0}, {194977, 33738, 0}, {194978, 33740, 0},
+        {194979, 33756, 0}, {194980, 158774, 0}, {194981, 159083, 0}, {194982, 158933, 0}, {194983, 17707, 0}, {194984, 34033, 0},
+        {194985, 34035, 0}, {194986, 34070, 0}, {194987, 160714, 0}, {194988, 34148, 0}, {194989, 159532, 0}, {194990, 17757, 0},
+        {194991, 17761, 0}, {194992, 159665, 0}, {194993, 159954, 0}, {194994, 17771, 0}, {194995, 34384, 0}, {194996, 34396, 0},
+        {194997, 34407, 0}, {194998, 34409, 0}, {194999, 34473, 0}, {195000, 34440, 0}, {195001, 34574, 0}, {195002, 34530, 0},
+        {195003, 34681, 0}, {195004, 34600, 0}, {195005, 34667, 0}, {195006, 34694, 0}, {195007, 17879, 0}, {195008, 34785, 0},
+        {195009, 34817, 0}, {195010, 17913, 0}, {195011, 34912, 0}, {195012, 34915, 0}, {195013, 161383, 0}, {195014, 35031, 0},
+        {195015, 35038, 0}, {195016, 17973, 0}, {195017, 35066, 0}, {195018, 13499, 0}, {195019, 161966, 0}, {195020, 162150, 0},
+        {195021, 18110, 0}, {195022, 18119, 0}, {195023, 35488, 0}, {195024, 35565, 0}, {195025, 35722, 0}, {195026, 35925, 0},
+        {195027, 162984, 0}, {195028, 36011, 0}, {195029, 36033, 0}, {195030, 36123, 0}, {195031, 36215, 0}, {195032, 163631, 0},
+        {195033, 133124, 0}, {195034, 36299, 0}, {195035, 36284, 0}, {195036, 36336, 0}, {195037, 133342, 0}, {195038, 36564, 0},
+        {195039, 36664, 0}, {195040, 165330, 0}, {195041, 165357, 0}, {195042, 37012, 0}, {195043, 37105, 0}, {195044, 37137, 0},
+        {195045, 165678, 0}, {195046, 37147, 0}, {195047, 37432, 0}, {195048, 37591, 0}, {195049, 37592, 0}, {195050, 37500, 0},
+        {195051, 37881, 0}, {195052, 37909, 0}, {195053, 166906, 0}, {195054, 38283, 0}, {195055, 18837, 0}, {195056, 38327, 0},
+        {195057, 167287, 0}, {195058, 18918, 0}, {195059, 38595, 0}, {195060, 23986, 0}, {195061, 38691, 0}, {195062, 168261, 0},
+        {195063, 168474, 0}, {195064, 19054, 0}, {195065, 19062, 0}, {195066, 38880, 0}, {195067, 168970, 0}, {195068, 19122, 0},
+        {195069, 169110, 0}, {195070, 38923, 0}, {195071, 38923, 0}, {195072, 38953, 0}, {195073, 169398, 0}, {195074, 39138, 0},
+        {195075, 19251, 0}, {195076, 39209, 0}, {195077, 39335, 0}, {195078, 39362, 0}, {195079, 39422, 0}, {195080, 19406, 0},
+        {195081, 170800, 0}, {195082, 39698, 0}, {195083, 40000, 0}, {195084, 40189, 0}, {195085, 19662, 0}, {195086, 19693, 0},
+        {195087, 40295, 0}, {195088, 172238, 0}, {195089, 19704, 0}, {195090, 172293, 0}, {195091, 172558, 0}, {195092, 172689, 0},
+        {195093, 40635, 0}, {195094, 19798, 0}, {195095, 40697, 0}, {195096, 40702, 0}, {195097, 40709, 0}, {195098, 40719, 0},
+        {195099, 40726, 0}, {195100, 40763, 0}, {195101, 173568, 0},
+    };
+
+    constexpr Composition Compositions[] = {
+        {60, 824, 8814}, {61, 824, 8800}, {62, 824, 8815}, {65, 768, 192}, {65, 769, 193}, {65, 770, 194},
+        {65, 771, 195}, {65, 772, 256}, {65, 774, 258}, {65, 775, 550}, {65, 776, 196}, {65, 777, 7842},
+        {65, 778, 197}, {65, 780, 461}, {65, 783, 512}, {65, 785, 514}, {65, 803, 7840}, {65, 805, 7680},
+        {65, 808, 260}, {66, 775, 7682}, {66, 803, 7684}, {66, 817, 7686}, {67, 769, 262}, {67, 770, 264},
+        {67, 775, 266}, {67, 780, 268}, {67, 807, 199}, {68, 775, 7690}, {68, 780, 270}, {68, 803, 7692},
+        {68, 807, 7696}, {68, 813, 7698}, {68, 817, 7694}, {69, 768, 200}, {69, 769, 201}, {69, 770, 202},
+        {69, 771, 7868}, {69, 772, 274}, {69, 774, 276}, {69, 775, 278}, {69, 776, 203}, {69, 777, 7866},
+        {69, 780, 282}, {69, 783, 516}, {69, 785, 518}, {69, 803, 7864}, {69, 807, 552}, {69, 808, 280},
+        {69, 813, 7704}, {69, 816, 7706}, {70, 775, 7710}, {71, 769, 500}, {71, 770, 284}, {71, 772, 7712},
+        {71, 774, 286}, {71, 775, 288}, {71, 780, 486}, {71, 807, 290}, {72, 770, 292}, {72, 775, 7714},
+        {72, 776, 7718}, {72, 780, 542}, {72, 803, 7716}, {72, 807, 7720}, {72, 814, 7722}, {73, 768, 204},
+        {73, 769, 205}, {73, 770, 206}, {73, 771, 296}, {73, 772, 298}, {73, 774, 300}, {73, 775, 304},
+        {73, 776, 207}, {73, 777, 7880}, {73, 780, 463}, {73, 783, 520}, {73, 785, 522}, {73, 803, 7882},
+        {73, 808, 302}, {73, 816, 7724}, {74, 770, 308}, {75, 769, 7728}, {75, 780, 488}, {75, 803, 7730},
+        {75, 807, 310}, {75, 817, 7732}, {76, 769, 313}, {76, 780, 317}, {76, 803, 7734}, {76, 807, 315},
+        {76, 813, 7740}, {76, 817, 7738}, {77, 769, 7742}, {77, 775, 7744}, {77, 803, 7746}, {78, 768, 504},
+        {78, 769, 323}, {78, 771, 209}, {78, 775, 7748}, {78, 780, 327}, {78, 803, 7750}, {78, 807, 325},
+        {78, 813, 7754}, {78, 817, 7752}, {79, 768, 210}, {79, 769, 211}, {79, 770, 212}, {79, 771, 213},
+        {79, 772, 332}, {79, 774, 334}, {79, 775, 558}, {79, 776, 214}, {79, 777, 7886}, {79, 779, 336},
+        {79, 780, 465}, {79, 783, 524}, {79, 785, 526}, {79, 795, 416}, {79, 803, 7884}, {79, 808, 490},
+        {80, 769, 7764}, {80, 775, 7766}, {82, 769, 340}, {82, 775, 7768}, {82, 780, 344}, {82, 783, 528},
+        {82, 785, 530}, {82, 803, 7770}, {82, 807, 342}, {82, 817, 7774}, {83, 769, 346}, {83, 770, 348},
+        {83, 775, 7776}, {83, 780, 352}, {83, 803, 7778}, {83, 806, 536}, {83, 807, 350}, {84, 775, 7786},
+        {84, 780, 356}, {84, 803, 7788}, {84, 806, 538}, {84, 807, 354}, {84, 813, 7792}, {84, 817, 7790},
+        {85, 768, 217}, {85, 769, 218}, {85, 770, 219}, {85, 771, 360}, {85, 772, 362}, {85, 774, 364},
+        {85, 776, 220}, {85, 777, 7910}, {85, 778, 366}, {85, 779, 368}, {85, 780, 467}, {85, 783, 532},
+        {85, 785, 534}, {85, 795, 431}, {85, 803, 7908}, {85, 804, 7794}, {85, 808, 370}, {85, 813, 7798},
+        {85, 816, 7796}, {86, 771, 7804}, {86, 803, 7806}, {87, 768, 7808}, {87, 769, 7810}, {87, 770, 372},
+        {87, 775, 7814}, {87, 776, 7812}, {87, 803, 7816}, {88, 775, 7818}, {88, 776, 7820}, {89, 768, 7922},
+        {89, 769, 221}, {89, 770, 374}, {89, 771, 7928}, {89, 772, 562}, {89, 775, 7822}, {89, 776, 376},
+        {89, 777, 7926}, {89, 803, 7924}, {90, 769, 377}, {90, 770, 7824}, {90, 775, 379}, {90, 780, 381},
+        {90, 803, 7826}, {90, 817, 7828}, {97, 768, 224}, {97, 769, 225}, {97, 770, 226}, {97, 771, 227},
+        {97, 772, 257}, {97, 774, 259}, {97, 775, 551}, {97, 776, 228}, {97, 777, 7843}, {97, 778, 229},
+        {97, 780, 462}, {97, 783, 513}, {97, 785, 515}, {97, 803, 7841}, {97, 805, 7681}, {97, 808, 261},
+        {98, 775, 7683}, {98, 803, 7685}, {98, 817, 7687}, {99, 769, 263}, {99, 770, 265}, {99, 775, 267},
+        {99, 780, 269}, {99, 807, 231}, {100, 775, 7691}, {100, 780, 271}, {100, 803, 7693}, {100, 807, 7697},
+        {100, 813, 7699}, {100, 817, 7695}, {101, 768, 232}, {101, 769, 233}, {101, 770, 234}, {101, 771, 7869},
+        {101, 772, 275}, {101, 774, 277}, {101, 775, 279}, {101, 776, 235}, {101, 777, 7867}, {101, 780, 283},
+        {101, 783, 517}, {101, 785, 519}, {101, 803, 7865}, {101, 807, 553}, {101, 808, 281}, {101, 813, 7705},
+        {101, 816, 7707}, {102, 775, 7711}, {103, 769, 501}, {103, 770, 285}, {103, 772, 7713}, {103, 774, 287},
+        {103, 775, 289}, {103, 780, 487}, {103, 807, 291}, {104, 770, 293}, {104, 775, 7715}, {104, 776, 7719},
+        {104, 780, 543}, {104, 803, 7717}, {104, 807, 7721}, {104, 814, 7723}, {104, 817, 7830}, {105, 768, 236},
+        {105, 769, 237}, {105, 770, 238}, {105, 771, 297}, {105, 772, 299}, {105, 774, 301}, {105, 776, 239},
+        {105, 777, 7881}, {105, 780, 464}, {105, 783, 521}, {105, 785, 523}, {105, 803, 7883}, {105, 808, 303},
+        {105, 816, 7725}, {106, 770, 309}, {106, 780, 496}, {107, 769, 7729}, {107, 780, 489}, {107, 803, 7731},
+        {107, 807, 311}, {107, 817, 7733}, {108, 769, 314}, {108, 780, 318}, {108, 803, 7735}, {108, 807, 316},
+        {108, 813, 7741}, {108, 817, 7739}, {109, 769, 7743}, {109, 775, 7745}, {109, 803, 7747}, {110, 768, 505},
+        {110, 769, 324}, {110, 771, 241}, {110, 775, 7749}, {110, 780, 328}, {110, 803, 7751}, {110, 807, 326},
+        {110, 813, 7755}, {110, 817, 7753}, {111, 768, 242}, {111, 769, 243}, {111, 770, 244}, {111, 771, 245},
+        {111, 772, 333}, {111, 774, 335}, {111, 775, 559}, {111, 776, 246}, {111, 777, 7887}, {111, 779, 337},
+        {111, 780, 466}, {111, 783, 525}, {111, 785, 527}, {111, 795, 417}, {111, 803, 7885}, {111, 808, 491},
+        {112, 769, 7765}, {112, 775, 7767}, {114, 769, 341}, {114, 775, 7769}, {114, 780, 345}, {114, 783, 529},
+        {114, 785, 531}, {114, 803, 7771}, {114, 807, 343}, {114, 817, 7775}, {115, 769, 347}, {115, 770, 349},
+        {115, 775, 7777}, {115, 780, 353}, {115, 803, 7779}, {115, 806, 537}, {115, 807, 351}, {116, 775, 7787},
+        {116, 776, 7831}, {116, 780, 357}, {116, 803, 7789}, {116, 806, 539}, {116, 807, 355}, {116, 813, 7793},
+        {116, 817, 7791}, {117, 768, 249}, {117, 769, 250}, {117, 770, 251}, {117, 771, 361}, {117, 772, 363},
+        {117, 774, 365}, {117, 776, 252}, {117, 777, 7911}, {117, 778, 367}, {117, 779, 369}, {117, 780, 468},
+        {117, 783, 533}, {117, 785, 535}, {117, 795, 432}, {117, 803, 7909}, {117, 804, 7795}, {117, 808, 371},
+        {117, 813, 7799}, {117, 816, 7797}, {118, 771, 7805}, {118, 803, 7807}, {119, 768, 7809}, {119, 769, 7811},
+        {119, 770, 373}, {119, 775, 7815}, {119, 776, 7813}, {119, 778, 7832}, {119, 803, 7817}, {120, 775, 7819},
+        {120, 776, 7821}, {121, 768, 7923}, {121, 769, 253}, {121, 770, 375}, {121, 771, 7929}, {121, 772, 563},
+        {121, 775, 7823}, {121, 776, 255}, {121, 777, 7927}, {121, 778, 7833}, {121, 803, 7925}, {122, 769, 378},
+        {122, 770, 7825}, {122, 775, 380}, {122, 780, 382}, {122, 803, 7827}, {122, 817, 7829}, {168, 768, 8173},
+        {168, 769, 901}, {168, 834, 8129}, {194, 768, 7846}, {194, 769, 7844}, {194, 771, 7850}, {194, 777, 7848},
+        {196, 772, 478}, {197, 769, 506}, {198, 769, 508}, {198, 772, 482}, {199, 769, 7688}, {202, 768, 7872},
+        {202, 769, 7870}, {202, 771, 7876}, {202, 777, 7874}, {207, 769, 7726}, {212, 768, 7890}, {212, 769, 7888},
+        {212, 771, 7894}, {212, 777, 7892}, {213, 769, 7756}, {213, 772, 556}, {213, 776, 7758}, {214, 772, 554},
+        {216, 769, 510}, {220, 768, 475}, {220, 769, 471}, {220, 772, 469}, {220, 780, 473}, {226, 768, 7847},
+        {226, 769, 7845}, {226, 771, 7851}, {226, 777, 7849}, {228, 772, 479}, {229, 769, 507}, {230, 769, 509},
+        {230, 772, 483}, {231, 769, 7689}, {234, 768, 7873}, {234, 769, 7871}, {234, 771, 7877}, {234, 777, 7875},
+        {239, 769, 7727}, {244, 768, 7891}, {244, 769, 7889}, {244, 771, 7895}, {244, 777, 7893}, {245, 769, 7757},
+        {245, 772, 557}, {245, 776, 7759}, {246, 772, 555}, {248, 769, 511}, {252, 768, 476}, {252, 769, 472},
+        {252, 772, 470}, {252, 780, 474}, {258, 768, 7856}, {258, 769, 7854}, {258, 771, 7860}, {258, 777, 7858},
+        {259, 768, 7857}, {259, 769, 7855}, {259, 771, 7861}, {259, 777, 7859}, {274, 768, 7700}, {274, 769, 7702},
+        {275, 768, 7701}, {275, 769, 7703}, {332, 768, 7760}, {332, 769, 7762}, {333, 768, 7761}, {333, 769, 7763},
+        {346, 775, 7780}, {347, 775, 7781}, {352, 775, 7782}, {353, 775, 7783}, {360, 769, 7800}, {361, 769, 7801},
+        {362, 776, 7802}, {363, 776, 7803}, {383, 775, 7835}, {416, 768, 7900}, {416, 769, 7898}, {416, 771, 7904},
+        {416, 777, 7902}, {416, 803, 7906}, {417, 768, 7901}, {417, 769, 7899}, {417, 771, 7905}, {417, 777, 7903},
+        {417, 803, 7907}, {431, 768, 7914}, {431, 769, 7912}, {431, 771, 7918}, {431, 777, 7916}, {431, 803, 7920},
+        {432, 768, 7915}, {432, 769, 7913}, {432, 771, 7919}, {432, 777, 7917}, {432, 803, 7921}, {439, 780, 494},
+        {490, 772, 492}, {491, 772, 493}, {550, 772, 480}, {551, 772, 481}, {552, 774, 7708}, {553, 774, 7709},
+        {558, 772, 560}, {559, 772, 561}, {658, 780, 495}, {913, 768, 8122}, {913, 769, 902}, {913, 772, 8121},
+        {913, 774, 8120}, {913, 787, 7944}, {913, 788, 7945}, {913, 837, 8124}, {917, 768, 8136}, {917, 769, 904},
+        {917, 787, 7960}, {917, 788, 7961}, {919, 768, 8138}, {919, 769, 905}, {919, 787, 7976}, {919, 788, 7977},
+        {919, 837, 8140}, {921, 768, 8154}, {921, 769, 906}, {921, 772, 8153}, {921, 774, 8152}, {921, 776, 938},
+        {921, 787, 7992}, {921, 788, 7993}, {927, 768, 8184}, {927, 769, 908}, {927, 787, 8008}, {927, 788, 8009},
+        {929, 788, 8172}, {933, 768, 8170}, {933, 769, 910}, {933, 772, 8169}, {933, 774, 8168}, {933, 776, 939},
+        {933, 788, 8025}, {937, 768, 8186}, {937, 769, 911}, {937, 787, 8040}, {937, 788, 8041}, {937, 837, 8188},
+        {940, 837, 8116}, {942, 837, 8132}, {945, 768, 8048}, {945, 769, 940}, {945, 772, 8113}, {945, 774, 8112},
+        {945, 787, 7936}, {945, 788, 7937}, {945, 834, 8118}, {945, 837, 8115}, {949, 768, 8050}, {949, 769, 941},
+        {949, 787, 7952}, {949, 788, 7953}, {951, 768, 8052}, {951, 769, 942}, {951, 787, 7968}, {951, 788, 7969},
+        {951, 834, 8134}, {951, 837, 8131}, {953, 768, 8054}, {953, 769, 943}, {953, 772, 8145}, {953, 774, 8144},
+        {953, 776, 970}, {953, 787, 7984}, {953, 788, 7985}, {953, 834, 8150}, {959, 768, 8056}, {959, 769, 972},
+        {959, 787, 8000}, {959, 788, 8001}, {961, 787, 8164}, {961, 788, 8165}, {965, 768, 8058}, {965, 769, 973},
+        {965, 772, 8161}, {965, 774, 8160}, {965, 776, 971}, {965, 787, 8016}, {965, 788, 8017}, {965, 834, 8166},
+        {969, 768, 8060}, {969, 769, 974}, {969, 787, 8032}, {969, 788, 8033}, {969, 834, 8182}, {969, 837, 8179},
+        {970, 768, 8146}, {970, 769, 912}, {970, 834, 8151}, {971, 768, 8162}, {971, 769, 944}, {971, 834, 8167},
+        {974, 837, 8180}, {978, 769, 979}, {978, 776, 980}, {1030, 776, 1031}, {1040, 774, 1232}, {1040, 776, 1234},
+        {1043, 769, 1027}, {1045, 768, 1024}, {1045, 774, 1238}, {1045, 776, 1025}, {1046, 774, 1217}, {1046, 776, 1244},
+        {1047, 776, 1246}, {1048, 768, 1037}, {1048, 772, 1250}, {1048, 774, 1049}, {1048, 776, 1252}, {1050, 769, 1036},
+        {1054, 776, 1254}, {1059, 772, 1262}, {1059, 774, 1038}, {1059, 776, 1264}, {1059, 779, 1266}, {1063, 776, 1268},
+        {1067, 776, 1272}, {1069, 776, 1260}, {1072, 774, 1233}, {1072, 776, 1235}, {1075, 769, 1107}, {1077, 768, 1104},
+        {1077, 774, 1239}, {1077, 776, 1105}, {1078, 774, 1218}, {1078, 776, 1245}, {1079, 776, 1247}, {1080, 768, 1117},
+        {1080, 772, 1251}, {1080, 774, 1081}, {1080, 776, 1253}, {1082, 769, 1116}, {1086, 776, 1255}, {1091, 772, 1263},
+        {1091, 774, 1118}, {1091, 776, 1265}, {1091, 779, 1267}, {1095, 776, 1269}, {1099, 776, 1273}, {1101, 776, 1261},
+        {1110, 776, 1111}, {1140, 783, 1142}, {1141, 783, 1143}, {1240, 776, 1242}, {1241, 776, 1243}, {1256, 776, 1258},
+        {1257, 776, 1259}, {1575, 1619, 1570}, {1575, 1620, 1571}, {1575, 1621, 1573}, {1608, 1620, 1572}, {1610, 1620, 1574},
+        {1729, 1620, 1730}, {1746, 1620, 1747}, {1749, 1620, 1728}, {2344, 2364, 2345}, {2352, 2364, 2353}, {2355, 2364, 2356},
+        {2503, 2494, 2507}, {2503, 2519, 2508}, {2887, 2878, 2891}, {2887, 2902, 2888}, {2887, 2903, 2892}, {2962, 3031, 2964},
+        {3014, 3006, 3018}, {3014, 3031, 3020}, {3015, 3006, 3019}, {3142, 3158, 3144}, {3263, 3285, 3264}, {3270, 3266, 3274},
+        {3270, 3285, 3271}, {3270, 3286, 3272}, {3274, 3285, 3275}, {3398, 3390, 3402}, {3398, 3415, 3404}, {3399, 3390, 3403},
+        {3545, 3530, 3546}, {3545, 3535, 3548}, {3545, 3551, 3550}, {3548, 3530, 3549}, {4133, 4142, 4134}, {6917, 6965, 6918},
+        {6919, 6965, 6920}, {6921, 6965, 6922}, {6923, 6965, 6924}, {6925, 6965, 6926}, {6929, 6965, 6930}, {6970, 6965, 6971},
+        {6972, 6965, 6973}, {6974, 6965, 6976}, {6975, 6965, 6977}, {6978, 6965, 6979}, {7734, 772, 7736}, {7735, 772, 7737},
+        {7770, 772, 7772}, {7771, 772, 7773}, {7778, 775, 7784}, {7779, 775, 7785}, {7840, 770, 7852}, {7840, 774, 7862},
+        {7841, 770, 7853}, {7841, 774, 7863}, {7864, 770, 7878}, {7865, 770, 7879}, {7884, 770, 7896}, {7885, 770, 7897},
+        {7936, 768, 7938}, {7936, 769, 7940}, {7936, 834, 7942}, {7936, 837, 8064}, {7937, 768, 7939}, {7937, 769, 7941},
+        {7937, 834, 7943}, {7937, 837, 8065}, {7938, 837, 8066}, {7939, 837, 8067}, {7940, 837, 8068}, {7941, 837, 8069},
+        {7942, 837, 8070}, {7943, 837, 8071}, {7944, 768, 7946}, {7944, 769, 7948}, {7944, 834, 7950}, {7944, 837, 8072},
+        {7945, 768, 7947}, {7945, 769, 7949}, {7945, 834, 7951}, {7945, 837, 8073}, {7946, 837, 8074}, {7947, 837, 8075},
+        {7948, 837, 8076}, {7949, 837, 8077}, {7950, 837, 8078}, {7951, 837, 8079}, {7952, 768, 7954}, {7952, 769, 7956},
+        {7953, 768, 7955}, {7953, 769, 7957}, {7960, 768, 7962}, {7960, 769, 7964}, {7961, 768, 7963}, {7961, 769, 7965},
+        {7968, 768, 7970}, {7968, 769, 7972}, {7968, 834, 7974}, {7968, 837, 8080}, {7969, 768, 7971}, {7969, 769, 7973},
+        {7969, 834, 7975}, {7969, 837, 8081}, {7970, 837, 8082}, {7971, 837, 8083}, {7972, 837, 8084}, {7973, 837, 8085},
+        {7974, 837, 8086}, {7975, 837, 8087}, {7976, 768, 7978}, {7976, 769, 7980}, {7976, 834, 7982}, {7976, 837, 8088},
+        {7977, 768, 7979}, {7977, 769, 7981}, {7977, 834, 7983}, {7977, 837, 8089}, {7978, 837, 8090}, {7979, 837, 8091},
+        {7980, 837, 8092}, {7981, 837, 8093}, {7982, 837, 8094}, {7983, 837, 8095}, {7984, 768, 7986}, {7984, 769, 7988},
+        {7984, 834, 7990}, {7985, 768, 7987}, {7985, 769, 7989}, {7985, 834, 7991}, {7992, 768, 7994}, {7992, 769, 7996},
+        {7992, 834, 7998}, {7993, 768, 7995}, {7993, 769, 7997}, {7993, 834, 7999}, {8000, 768, 8002}, {8000, 769, 8004},
+        {8001, 768, 8003}, {8001, 769, 8005}, {8008, 768, 8010}, {8008, 769, 8012}, {8009, 768, 8011}, {8009, 769, 8013},
+        {8016, 768, 8018}, {8016, 769, 8020}, {8016, 834, 8022}, {8017, 768, 8019}, {8017, 769, 8021}, {8017, 834, 8023},
+        {8025, 768, 8027}, {8025, 769, 8029}, {8025, 834, 8031}, {8032, 768, 8034}, {8032, 769, 8036}, {8032, 834, 8038},
+        {8032, 837, 8096}, {8033, 768, 8035}, {8033, 769, 8037}, {8033, 834, 8039}, {8033, 837, 8097}, {8034, 837, 8098},
+        {8035, 837, 8099}, {8036, 837, 8100}, {8037, 837, 8101}, {8038, 837, 8102}, {8039, 837, 8103}, {8040, 768, 8042},
+        {8040, 769, 8044}, {8040, 834, 8046}, {8040, 837, 8104}, {8041, 768, 8043}, {8041, 769, 8045}, {8041, 834, 8047},
+        {8041, 837, 8105}, {8042, 837, 8106}, {8043, 837, 8107}, {8044, 837, 8108}, {8045, 837, 8109}, {8046, 837, 8110},
+        {8047, 837, 8111}, {8048, 837, 8114}, {8052, 837, 8130}, {8060, 837, 8178}, {8118, 837, 8119}, {8127, 768, 8141},
+        {8127, 769, 8142}, {8127, 834, 8143}, {8134, 837, 8135}, {8182, 837, 8183}, {8190, 768, 8157}, {8190, 769, 8158},
+        {8190, 834, 8159}, {8592, 824, 8602}, {8594, 824, 8603}, {8596, 824, 8622}, {8656, 824, 8653}, {8658, 824, 8655},
+        {8660, 824, 8654}, {8707, 824, 8708}, {8712, 824, 8713}, {8715, 824, 8716}, {8739, 824, 8740}, {8741, 824, 8742},
+        {8764, 824, 8769}, {8771, 824, 8772}, {8773, 824, 8775}, {8776, 824, 8777}, {8781, 824, 8813}, {8801, 824, 8802},
+        {8804, 824, 8816}, {8805, 824, 8817}, {8818, 824, 8820}, {8819, 824, 8821}, {8822, 824, 8824}, {8823, 824, 8825},
+        {8826, 824, 8832}, {8827, 824, 8833}, {8828, 824, 8928}, {8829, 824, 8929}, {8834, 824, 8836}, {8835, 824, 8837},
+        {8838, 824, 8840}, {8839, 824, 8841}, {8849, 824, 8930}, {8850, 824, 8931}, {8866, 824, 8876}, {8872, 824, 8877},
+        {8873, 824, 8878}, {8875, 824, 8879}, {8882, 824, 8938}, {8883, 824, 8939}, {8884, 824, 8940}, {8885, 824, 8941},
+        {12358, 12441, 12436}, {12363, 12441, 12364}, {12365, 12441, 12366}, {12367, 12441, 12368}, {12369, 12441, 12370}, {12371, 12441, 12372},
+        {12373, 12441, 12374}, {12375, 12441, 12376}, {12377, 12441, 12378}, {12379, 12441, 12380}, {12381, 12441, 12382}, {12383, 12441, 12384},
+        {12385, 12441, 12386}, {12388, 12441, 12389}, {12390, 12441, 12391}, {12392, 12441, 12393}, {12399, 12441, 12400}, {12399, 12442, 12401},
+        {12402, 12441, 12403}, {12402, 12442, 12404}, {12405, 12441, 12406}, {12405, 12442, 12407}, {12408, 12441, 12409}, {12408, 12442, 12410},
+        {12411, 12441, 12412}, {12411, 12442, 12413}, {12445, 12441, 12446}, {12454, 12441, 12532}, {12459, 12441, 12460}, {12461, 12441, 12462},
+        {12463, 12441, 12464}, {12465, 12441, 12466}, {12467, 12441, 12468}, {12469, 12441, 12470}, {12471, 12441, 12472}, {12473, 12441, 12474},
+        {12475, 12441, 12476}, {12477, 12441, 12478}, {12479, 12441, 12480}, {12481, 12441, 12482}, {12484, 12441, 12485}, {12486, 12441, 12487},
+        {12488, 12441, 12489}, {12495, 12441, 12496}, {12495, 12442, 12497}, {12498, 12441, 12499}, {12498, 12442, 12500}, {12501, 12441, 12502},
+        {12501, 12442, 12503}, {12504, 12441, 12505}, {12504, 12442, 12506}, {12507, 12441, 12508}, {12507, 12442, 12509}, {12527, 12441, 12535},
+        {12528, 12441, 12536}, {12529, 12441, 12537}, {12530, 12441, 12538}, {12541, 12441, 12542}, {69785, 69818, 69786}, {69787, 69818, 69788},
+        {69797, 69818, 69803}, {69937, 69927, 69934}, {69938, 69927, 69935}, {70471, 70462, 70475}, {70471, 70487, 70476}, {70841, 70832, 70844},
+        {70841, 70842, 70843}, {70841, 70845, 70846}, {71096, 71087, 71098}, {71097, 71087, 71099}, {71989, 71984, 71992},
+    };
+
+}
@@ -0,0 +1,150 @@
+import os
+import sys
+import unicodedata
+
+# Generates the Unicode tables of the tokenizer from the character database bundled with Python.
+# Every table is sorted by code point and looked up with a binary search.
+# The tables are checked in and pinned to UNICODE_VERSION: they are regenerated by hand, with the unicode_data
+# target, once this script changes, and a Python bundling another version of the database is refused, so the
+# tokenizer does not change with the Python of whoever builds it.
+
+SINK = "src/engine/unicode/gen/unicode_data.h"
+UNICODE_VERSION = "14.0.0"
+MAX_CODE_POINT = 0x110000
+
+STRUCTS = """    struct Range
+    {
+        uint32_t first;
+        uint8_t value;
+    };
+
+    struct Mapping
+    {
+        uint32_t from;
+        uint32_t to;
+    };
+
+    struct Decomposition
+    {
+        uint32_t cp;
+        uint32_t first;
+        uint32_t second;
+    };
+
+    struct Composition
+    {
+        uint32_t first;
+        uint32_t second;
+        uint32_t composite;
+    };
+
+"""
+
+# WordClass in unicode.h
+OTHER, LETTER, KATAKANA, IDEOGRAPH, EXTEND = range(5)
+
+
+def word_class(cp):
+    ch = chr(cp)
+    category = unicodedata.category(ch)
+    name = unicodedata.name(ch, "")
+    # apostrophes are token characters, as ' is for ASCII texts
+    if cp in (0x27, 0x2019):
+        return LETTER
+    if cp == 0x200B:
+        return OTHER
+    if category in ("Mn", "Mc", "Me", "Cf"):
+        return EXTEND
+    if name.startswith(("KATAKANA", "HALFWIDTH KATAKANA", "CIRCLED KATAKANA")):
+        return KATAKANA if category[0] == "L" else OTHER
+    if name.startswith(("CJK UNIFIED IDEOGRAPH", "CJK COMPATIBILITY IDEOGRAPH", "HIRAGANA")) or cp in (0x3005, 0x3007):
+        return IDEOGRAPH if category[0] == "L" or category == "Nl" else OTHER
+    if category in ("Lu", "Ll", "Lt", "Lm", "Lo", "Nl"):
+        return LETTER
+    return OTHER
+
+
+def simple_fold(cp):
+    # the C and S mappings of CaseFolding.txt: a single code point folding into a single code point
+    ch = chr(cp)
+    for folded in (ch.casefold(), ch.lower()):
+        if len(folded) == 1 and folded != ch:
+            return ord(folded)
+    return cp
+
+
+def canonical_decomposition(cp):
+    decomposition = unicodedata.decomposition(chr(cp))
+    if not decomposition or decomposition.startswith("<"):
+        return None
+    return [int(part, 16) for part in decomposition.split()]
+
+
+def ranges(values):
+    # runs of code points sharing a value, as (first code point, value) pairs
+    res = []
+    previous = None
+    for cp in range(MAX_CODE_POINT):
+        value = values(cp)
+        if value != previous:
+            res.append((cp, value))
+            previous = value
+    return res
+
+
+def main():
+    if unicodedata.unidata_version != UNICODE_VERSION:
+        sys.stderr.write("Python bundles Unicode %s, the tables are pinned to Unicode %s\n"
+                         % (unicodedata.unidata_version, UNICODE_VERSION))
+        return 1
+
+    word_classes = ranges(word_class)
+    combining_classes = ranges(lambda cp: unicodedata.combining(chr(cp)))
+    folds = [(cp, simple_fold(cp)) for cp in range(MAX_CODE_POINT) if simple_fold(cp) != cp]
+
+    decompositions = []
+    compositions = []
+    for cp in range(MAX_CODE_POINT):
+        parts = canonical_decomposition(cp)
+        if parts is None:
+            continue
+        decompositions.append((cp, parts[0], parts[1] if len(parts) > 1 else 0))
+        if len(parts) == 2 and unicodedata.normalize("NFC", chr(parts[0]) + chr(parts[1])) == chr(cp):
+            compositions.append((parts[0], parts[1], cp))
+    compositions.sort()
+
+    # code points that may change under NFC, or make a preceding one change: the ones NFC does not keep
+    # as they are, combining marks, the second code point of a composition and conjoining Hangul jamo
+    composing = set(second for _, second, _ in compositions)
+    composing.update(range(0x1161, 0x1176))
+    composing.update(range(0x11A8, 0x11C3))
+    unstable = ranges(lambda cp: int(cp in composing or unicodedata.combining(chr(cp)) != 0 or
+                                     unicodedata.normalize("NFC", chr(cp)) != chr(cp)))
+
+    os.makedirs(os.path.dirname(SINK), exist_ok=True)
+    with open(SINK, "w") as sink:
+        sink.write("#pragma once\n\n")
+        sink.write("// generated by src/engine/unicode/generator.py from Unicode %s, do not edit\n\n"
+                   % UNICODE_VERSION)
+        sink.write("#include <cstdint>\n\n")
+        sink.write("namespace core::unicode::data\n{\n")
+        sink.write(STRUCTS)
+        write_table(sink, "Range", "WordClasses", word_classes)
+        write_table(sink, "Range", "CombiningClasses", combining_classes)
+        write_table(sink, "Range", "Unstable", unstable)
+        write_table(sink, "Mapping", "Folds", folds)
+        write_table(sink, "Decomposition", "Decompositions", decompositions)
+        write_table(sink, "Composition", "Compositions", compositions)
+        sink.write("}\n")
+
+
+def write_table(sink, entry, name, rows):
+    sink.write("    constexpr %s %s[] = {\n" % (entry, name))
+    for i in range(0, len(rows), 6):
+        line = ", ".join("{" + ", ".join(str(value) for value in row) + "}" for row in rows[i:i + 6])
+        sink.write("        " + line + ",\n")
+    sink.write("    };\n\n")
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -68,7 +68,13 @@ namespace core
                 bool shouldErase = false;
                 if (record == m_data.end())
                 {
-                    m_data.push_back(std::make_pair(key, callback(record, false, shouldErase)));
+                    Value value = callback(record, false, shouldErase);
+                    if (shouldErase)
+                    {
+                        diff = 0;
+                        return;
+                    }
+                    m_data.push_back(std::make_pair(key, std::move(value)));
                     diff = 1;
                     return;
                 }
@@ -270,7 +276,8 @@ namespace core
             /**
             * Allows client to execute custom logic on a locked iterator. The client can
             * choose to either modify an existing value if the second callback parameter
-            * is true or return a new one if the said parameter is false.
+            * is true or return a new one if the said parameter is false. Setting shouldErase
+            * either erases the existing value or discards the new one.
             */
             std::shared_lock<std::shared_mutex> lock(m_globalMtx);
             int diff = 0;
@@ -154,7 +154,7 @@ namespace core
         }
 
         template<typename URValue>
-        void addIfNotPresent(URValue&& value)
+        bool addIfNotPresent(URValue&& value)
         {
             static_assert(std::is_constructible_v<Value, std::decay_t<URValue>>);
 
@@ -165,6 +165,7 @@ namespace core
             {
                 m_size++;
             }
+            return !isPresentAlready;
         }
 
         bool erase(const Value& value)
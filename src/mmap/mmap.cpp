@@ -20,12 +20,15 @@ MMapASCII::MMapASCII(const std::string& path)
         throw std::runtime_error("Failed to map resource");
     }
 
-    m_view = m_internal;
+    m_view = std::string_view(m_internal, m_fileSize);
 }
 
 MMapASCII::~MMapASCII()
 {
-    munmap(m_internal, m_fileSize);
+    if (m_fileSize > 0)
+    {
+        munmap(m_internal, m_fileSize);
+    }
     close(m_fd);
 }
 
@@ -37,4 +40,12 @@ char MMapASCII::operator[](size_t i) const noexcept
 size_t MMapASCII::size() const noexcept
 {
     return m_view.size();
+}
+
+void MMapASCII::willNeed() const noexcept
+{
+    if (m_fileSize > 0)
+    {
+        madvise(m_internal, m_fileSize, MADV_WILLNEED);
+    }
 }
\ No newline at end of file
@@ -15,6 +15,10 @@ public:
     MMapASCII& operator=(MMapASCII&& other) noexcept = default;
     char operator[](size_t i) const noexcept;
     size_t size() const noexcept;
+    /**
+    * asks the kernel to read the file ahead, so touching it later faults on pages already cached
+    */
+    void willNeed() const noexcept;
 
     inline auto cbegin() const noexcept
     {
@@ -36,9 +40,14 @@ public:
         return cend();
     }
 
+    inline std::string_view view() const noexcept
+    {
+        return m_view;
+    }
+
 private:
     int m_fd;
     size_t m_fileSize;
-    char* m_internal;
+    char* m_internal{nullptr};
     std::string_view m_view;
 };
\ No newline at end of file
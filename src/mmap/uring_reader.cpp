@@ -0,0 +1,316 @@
+#include "uring_reader.h"
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <cerrno>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+struct ReadBuffer::Pool
+{
+    /**
+    * count buffers of BufferSize bytes in a single allocation, the ones not handed out are listed in free
+    */
+    explicit Pool(size_t count)
+        : memory(std::make_unique<char[]>(count * UringReader::BufferSize))
+    {
+        for (size_t idx = count; idx > 0; idx--)
+        {
+            free.push_back(idx - 1);
+        }
+    }
+
+    char* data(size_t idx) const
+    {
+        return memory.get() + idx * UringReader::BufferSize;
+    }
+
+    void acquire(size_t count, std::vector<size_t>& idxs)
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        released.wait(lock, [this, count] {
+            return free.size() >= count;
+        });
+        idxs.assign(free.end() - count, free.end());
+        free.resize(free.size() - count);
+    }
+
+    void release(size_t idx)
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        free.push_back(idx);
+        released.notify_one();
+    }
+
+    const std::unique_ptr<char[]> memory;
+    std::mutex mtx;
+    std::condition_variable released;
+    std::vector<size_t> free;
+};
+
+ReadBuffer::ReadBuffer(std::shared_ptr<Pool> pool, size_t idx, size_t size)
+    : m_pool(std::move(pool))
+    , m_idx(idx)
+    , m_view(m_pool->data(idx), size)
+{
+}
+
+ReadBuffer::~ReadBuffer()
+{
+    m_pool->release(m_idx);
+}
+
+std::string_view ReadBuffer::view() const noexcept
+{
+    return m_view;
+}
+
+struct UringReader::Ring
+{
+    /**
+    * the submission and completion rings shared with the kernel, see io_uring_setup(2)
+    */
+    explicit Ring(unsigned entries)
+    {
+        io_uring_params params{};
+        fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+        if (fd < 0)
+        {
+            throw std::runtime_error("io_uring is not available");
+        }
+
+        sqSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cqSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool isSingleMmap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (isSingleMmap)
+        {
+            sqSize = cqSize = std::max(sqSize, cqSize);
+        }
+        sq = mmap(nullptr, sqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+        cq = isSingleMmap ? sq
+                          : mmap(nullptr, cqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                                 IORING_OFF_CQ_RING);
+        sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        sqes = mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+        if (sq == MAP_FAILED || cq == MAP_FAILED || sqes == MAP_FAILED)
+        {
+            unmap();
+            close(fd);
+            throw std::runtime_error("Failed to map io_uring");
+        }
+
+        char* sqBase = static_cast<char*>(sq);
+        char* cqBase = static_cast<char*>(cq);
+        sqTail = reinterpret_cast<unsigned*>(sqBase + params.sq_off.tail);
+        sqMask = *reinterpret_cast<unsigned*>(sqBase + params.sq_off.ring_mask);
+        sqArray = reinterpret_cast<unsigned*>(sqBase + params.sq_off.array);
+        cqHead = reinterpret_cast<unsigned*>(cqBase + params.cq_off.head);
+        cqTail = reinterpret_cast<unsigned*>(cqBase + params.cq_off.tail);
+        cqMask = *reinterpret_cast<unsigned*>(cqBase + params.cq_off.ring_mask);
+        cqes = reinterpret_cast<io_uring_cqe*>(cqBase + params.cq_off.cqes);
+        tail = *sqTail;
+    }
+
+    ~Ring()
+    {
+        unmap();
+        close(fd);
+    }
+
+    void unmap()
+    {
+        if (sqes != MAP_FAILED)
+        {
+            munmap(sqes, sqesSize);
+        }
+        if (cq != MAP_FAILED && cq != sq)
+        {
+            munmap(cq, cqSize);
+        }
+        if (sq != MAP_FAILED)
+        {
+            munmap(sq, sqSize);
+        }
+    }
+
+    io_uring_sqe* next()
+    {
+        /**
+        * the next free entry, published to the kernel by complete
+        */
+        const unsigned idx = tail++ & sqMask;
+        io_uring_sqe* sqe = static_cast<io_uring_sqe*>(sqes) + idx;
+        std::memset(sqe, 0, sizeof(io_uring_sqe));
+        sqArray[idx] = idx;
+        return sqe;
+    }
+
+    int fd{-1};
+    void* sq{MAP_FAILED};
+    void* cq{MAP_FAILED};
+    void* sqes{MAP_FAILED};
+    size_t sqSize{0};
+    size_t cqSize{0};
+    size_t sqesSize{0};
+    unsigned* sqTail{nullptr};
+    unsigned sqMask{0};
+    unsigned* sqArray{nullptr};
+    unsigned* cqHead{nullptr};
+    unsigned* cqTail{nullptr};
+    unsigned cqMask{0};
+    io_uring_cqe* cqes{nullptr};
+    unsigned tail{0};
+};
+
+UringReader::UringReader(size_t batch)
+    : m_batch(batch > 0 ? batch : 1)
+    , m_ring(std::make_unique<Ring>(static_cast<unsigned>(m_batch)))
+    , m_pool(std::make_shared<ReadBuffer::Pool>(m_batch * 2))
+{
+    /**
+    * buffers in flight down the pipeline are replaced by free ones, so there are twice as many as a batch takes
+    */
+    std::vector<iovec> iovecs(m_batch * 2);
+    for (size_t idx = 0; idx < iovecs.size(); idx++)
+    {
+        iovecs[idx] = {m_pool->data(idx), BufferSize};
+    }
+    if (syscall(__NR_io_uring_register, m_ring->fd, IORING_REGISTER_BUFFERS, iovecs.data(), iovecs.size()) < 0)
+    {
+        throw std::runtime_error("Failed to register io_uring buffers");
+    }
+}
+
+UringReader::~UringReader() = default;
+
+size_t UringReader::batch() const noexcept
+{
+    return m_batch;
+}
+
+bool UringReader::complete(size_t count, const std::function<void(size_t tag, int result)>& onResult)
+{
+    if (count == 0)
+    {
+        return true;
+    }
+    __atomic_store_n(m_ring->sqTail, m_ring->tail, __ATOMIC_RELEASE);
+
+    size_t submitted = 0;
+    size_t completed = 0;
+    while (completed < count)
+    {
+        const long res = syscall(__NR_io_uring_enter, m_ring->fd, count - submitted, count - completed,
+                                 IORING_ENTER_GETEVENTS, nullptr, 0);
+        if (res < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY)
+        {
+            /**
+            * requests left in the ring would complete on the next batch, so the reader is not used again
+            */
+            m_isBroken = true;
+            return false;
+        }
+        submitted += res > 0 ? res : 0;
+
+        unsigned head = *m_ring->cqHead;
+        const unsigned cqTail = __atomic_load_n(m_ring->cqTail, __ATOMIC_ACQUIRE);
+        for (; head != cqTail; head++, completed++)
+        {
+            const io_uring_cqe& cqe = m_ring->cqes[head & m_ring->cqMask];
+            onResult(cqe.user_data, cqe.res);
+        }
+        __atomic_store_n(m_ring->cqHead, head, __ATOMIC_RELEASE);
+    }
+    return true;
+}
+
+void UringReader::read(const std::vector<std::string>& paths, std::vector<ReadBufferPtr>& buffers)
+{
+    buffers.clear();
+    buffers.resize(paths.size());
+    const size_t count = std::min(paths.size(), m_batch);
+    if (count == 0 || m_isBroken)
+    {
+        return;
+    }
+    std::vector<size_t> idxs;
+    m_pool->acquire(count, idxs);
+
+    /**
+    * the files are opened, read and closed in three rounds, each taking a single submission
+    */
+    std::vector<int> fds(count, -1);
+    for (size_t i = 0; i < count; i++)
+    {
+        io_uring_sqe* sqe = m_ring->next();
+        sqe->opcode = IORING_OP_OPENAT;
+        sqe->fd = AT_FDCWD;
+        sqe->addr = reinterpret_cast<uint64_t>(paths[i].c_str());
+        sqe->open_flags = O_RDONLY | O_CLOEXEC;
+        sqe->user_data = i;
+    }
+    bool ok = complete(count, [&fds](size_t i, int fd) {
+        fds[i] = fd;
+    });
+
+    std::vector<int> sizes(count, -1);
+    size_t opened = 0;
+    for (size_t i = 0; ok && i < count; i++)
+    {
+        if (fds[i] < 0)
+        {
+            continue;
+        }
+        io_uring_sqe* sqe = m_ring->next();
+        sqe->opcode = IORING_OP_READ_FIXED;
+        sqe->fd = fds[i];
+        sqe->addr = reinterpret_cast<uint64_t>(m_pool->data(idxs[i]));
+        sqe->len = BufferSize;
+        sqe->off = 0;
+        sqe->buf_index = idxs[i];
+        sqe->user_data = i;
+        opened++;
+    }
+    ok = ok && complete(opened, [&sizes](size_t i, int size) {
+        sizes[i] = size;
+    });
+
+    size_t closed = 0;
+    for (size_t i = 0; ok && i < count; i++)
+    {
+        if (fds[i] < 0)
+        {
+            continue;
+        }
+        io_uring_sqe* sqe = m_ring->next();
+        sqe->opcode = IORING_OP_CLOSE;
+        sqe->fd = fds[i];
+        sqe->user_data = i;
+        closed++;
+    }
+    ok = ok && complete(closed, [](size_t, int) {
+    });
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!ok && fds[i] >= 0)
+        {
+            close(fds[i]);
+        }
+        /**
+        * a file filling the buffer may be larger than it, it is left to the caller
+        */
+        if (ok && sizes[i] >= 0 && static_cast<size_t>(sizes[i]) < BufferSize)
+        {
+            buffers[i] = std::make_unique<ReadBuffer>(m_pool, idxs[i], sizes[i]);
+            continue;
+        }
+        m_pool->release(idxs[i]);
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class ReadBuffer
+{
+    /**
+    * a file read into one of the buffers of a UringReader, the buffer is handed back on destruction
+    */
+public:
+    struct Pool;
+
+    ReadBuffer(std::shared_ptr<Pool> pool, size_t idx, size_t size);
+    ~ReadBuffer();
+    ReadBuffer(const ReadBuffer& other) = delete;
+    ReadBuffer& operator=(const ReadBuffer& other) = delete;
+    std::string_view view() const noexcept;
+
+private:
+    std::shared_ptr<Pool> m_pool;
+    size_t m_idx;
+    std::string_view m_view;
+};
+
+using ReadBufferPtr = std::unique_ptr<ReadBuffer>;
+
+class UringReader
+{
+    /**
+    * UringReader reads batches of small files through io_uring: the files of a batch are opened with one
+    * submission, read into buffers registered with the ring with another and closed with a third, instead
+    * of every file taking an open, an fstat, an mmap, page faults and a munmap of its own. The ring is set
+    * up with raw system calls, so there is no dependency on liburing.
+    *
+    * A reader and its ring belong to a single thread. The buffers live as long as any of the ReadBuffers
+    * handed out, so the files read can travel further down a pipeline, and are reused once released.
+    * Construction throws when the kernel does not provide io_uring, callers are expected to fall back to
+    * MMapASCII then, as they do for files of BufferSize bytes or more
+    */
+public:
+    static constexpr size_t BufferSize = size_t{1} << 16;
+
+    explicit UringReader(size_t batch);
+    ~UringReader();
+    UringReader(const UringReader& other) = delete;
+    UringReader& operator=(const UringReader& other) = delete;
+    size_t batch() const noexcept;
+    /**
+    * reads up to batch files, buffers[i] is null when paths[i] could not be read or holds BufferSize bytes
+    * or more. Waits for enough buffers to be released if need be
+    */
+    void read(const std::vector<std::string>& paths, std::vector<ReadBufferPtr>& buffers);
+
+private:
+    struct Ring;
+
+    /**
+    * submits the count requests queued and passes the result of each to onResult along with its tag
+    */
+    bool complete(size_t count, const std::function<void(size_t tag, int result)>& onResult);
+
+private:
+    size_t m_batch;
+    bool m_isBroken{false};
+    std::unique_ptr<Ring> m_ring;
+    std::shared_ptr<ReadBuffer::Pool> m_pool;
+};
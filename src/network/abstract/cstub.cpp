@@ -1,4 +1,6 @@
 #include "cstub.h"
+#include <netdb.h>
+#include <stdexcept>
 
 namespace net::stub
 {
@@ -10,6 +12,31 @@ namespace net::stub
         m_servInfoLen = sizeof(m_serverInfo);
     }
 
+    AbstractClientStub::AbstractClientStub(const std::string& host, int port)
+    {
+        addrinfo hints{};
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+
+        addrinfo* info = nullptr;
+        if (getaddrinfo(host.c_str(), nullptr, &hints, &info) != 0 || !info)
+        {
+            throw std::invalid_argument("Failed to resolve host " + host);
+        }
+        m_serverInfo = *reinterpret_cast<sockaddr_in*>(info->ai_addr);
+        m_serverInfo.sin_port = htons(port);
+        m_servInfoLen = sizeof(m_serverInfo);
+        freeaddrinfo(info);
+    }
+
+    void AbstractClientStub::setTimeout(size_t timeoutMs)
+    {
+        /**
+        * bounds connecting as well as every single send/receive, 0 disables the timeout
+        */
+        m_timeoutMs = timeoutMs;
+    }
+
     bool AbstractClientStub::servConnect()
     {
         m_sfd = socket(AF_INET, SOCK_STREAM, 0);
@@ -17,6 +44,14 @@ namespace net::stub
         {
             return false;
         }
+        if (m_timeoutMs > 0)
+        {
+            timeval timeout{};
+            timeout.tv_sec = m_timeoutMs / 1000;
+            timeout.tv_usec = (m_timeoutMs % 1000) * 1000;
+            setsockopt(m_sfd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+            setsockopt(m_sfd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+        }
         if (connect(m_sfd, reinterpret_cast<sockaddr*>(&m_serverInfo), m_servInfoLen) < 0)
         {
             return false;
@@ -26,8 +61,13 @@ namespace net::stub
 
     void AbstractClientStub::closeConnection()
     {
+        if (m_sfd < 0)
+        {
+            return;
+        }
         shutdown(m_sfd, SHUT_WR);
         close(m_sfd);
+        m_sfd = -1;
     }
 
 }
@@ -9,18 +9,29 @@ namespace net::stub
     {
     public:
         explicit AbstractClientStub(int port = 4444);
+        AbstractClientStub(const std::string& host, int port);
         virtual ~AbstractClientStub() = default;
+        void setTimeout(size_t timeoutMs);
 
     protected:
         template <typename T>
         bool execute(const std::string& handlerName, const RequestPtr& requestPtr, T& responsePtr)
         {
-            release_assert(servConnect(), "Client failed to connect to server");
+            /**
+            * on failure the response is marked with ProtocolStatus::ProtocolError
+            */
+            if (!servConnect())
+            {
+                closeConnection();
+                responsePtr->setMetadata(ProtocolStatus::ProtocolError, "Failed to connect to server");
+                return false;
+            }
 
             std::string requestBuffer = serialize<RequestPtr>(handlerName, requestPtr);
             if (detail::write(m_sfd, requestBuffer) < 0)
             {
                 closeConnection();
+                responsePtr->setMetadata(ProtocolStatus::ProtocolError, "Failed to send request");
                 return false;
             }
             /**
@@ -31,6 +42,7 @@ namespace net::stub
             if (!optHeader.has_value())
             {
                 closeConnection();
+                responsePtr->setMetadata(ProtocolStatus::ProtocolError, "Failed to read response");
                 return false;
             }
 
@@ -39,6 +51,7 @@ namespace net::stub
             if (!optBufSize.has_value() || optBufSize.value() < header.size())
             {
                 closeConnection();
+                responsePtr->setMetadata(ProtocolStatus::ProtocolError, "Corrupted response");
                 return false;
             }
 
@@ -47,14 +60,22 @@ namespace net::stub
             if (!optBuffer.has_value())
             {
                 closeConnection();
+                responsePtr->setMetadata(ProtocolStatus::ProtocolError, "Failed to read response");
                 return false;
             }
-
-            const Packet<T> packet = deserialize<T>(header +  optBuffer.value());
-            responsePtr = packet.body;
-
             closeConnection();
-            return true;
+
+            try
+            {
+                const Packet<T> packet = deserialize<T>(header +  optBuffer.value());
+                responsePtr = packet.body;
+            }
+            catch (const std::exception& err)
+            {
+                responsePtr->setMetadata(ProtocolStatus::ProtocolError, "Corrupted response");
+                return false;
+            }
+            return responsePtr->getStatus() == ProtocolStatus::OK;
         }
 
     private:
@@ -62,9 +83,10 @@ namespace net::stub
         void closeConnection();
 
     private:
-        int m_sfd;
+        int m_sfd{-1};
         sockaddr_in m_serverInfo{0};
         socklen_t m_servInfoLen{0};
+        size_t m_timeoutMs{0};
     };
 
 }// namespace stub
\ No newline at end of file
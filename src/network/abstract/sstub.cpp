@@ -43,12 +43,25 @@ namespace net::stub
             return false;
         }
 
+        /**
+        * a restarted server binds its port right away, rather than once connections of the last run time out
+        */
+        const int reuse = 1;
+        if (setsockopt(m_sfd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)) < 0)
+        {
+            return false;
+        }
+
         m_infoLen = sizeof(m_serverInfo);
         if (bind(m_sfd, reinterpret_cast<sockaddr*>(&m_serverInfo), m_infoLen) < 0)
         {
             return false;
         }
-        if (::listen(m_sfd, 0) < 0)
+        /**
+        * connections queue up while the accept thread reads the frame of the previous one, a short
+        * backlog makes bursts of clients retry or fail
+        */
+        if (::listen(m_sfd, SOMAXCONN) < 0)
         {
             return false;
         }
@@ -47,8 +47,11 @@ namespace net
             {
                 size_t toRead = std::min(detail::ChunkSize, bytes - buffer.size());
                 ssize_t r = ::read(fd, chunk, toRead);
-                if (r < 0)
+                if (r <= 0)
                 {
+                    /**
+                    * either an error (including a timeout) or the peer has closed the connection
+                    */
                     return {};
                 }
 
@@ -0,0 +1,628 @@
+#include "coordinator.h"
+#include "../engine/paging.h"
+#include "../engine/routing.h"
+#include "../engine/term_dict.h"
+#include "timer.h"
+#include <filesystem>
+#include <fstream>
+#include <map>
+
+namespace anechka
+{
+    /**
+    * default page sizes, a request may ask for up to "max_search_limit" results
+    */
+    static constexpr size_t SearchThreshold = 50;
+    static constexpr size_t TopK = 20;
+    static constexpr size_t TermExpansionLimit = 10;
+
+    Coordinator::Coordinator(const std::string& configPath)
+    {
+        config(configPath);
+    }
+
+    void Coordinator::config(const std::string& configPath)
+    {
+        std::ifstream file(configPath);
+        if (file.fail())
+        {
+            throw std::invalid_argument("Invalid path to config file");
+        }
+
+        const Json config = Json::parse(file);
+        const size_t hardwareThreads = std::thread::hardware_concurrency();
+
+        m_port = utils::getJsonProperty<int>(config, "port", 4444);
+        m_threadCount = utils::getJsonProperty<size_t>(config, "serv_threads", hardwareThreads);
+        m_timeoutMs = utils::getJsonProperty<size_t>(config, "backend_timeout_ms", 2000);
+        m_maxSearchLimit = utils::getJsonProperty<size_t>(config, "max_search_limit", 1000);
+        const size_t maxInFlightFiles = utils::getJsonProperty<size_t>(config, "max_inflight_files", 64);
+        const Json backends = config.contains("backends") ? config.at("backends") : Json::array();
+        for (const auto& backend: backends)
+        {
+            m_backends.push_back({backend.value("host", "127.0.0.1"), backend.at("port").get<int>()});
+        }
+        if (m_backends.empty())
+        {
+            throw std::invalid_argument("Coordinator requires at least one backend");
+        }
+
+        /**
+        * workers mostly wait on backend sockets, every backend gets a full set of them
+        */
+        m_pool = std::make_unique<core::ThreadPool>(m_backends.size(), m_threadCount > 0 ? m_threadCount : 1, true);
+        m_jobs = std::make_unique<core::IndexJobs>(maxInFlightFiles);
+    }
+
+    size_t Coordinator::backendIdx(const std::string& path) const
+    {
+        return core::routing::backend(path, m_backends.size());
+    }
+
+    ClientStub Coordinator::stub(size_t backendIdx) const
+    {
+        const Backend& backend = m_backends[backendIdx];
+        ClientStub client(backend.host, backend.port);
+        client.setTimeout(m_timeoutMs);
+        return client;
+    }
+
+    std::string Coordinator::describe(size_t backendIdx) const
+    {
+        const Backend& backend = m_backends[backendIdx];
+        return backend.host + ":" + std::to_string(backend.port);
+    }
+
+    net::ResponsePtr Coordinator::RequestTxtFileIndexing(const net::RequestPtr& requestPtr)
+    {
+        utils::Timer timer{};
+        auto pathRequestPtr = utils::downcast<net::Path::Path>(requestPtr);
+
+        const std::string& path = pathRequestPtr->getPath();
+        const size_t idx = backendIdx(path);
+        auto responsePtr = stub(idx).RequestTxtFileIndexing(path);
+        if (responsePtr->getStatus() != net::ProtocolStatus::OK)
+        {
+            responsePtr = std::make_shared<net::InsertResponse::InsertResponse>();
+            responsePtr->getOk() = false;
+            responsePtr->getIndexsize() = 0;
+            responsePtr->getEnginestatus() = "Backend " + describe(idx) + " is unavailable";
+            responsePtr->getJobid() = 0;
+        }
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
+
+        return responsePtr;
+    }
+
+    net::ResponsePtr Coordinator::RequestRecursiveDirIndexing(const net::RequestPtr& requestPtr)
+    {
+        /**
+        * the coordinator walks the tree itself in a background job and routes every file to its backend,
+        * so backends are expected to see the same file system
+        */
+        utils::Timer timer{};
+        auto pathRequestPtr = utils::downcast<net::Path::Path>(requestPtr);
+        auto responsePtr = std::make_shared<net::InsertResponse::InsertResponse>();
+        responsePtr->getIndexsize() = 0;
+        responsePtr->getJobid() = 0;
+
+        const std::filesystem::path dirPath = std::filesystem::u8path(pathRequestPtr->getPath());
+        std::error_code err;
+        if (!std::filesystem::is_directory(dirPath, err))
+        {
+            responsePtr->getOk() = false;
+            responsePtr->getEnginestatus() = "No such directory";
+            responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
+            return responsePtr;
+        }
+
+        /**
+        * backends read and tokenize the files themselves, the pipeline of the coordinator only crawls
+        * and hands every file to the merger of its backend
+        */
+        core::IndexPipeline pipeline;
+        pipeline.merge = [this](core::IndexedFile& file) {
+            auto res = stub(backendIdx(file.path)).RequestTxtFileIndexing(file.path);
+            const bool ok = res->getStatus() == net::ProtocolStatus::OK && res->getOk();
+            return ok ? core::StageResult::Done : core::StageResult::Failed;
+        };
+        pipeline.route = [this](const core::IndexedFile& file) {
+            return backendIdx(file.path);
+        };
+        pipeline.mergers = m_backends.size();
+        responsePtr->getJobid() = m_jobs->start(dirPath, std::move(pipeline));
+        responsePtr->getOk() = true;
+        responsePtr->getEnginestatus() = "OK";
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
+
+        return responsePtr;
+    }
+
+    static void describeJob(bool found, const core::IndexJobStatus& status,
+                            const std::shared_ptr<net::JobStatusResponse::JobStatusResponse>& responsePtr)
+    {
+        responsePtr->getOk() = found;
+        responsePtr->getJobid() = status.id;
+        responsePtr->getState() = found ? core::toString(status.state) : "";
+        responsePtr->getFilesdiscovered() = status.filesDiscovered;
+        responsePtr->getFilesindexed() = status.filesIndexed;
+        responsePtr->getFilesfailed() = status.filesFailed;
+        responsePtr->getBytesprocessed() = status.bytesProcessed;
+        responsePtr->getElapsedms() = status.elapsedMs;
+        responsePtr->getBytespersec() = status.throughput();
+        for (const auto& stage: status.stages)
+        {
+            responsePtr->getStages().push_back(Json(stage).dump());
+        }
+    }
+
+    net::ResponsePtr Coordinator::RequestJobStatus(const net::RequestPtr& requestPtr)
+    {
+        /**
+        * jobs of the coordinator are its own, files it has routed count as indexed once their backend has
+        * indexed them
+        */
+        utils::Timer timer{};
+        auto jobRequestPtr = utils::downcast<net::JobRequest::JobRequest>(requestPtr);
+        auto responsePtr = std::make_shared<net::JobStatusResponse::JobStatusResponse>();
+
+        core::IndexJobStatus status{};
+        status.id = jobRequestPtr->getJobid();
+        const bool found = m_jobs->status(jobRequestPtr->getJobid(), status);
+        describeJob(found, status, responsePtr);
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
+
+        return responsePtr;
+    }
+
+    net::ResponsePtr Coordinator::RequestJobCancel(const net::RequestPtr& requestPtr)
+    {
+        utils::Timer timer{};
+        auto jobRequestPtr = utils::downcast<net::JobRequest::JobRequest>(requestPtr);
+        auto responsePtr = std::make_shared<net::JobStatusResponse::JobStatusResponse>();
+
+        core::IndexJobStatus status{};
+        status.id = jobRequestPtr->getJobid();
+        const bool found = m_jobs->cancel(jobRequestPtr->getJobid(), status);
+        describeJob(found, status, responsePtr);
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
+
+        return responsePtr;
+    }
+
+    static std::string encodeBackendCursor(size_t backendIdx, const std::string& cursor)
+    {
+        return Json{{"backend", backendIdx}, {"cursor", cursor}}.dump();
+    }
+
+    static bool decodeBackendCursor(const std::string& cursor, size_t backendCount, size_t& backendIdx,
+                                    std::string& backendCursor)
+    {
+        backendIdx = 0;
+        backendCursor.clear();
+        if (cursor.empty())
+        {
+            return true;
+        }
+        const Json json = Json::parse(cursor, nullptr, false);
+        if (json.is_discarded() || !json.is_object() || !json.contains("backend") || !json.contains("cursor") ||
+            !json.at("backend").is_number_unsigned() || !json.at("cursor").is_string())
+        {
+            return false;
+        }
+        backendIdx = json.at("backend").get<size_t>();
+        backendCursor = json.at("cursor").get<std::string>();
+        return backendIdx < backendCount;
+    }
+
+    net::ResponsePtr Coordinator::RequestTokenSearch(const net::RequestPtr& requestPtr)
+    {
+        /**
+        * results are the concatenation of the results of the backends in their order, so a page is
+        * collected from as few backends as possible, one after another. The cursor names the backend
+        * the next page starts at along with its own cursor
+        */
+        utils::Timer timer{};
+        auto tokenRequestPtr = utils::downcast<net::TokenSearchRequest::TokenSearchRequest>(requestPtr);
+        auto responsePtr = std::make_shared<net::SearchResponse::SearchResponse>();
+
+        size_t first;
+        std::string backendCursor;
+        if (!decodeBackendCursor(tokenRequestPtr->getCursor(), m_backends.size(), first, backendCursor))
+        {
+            responsePtr->setMetadata(net::ProtocolStatus::ProtocolError, "Invalid cursor");
+            return responsePtr;
+        }
+
+        const std::string& token = tokenRequestPtr->getToken();
+        const size_t limit = core::paging::limit(tokenRequestPtr->getLimit(), SearchThreshold, m_maxSearchLimit);
+        responsePtr->getPartial() = false;
+        std::vector<std::string>& merged = responsePtr->getResponse();
+        size_t idx = first;
+        for (; idx < m_backends.size() && merged.size() < limit; idx++)
+        {
+            auto res = stub(idx).RequestTokenSearch(token, limit - merged.size(), idx == first ? backendCursor : "");
+            if (res->getStatus() != net::ProtocolStatus::OK)
+            {
+                responsePtr->getPartial() = true;
+                continue;
+            }
+            responsePtr->getPartial() |= res->getPartial();
+            std::move(res->getResponse().begin(), res->getResponse().end(), std::back_inserter(merged));
+            if (!res->getNextcursor().empty())
+            {
+                responsePtr->getNextcursor() = encodeBackendCursor(idx, res->getNextcursor());
+                break;
+            }
+        }
+        if (responsePtr->getNextcursor().empty() && idx < m_backends.size())
+        {
+            responsePtr->getNextcursor() = encodeBackendCursor(idx, "");
+        }
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
+
+        return responsePtr;
+    }
+
+    net::ResponsePtr Coordinator::RequestTokenSearchWithContext(const net::RequestPtr& requestPtr)
+    {
+        utils::Timer timer{};
+        auto tokenRequestPtr = utils::downcast<net::TokenSearchRequest::TokenSearchRequest>(requestPtr);
+        auto responsePtr = std::make_shared<net::ContextSearchResponse::ContextSearchResponse>();
+
+        size_t first;
+        std::string backendCursor;
+        if (!decodeBackendCursor(tokenRequestPtr->getCursor(), m_backends.size(), first, backendCursor))
+        {
+            responsePtr->setMetadata(net::ProtocolStatus::ProtocolError, "Invalid cursor");
+            return responsePtr;
+        }
+
+        const std::string& token = tokenRequestPtr->getToken();
+        const size_t limit = core::paging::limit(tokenRequestPtr->getLimit(), SearchThreshold, m_maxSearchLimit);
+        responsePtr->getPartial() = false;
+        std::vector<std::string>& merged = responsePtr->getResponses();
+        size_t idx = first;
+        for (; idx < m_backends.size() && merged.size() < limit; idx++)
+        {
+            auto res = stub(idx).RequestTokenSearchWithContext(token, limit - merged.size(),
+                                                               idx == first ? backendCursor : "");
+            if (res->getStatus() != net::ProtocolStatus::OK)
+            {
+                responsePtr->getPartial() = true;
+                continue;
+            }
+            responsePtr->getPartial() |= res->getPartial();
+            std::move(res->getResponses().begin(), res->getResponses().end(), std::back_inserter(merged));
+            if (!res->getNextcursor().empty())
+            {
+                responsePtr->getNextcursor() = encodeBackendCursor(idx, res->getNextcursor());
+                break;
+            }
+        }
+        if (responsePtr->getNextcursor().empty() && idx < m_backends.size())
+        {
+            responsePtr->getNextcursor() = encodeBackendCursor(idx, "");
+        }
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
+
+        return responsePtr;
+    }
+
+    net::ResponsePtr Coordinator::RequestTokenDeletion(const net::RequestPtr& requestPtr)
+    {
+        utils::Timer timer{};
+        auto tokenRequestPtr = utils::downcast<net::BasicToken::BasicToken>(requestPtr);
+        auto responsePtr = std::make_shared<net::EraseResponse::EraseResponse>();
+
+        const std::string& token = tokenRequestPtr->getToken();
+        std::vector<char> erased(m_backends.size(), false);
+        broadcast([&token, &erased](size_t idx, ClientStub& backend) {
+            auto res = backend.RequestTokenDeletion(token);
+            erased[idx] = res->getStatus() == net::ProtocolStatus::OK && res->getOk();
+        });
+
+        responsePtr->getOk() = std::all_of(erased.begin(), erased.end(), [](char ok) {
+            return ok;
+        });
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
+
+        return responsePtr;
+    }
+
+    net::ResponsePtr Coordinator::RequestDocumentDeletion(const net::RequestPtr& requestPtr)
+    {
+        utils::Timer timer{};
+        auto pathRequestPtr = utils::downcast<net::Path::Path>(requestPtr);
+
+        const std::string& path = pathRequestPtr->getPath();
+        auto responsePtr = stub(backendIdx(path)).RequestDocumentDeletion(path);
+        if (responsePtr->getStatus() != net::ProtocolStatus::OK)
+        {
+            responsePtr = std::make_shared<net::EraseResponse::EraseResponse>();
+            responsePtr->getOk() = false;
+        }
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
+
+        return responsePtr;
+    }
+
+    net::ResponsePtr Coordinator::RequestDocumentReindex(const net::RequestPtr& requestPtr)
+    {
+        utils::Timer timer{};
+        auto pathRequestPtr = utils::downcast<net::Path::Path>(requestPtr);
+
+        const std::string& path = pathRequestPtr->getPath();
+        const size_t idx = backendIdx(path);
+        auto responsePtr = stub(idx).RequestDocumentReindex(path);
+        if (responsePtr->getStatus() != net::ProtocolStatus::OK)
+        {
+            responsePtr = std::make_shared<net::InsertResponse::InsertResponse>();
+            responsePtr->getOk() = false;
+            responsePtr->getIndexsize() = 0;
+            responsePtr->getEnginestatus() = "Backend " + describe(idx) + " is unavailable";
+            responsePtr->getJobid() = 0;
+        }
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
+
+        return responsePtr;
+    }
+
+    net::ResponsePtr Coordinator::RequestQueryStats(const net::RequestPtr& requestPtr)
+    {
+        /**
+        * sums the statistics of all reachable backends, which lets coordinators be stacked
+        */
+        utils::Timer timer{};
+        auto queryRequestPtr = utils::downcast<net::SearchQueryRequest::SearchQueryRequest>(requestPtr);
+        auto responsePtr = std::make_shared<net::QueryStatsResponse::QueryStatsResponse>();
+
+        const std::string& query = queryRequestPtr->getQuery();
+        std::vector<net::QueryStatsResponse::ResponsePtr> results(m_backends.size());
+        broadcast([&query, &results](size_t idx, ClientStub& backend) {
+            results[idx] = backend.RequestQueryStats(query);
+        });
+
+        std::vector<std::string>& tokens = responsePtr->getTokens();
+        std::vector<uint64_t>& docFreqs = responsePtr->getDocfreqs();
+        responsePtr->getDoccount() = 0;
+        responsePtr->getTotaltokens() = 0;
+        for (const auto& res: results)
+        {
+            if (res->getStatus() != net::ProtocolStatus::OK)
+            {
+                continue;
+            }
+            responsePtr->getDoccount() += res->getDoccount();
+            responsePtr->getTotaltokens() += res->getTotaltokens();
+            const auto& resTokens = res->getTokens();
+            for (size_t i = 0; i < resTokens.size() && i < res->getDocfreqs().size(); i++)
+            {
+                if (std::find(resTokens.begin(), resTokens.begin() + i, resTokens[i]) != resTokens.begin() + i)
+                {
+                    // repeated query tokens carry the same statistics
+                    continue;
+                }
+                auto it = std::find(tokens.begin(), tokens.end(), resTokens[i]);
+                if (it == tokens.end())
+                {
+                    tokens.push_back(resTokens[i]);
+                    docFreqs.push_back(res->getDocfreqs()[i]);
+                }
+                else
+                {
+                    docFreqs[it - tokens.begin()] += res->getDocfreqs()[i];
+                }
+            }
+        }
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
+
+        return responsePtr;
+    }
+
+    net::ResponsePtr Coordinator::RequestGlobalQuerySearch(const net::RequestPtr& requestPtr)
+    {
+        /**
+        * The merged ranking orders documents by rank, then by backend, then by the ranking of the backend.
+        * A page takes the best limit documents out of a page of every backend, its cursor holds for every
+        * backend the cursor of the last document taken from it, cursors[i] does so right after rankedDocs[i]
+        */
+        utils::Timer timer{};
+        auto globalRequestPtr = utils::downcast<net::GlobalQueryRequest::GlobalQueryRequest>(requestPtr);
+        auto responsePtr = std::make_shared<net::SearchQueryResponse::SearchQueryResponse>();
+
+        std::vector<std::string> backendCursors(m_backends.size());
+        if (!globalRequestPtr->getCursor().empty())
+        {
+            const Json cursor = Json::parse(globalRequestPtr->getCursor(), nullptr, false);
+            if (cursor.is_discarded() || !cursor.is_array() || cursor.size() != m_backends.size() ||
+                !std::all_of(cursor.begin(), cursor.end(), [](const Json& item) {
+                    return item.is_string();
+                }))
+            {
+                responsePtr->setMetadata(net::ProtocolStatus::ProtocolError, "Invalid cursor");
+                return responsePtr;
+            }
+            backendCursors = cursor.get<std::vector<std::string>>();
+        }
+
+        const size_t limit = core::paging::limit(globalRequestPtr->getLimit(), TopK, m_maxSearchLimit);
+        std::vector<net::SearchQueryResponse::ResponsePtr> results(m_backends.size());
+        broadcast([&globalRequestPtr, &backendCursors, &results, limit](size_t idx, ClientStub& backend) {
+            auto backendRequestPtr = std::make_shared<net::GlobalQueryRequest::GlobalQueryRequest>(*globalRequestPtr);
+            backendRequestPtr->getLimit() = limit;
+            backendRequestPtr->getCursor() = backendCursors[idx];
+            results[idx] = backend.RequestGlobalQuerySearch(backendRequestPtr);
+        });
+
+        struct Ranked
+        {
+            std::string entry;
+            float rank;
+            size_t backendIdx;
+            std::string cursor;
+        };
+        std::vector<Ranked> ranked;
+        bool hasMore = false;
+        responsePtr->getPartial() = false;
+        for (size_t idx = 0; idx < results.size(); idx++)
+        {
+            const auto& res = results[idx];
+            if (res->getStatus() != net::ProtocolStatus::OK || res->getCursors().size() != res->getRankeddocs().size())
+            {
+                responsePtr->getPartial() = true;
+                continue;
+            }
+            responsePtr->getPartial() |= res->getPartial();
+            hasMore |= !res->getNextcursor().empty();
+            for (size_t i = 0; i < res->getRankeddocs().size(); i++)
+            {
+                std::string& entry = res->getRankeddocs()[i];
+                const float rank = Json::parse(entry).at("rank").get<float>();
+                ranked.push_back({std::move(entry), rank, idx, std::move(res->getCursors()[i])});
+            }
+        }
+
+        std::stable_sort(ranked.begin(), ranked.end(), [](const Ranked& first, const Ranked& second) {
+            return first.rank > second.rank || (first.rank == second.rank && first.backendIdx < second.backendIdx);
+        });
+        const size_t topX = std::min(ranked.size(), limit);
+        hasMore |= ranked.size() > topX;
+
+        std::vector<std::string>& merged = responsePtr->getRankeddocs();
+        std::vector<std::string>& cursors = responsePtr->getCursors();
+        for (size_t i = 0; i < topX; i++)
+        {
+            merged.push_back(std::move(ranked[i].entry));
+            backendCursors[ranked[i].backendIdx] = std::move(ranked[i].cursor);
+            cursors.push_back(Json(backendCursors).dump());
+        }
+        responsePtr->getNextcursor() = hasMore && !cursors.empty() ? cursors.back() : "";
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
+
+        return responsePtr;
+    }
+
+    net::ResponsePtr Coordinator::RequestQuerySearch(const net::RequestPtr& requestPtr)
+    {
+        utils::Timer timer{};
+        auto queryRequestPtr = utils::downcast<net::SearchQueryRequest::SearchQueryRequest>(requestPtr);
+
+        auto globalRequestPtr = std::make_shared<net::GlobalQueryRequest::GlobalQueryRequest>();
+        globalRequestPtr->getQuery() = queryRequestPtr->getQuery();
+        globalRequestPtr->getLimit() = queryRequestPtr->getLimit();
+        globalRequestPtr->getCursor() = queryRequestPtr->getCursor();
+        globalRequestPtr->getRanked() = queryRequestPtr->getRanked();
+        globalRequestPtr->getDoccount() = 0;
+        globalRequestPtr->getTotaltokens() = 0;
+        if (queryRequestPtr->getRanked())
+        {
+            /**
+            * unranked matches score 0 everywhere and are merged by backend, the statistics round is skipped
+            */
+            auto statsPtr = utils::downcast<net::QueryStatsResponse::QueryStatsResponse>(RequestQueryStats(requestPtr));
+            globalRequestPtr->getTokens() = std::move(statsPtr->getTokens());
+            globalRequestPtr->getDocfreqs() = std::move(statsPtr->getDocfreqs());
+            globalRequestPtr->getDoccount() = statsPtr->getDoccount();
+            globalRequestPtr->getTotaltokens() = statsPtr->getTotaltokens();
+        }
+
+        auto responsePtr = utils::downcast<net::SearchQueryResponse::SearchQueryResponse>(
+            RequestGlobalQuerySearch(globalRequestPtr));
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
+
+        return responsePtr;
+    }
+
+    net::ResponsePtr Coordinator::RequestTermExpansion(const net::RequestPtr& requestPtr)
+    {
+        /**
+        * every backend returns its first limit matches, merged they cover the first limit matches overall.
+        * Document frequencies of a token are summed over the backends, which may reorder fuzzy matches
+        */
+        utils::Timer timer{};
+        auto expansionRequestPtr = utils::downcast<net::TermExpansionRequest::TermExpansionRequest>(requestPtr);
+        auto responsePtr = std::make_shared<net::TermExpansionResponse::TermExpansionResponse>();
+
+        const std::string& pattern = expansionRequestPtr->getPattern();
+        const uint64_t maxEdits = expansionRequestPtr->getMaxedits();
+        const size_t limit = core::paging::limit(expansionRequestPtr->getLimit(), TermExpansionLimit,
+                                                 m_maxSearchLimit);
+        std::vector<net::TermExpansionResponse::ResponsePtr> results(m_backends.size());
+        broadcast([&pattern, &results, maxEdits, limit](size_t idx, ClientStub& backend) {
+            results[idx] = backend.RequestTermExpansion(pattern, limit, maxEdits);
+        });
+
+        std::map<std::string, core::TermMatch> merged;
+        responsePtr->getTruncated() = false;
+        responsePtr->getPartial() = false;
+        for (const auto& res: results)
+        {
+            if (res->getStatus() != net::ProtocolStatus::OK || res->getDocfreqs().size() != res->getTerms().size() ||
+                res->getDistances().size() != res->getTerms().size())
+            {
+                responsePtr->getPartial() = true;
+                continue;
+            }
+            responsePtr->getPartial() |= res->getPartial();
+            responsePtr->getTruncated() |= res->getTruncated();
+            for (size_t i = 0; i < res->getTerms().size(); i++)
+            {
+                core::TermMatch& match = merged[res->getTerms()[i]];
+                match.distance = res->getDistances()[i];
+                match.docFreq += res->getDocfreqs()[i];
+            }
+        }
+
+        std::vector<std::pair<std::string, core::TermMatch>> matches(merged.begin(), merged.end());
+        if (maxEdits > 0)
+        {
+            std::stable_sort(matches.begin(), matches.end(), [](const auto& first, const auto& second) {
+                return first.second.distance < second.second.distance ||
+                       (first.second.distance == second.second.distance &&
+                        first.second.docFreq > second.second.docFreq);
+            });
+        }
+        responsePtr->getTruncated() |= matches.size() > limit;
+        matches.resize(std::min(matches.size(), limit));
+        for (const auto& [term, match]: matches)
+        {
+            responsePtr->getTerms().push_back(term);
+            responsePtr->getDocfreqs().push_back(match.docFreq);
+            responsePtr->getDistances().push_back(match.distance);
+        }
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
+
+        return responsePtr;
+    }
+
+    net::ResponsePtr Coordinator::RequestMutations(const net::RequestPtr&)
+    {
+        /**
+        * the coordinator holds no index of its own, backends are replicated individually
+        */
+        auto responsePtr = std::make_shared<net::MutationsResponse::MutationsResponse>();
+        responsePtr->setMetadata(net::ProtocolStatus::ProtocolError, "Coordinator can not be replicated");
+        return responsePtr;
+    }
+
+    net::ResponsePtr Coordinator::RequestSnapshot(const net::RequestPtr&)
+    {
+        auto responsePtr = std::make_shared<net::SnapshotResponse::SnapshotResponse>();
+        responsePtr->setMetadata(net::ProtocolStatus::ProtocolError, "Coordinator can not be replicated");
+        return responsePtr;
+    }
+
+    net::ResponsePtr Coordinator::RequestReplicationStatus(const net::RequestPtr&)
+    {
+        utils::Timer timer{};
+        auto responsePtr = std::make_shared<net::ReplicationStatusResponse::ReplicationStatusResponse>();
+        responsePtr->getRole() = "coordinator";
+        responsePtr->getAppliedseq() = 0;
+        responsePtr->getPrimaryseq() = 0;
+        responsePtr->getLagms() = 0;
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
+
+        return responsePtr;
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "../network/gen/gen_messages.h"
+#include "../network/gen/gen_server_stub.h"
+#include "../client/client.h"
+#include "../thread_pool/pool/thread_pool.h"
+#include "../engine/index_job.h"
+
+namespace anechka
+{
+    class Coordinator: public AbstractServer
+    {
+        /**
+        * Coordinator fronts a set of Anechka backends, each holding a partition of the corpus. Documents
+        * are routed to backends by the hash of their path, searches are broadcast and the results merged.
+        * Query ranking takes two rounds: document frequencies are gathered from every backend first, then
+        * the backends rank their own documents with the corpus-wide statistics, so ranks match those of
+        * a single engine holding the whole corpus. Backends not answering within the timeout are skipped
+        * and the response is marked as partial.
+        */
+    public:
+        explicit Coordinator(const std::string& configPath);
+        Coordinator(const Coordinator& other) = delete;
+        Coordinator& operator=(const Coordinator& other) = delete;
+        net::ResponsePtr RequestTxtFileIndexing(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestRecursiveDirIndexing(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestJobStatus(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestJobCancel(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestTokenSearch(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestTokenSearchWithContext(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestTokenDeletion(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestDocumentDeletion(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestDocumentReindex(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestQuerySearch(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestQueryStats(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestGlobalQuerySearch(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestTermExpansion(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestMutations(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestSnapshot(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestReplicationStatus(const net::RequestPtr& requestPtr) override;
+
+    private:
+        void config(const std::string& configPath);
+        size_t backendIdx(const std::string& path) const;
+        ClientStub stub(size_t backendIdx) const;
+        std::string describe(size_t backendIdx) const;
+
+        template<typename Callback>
+        void broadcast(Callback&& callback)
+        {
+            /**
+            * calls callback(backendIdx, stub) for every backend in parallel and waits for all of them
+            */
+            std::vector<core::WaitableFuture> futures;
+            for (size_t i = 0; i < m_backends.size(); i++)
+            {
+                futures.push_back(m_pool->submitTask(
+                    [this, &callback, i] {
+                        ClientStub backend = stub(i);
+                        callback(i, backend);
+                    },
+                    true));
+            }
+        }
+
+    private:
+        std::vector<Backend> m_backends;
+        size_t m_timeoutMs{2000};
+        size_t m_maxSearchLimit{1000};
+        core::ThreadPoolPtr m_pool;
+        /**
+        * declared last, jobs are stopped before the backends they route files to go away
+        */
+        core::IndexJobsPtr m_jobs;
+    };
+}
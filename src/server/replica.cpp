@@ -0,0 +1,141 @@
+#include "replica.h"
+#include <chrono>
+
+namespace anechka
+{
+    Replica::Replica(core::SearchEngine& engine, const Backend& primary, const ReplicaParams& params)
+        : m_engine(engine)
+        , m_primary(primary.host, primary.port)
+        , m_params(params)
+        , m_syncedAt(now())
+    {
+        m_primary.setTimeout(m_params.timeoutMs);
+        m_thread = std::thread(&Replica::run, this);
+    }
+
+    Replica::~Replica()
+    {
+        {
+            std::unique_lock lock(m_mtx);
+            m_isDone = true;
+        }
+        m_cv.notify_all();
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
+
+    bool Replica::isServing() const
+    {
+        return m_isServing;
+    }
+
+    ReplicaStatus Replica::status() const
+    {
+        const uint64_t appliedSeq = m_appliedSeq;
+        const uint64_t primarySeq = std::max<uint64_t>(m_primarySeq, appliedSeq);
+        return {appliedSeq, primarySeq, static_cast<uint64_t>(std::max<int64_t>(now() - m_syncedAt, 0))};
+    }
+
+    int64_t Replica::now()
+    {
+        const auto elapsed = std::chrono::steady_clock::now().time_since_epoch();
+        return std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+    }
+
+    void Replica::run()
+    {
+        while (true)
+        {
+            bool isBehind = false;
+            if (m_needsSnapshot)
+            {
+                bootstrap();
+            }
+            else
+            {
+                catchUp(isBehind);
+            }
+
+            std::unique_lock lock(m_mtx);
+            if (!isBehind || m_needsSnapshot)
+            {
+                m_cv.wait_for(lock, std::chrono::milliseconds(m_params.pollMs), [this] {
+                    return m_isDone;
+                });
+            }
+            if (m_isDone)
+            {
+                return;
+            }
+        }
+    }
+
+    bool Replica::bootstrap()
+    {
+        auto responsePtr = m_primary.RequestSnapshot();
+        if (responsePtr->getStatus() != net::ProtocolStatus::OK)
+        {
+            return false;
+        }
+
+        const Json snapshot = Json::parse(responsePtr->getSnapshot(), nullptr, false);
+        try
+        {
+            if (snapshot.is_discarded() || !m_engine.sync(snapshot))
+            {
+                return false;
+            }
+        }
+        catch (const std::exception& err)
+        {
+            return false;
+        }
+
+        m_epoch = responsePtr->getEpoch();
+        m_appliedSeq = responsePtr->getSeq();
+        m_primarySeq = responsePtr->getSeq();
+        m_needsSnapshot = false;
+        m_isServing = true;
+        m_syncedAt = now();
+        return true;
+    }
+
+    bool Replica::catchUp(bool& isBehind)
+    {
+        auto responsePtr = m_primary.RequestMutations(m_appliedSeq, m_params.batch);
+        if (responsePtr->getStatus() != net::ProtocolStatus::OK)
+        {
+            isBehind = false;
+            return false;
+        }
+        if (responsePtr->getEpoch() != m_epoch || responsePtr->getTruncated())
+        {
+            m_needsSnapshot = true;
+            isBehind = true;
+            return false;
+        }
+
+        for (const auto& mutation: responsePtr->getMutations())
+        {
+            /**
+            * a mutation that does not apply would leave the replica apart from the primary for good
+            */
+            if (!m_engine.applyMutation(mutation))
+            {
+                m_needsSnapshot = true;
+                isBehind = true;
+                return false;
+            }
+            m_appliedSeq++;
+        }
+        m_primarySeq = responsePtr->getLastseq();
+        isBehind = m_appliedSeq < m_primarySeq;
+        if (!isBehind)
+        {
+            m_syncedAt = now();
+        }
+        return true;
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "../client/client.h"
+#include "../engine/engine.h"
+#include <condition_variable>
+
+namespace anechka
+{
+    struct ReplicaParams
+    {
+        /**
+        * pollMs - how often the primary is asked for new mutations once the replica has caught up
+        * batch - the maximum number of mutations pulled at once
+        * timeoutMs - send/receive timeout of requests to the primary
+        */
+        size_t pollMs{200};
+        size_t batch{256};
+        size_t timeoutMs{2000};
+    };
+
+    struct ReplicaStatus
+    {
+        uint64_t appliedSeq;
+        uint64_t primarySeq;
+        uint64_t lagMs;
+    };
+
+    class Replica
+    {
+        /**
+        * Replica keeps the engine a read-only copy of the index of a primary. It starts from a snapshot of
+        * the primary and then pulls the mutations the primary has logged since, right away while it is
+        * behind and every pollMs once it has caught up. The replica starts over from a new snapshot when
+        * the primary restarts or has already dropped mutations the replica has not seen.
+        *
+        * The lag is the time passed since the replica was last known to be in sync with the primary.
+        */
+    public:
+        Replica(core::SearchEngine& engine, const Backend& primary, const ReplicaParams& params);
+        ~Replica();
+        Replica(const Replica& other) = delete;
+        Replica& operator=(const Replica& other) = delete;
+        bool isServing() const;
+        ReplicaStatus status() const;
+
+    private:
+        void run();
+        bool bootstrap();
+        bool catchUp(bool& isBehind);
+        static int64_t now();
+
+    private:
+        core::SearchEngine& m_engine;
+        ClientStub m_primary;
+        const ReplicaParams m_params;
+        uint64_t m_epoch{0};
+        bool m_needsSnapshot{true};
+        std::atomic<bool> m_isServing{false};
+        std::atomic<uint64_t> m_appliedSeq{0};
+        std::atomic<uint64_t> m_primarySeq{0};
+        std::atomic<int64_t> m_syncedAt;
+        std::mutex m_mtx;
+        std::condition_variable m_cv;
+        bool m_isDone{false};
+        std::thread m_thread;
+    };
+
+    using ReplicaPtr = std::unique_ptr<Replica>;
+}
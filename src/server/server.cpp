@@ -1,12 +1,20 @@
 #include "server.h"
 #include "../mmap/mmap.h"
+#include "../engine/paging.h"
 #include "timer.h"
 #include <fstream>
+#include <limits>
 #include <sstream>
 
 namespace anechka
 {
     static const auto delims = {'.', ',', '!', '?'};
+    /**
+    * default page sizes, a request may ask for up to "max_search_limit" results
+    */
+    static constexpr size_t TokenSearchLimit = 50;
+    static constexpr size_t QuerySearchLimit = 20;
+    static constexpr size_t TermExpansionLimit = 10;
 
     static std::string escape(const std::string& src)
     {
@@ -41,9 +49,13 @@ namespace anechka
             return {};
         }
 
-        int64_t leftCursor = idx - 10;
-        int64_t rightCursor = idx + 10;
-        while (leftCursor > 0 && rightCursor < mmap->size())
+        /**
+        * a mapping is far smaller than the int64_t range and idx lies within it
+        */
+        const int64_t size = static_cast<int64_t>(mmap->size());
+        int64_t leftCursor = static_cast<int64_t>(idx) - 10;
+        int64_t rightCursor = static_cast<int64_t>(idx) + 10;
+        while (leftCursor > 0 && rightCursor < size)
         {
             bool l = std::find(delims.begin(), delims.end(), (*mmap)[leftCursor]) == delims.end();
             bool r = std::find(delims.begin(), delims.end(), (*mmap)[rightCursor]) == delims.end();
@@ -61,7 +73,7 @@ namespace anechka
                 break;
             }
         }
-        if (rightCursor - leftCursor == 0 || leftCursor < 0 || rightCursor >= mmap->size())
+        if (rightCursor - leftCursor == 0 || leftCursor < 0 || rightCursor >= size)
         {
             leftCursor = 0;
             rightCursor = 0;
@@ -75,6 +87,35 @@ namespace anechka
         return "..." + utils::lrtrim(body) + "...";
     }
 
+    static std::string pageKey(const std::string& key, size_t limit, const std::string& cursor)
+    {
+        /**
+        * pages of the same search are cached separately
+        */
+        return key + '\n' + std::to_string(limit) + '\n' + cursor;
+    }
+
+    static void describeJob(bool found, const core::IndexJobStatus& status,
+                            const std::shared_ptr<net::JobStatusResponse::JobStatusResponse>& responsePtr)
+    {
+        /**
+        * an unknown job is reported with zero counters and no state
+        */
+        responsePtr->getOk() = found;
+        responsePtr->getJobid() = status.id;
+        responsePtr->getState() = found ? core::toString(status.state) : "";
+        responsePtr->getFilesdiscovered() = status.filesDiscovered;
+        responsePtr->getFilesindexed() = status.filesIndexed;
+        responsePtr->getFilesfailed() = status.filesFailed;
+        responsePtr->getBytesprocessed() = status.bytesProcessed;
+        responsePtr->getElapsedms() = status.elapsedMs;
+        responsePtr->getBytespersec() = status.throughput();
+        for (const auto& stage: status.stages)
+        {
+            responsePtr->getStages().push_back(Json(stage).dump());
+        }
+    }
+
     Anechka::Anechka(const std::string& configPath)
     {
         config(configPath);
@@ -109,10 +150,45 @@ namespace anechka
         size_t docs = utils::getJsonProperty<size_t>(config, "est_docs", 10e3);
         size_t threads = utils::getJsonProperty<size_t>(config, "se_threads", hardwareThreads);
         float cacheSize = utils::getJsonProperty<float>(config, "cache_size", 0.25);
-
-        const core::SearchEngineParams engineParams{size, docs, threads, maxLF, toLowercase, cacheSize};
+        size_t watchCoalesceMs = utils::getJsonProperty<size_t>(config, "watch_coalesce_ms", 500);
+        auto watchDirs = utils::getJsonProperty<std::vector<std::string>>(config, "watch_dirs", {});
+        float compactionRatio = utils::getJsonProperty<float>(config, "compaction_ratio", 0.1);
+        size_t bufferPostings = utils::getJsonProperty<size_t>(config, "segment_buffer_postings", 1 << 21);
+        size_t mergeFactor = utils::getJsonProperty<size_t>(config, "merge_factor", 10);
+        size_t shards = utils::getJsonProperty<size_t>(config, "shards", 1);
+        size_t replicationLogBytes = utils::getJsonProperty<size_t>(config, "replication_log_bytes", 0);
+        float bm25K1 = utils::getJsonProperty<float>(config, "bm25_k1", 1.2);
+        float bm25B = utils::getJsonProperty<float>(config, "bm25_b", 0.75);
+        size_t pollMs = utils::getJsonProperty<size_t>(config, "replication_poll_ms", 200);
+        size_t batch = utils::getJsonProperty<size_t>(config, "replication_batch", 256);
+        size_t timeoutMs = utils::getJsonProperty<size_t>(config, "backend_timeout_ms", 2000);
+        m_maxSearchLimit = utils::getJsonProperty<size_t>(config, "max_search_limit", 1000);
+        size_t maxExpansions = utils::getJsonProperty<size_t>(config, "max_expansions", 64);
+        size_t maxInFlightFiles = utils::getJsonProperty<size_t>(config, "max_inflight_files", 64);
+        size_t indexReaders = utils::getJsonProperty<size_t>(config, "index_readers", 4);
+        bool uringReader = utils::getJsonProperty<bool>(config, "io_uring_reader", true);
+        size_t streamThreshold = utils::getJsonProperty<size_t>(config, "stream_threshold_bytes", 1 << 26);
+        bool nfcTokens = utils::getJsonProperty<bool>(config, "nfc_normalization", false);
+        const Json primary = config.contains("replica_of") ? config.at("replica_of") : Json::object();
+
+        const core::SearchEngineParams engineParams{size, docs, threads, maxLF, toLowercase, cacheSize,
+                                                    watchCoalesceMs, compactionRatio, bufferPostings,
+                                                    mergeFactor, shards, replicationLogBytes, bm25K1, bm25B,
+                                                    maxExpansions, maxInFlightFiles, indexReaders, uringReader,
+                                                    streamThreshold, nfcTokens};
         m_searchEngine = std::make_unique<core::SearchEngine>(engineParams);
 
+        if (primary.contains("port"))
+        {
+            /**
+            * a replica takes its index from the primary, local dumps and watched directories are ignored
+            */
+            const Backend primaryBackend{primary.value("host", "127.0.0.1"), primary.at("port").get<int>()};
+            m_replica = std::make_unique<Replica>(*m_searchEngine, primaryBackend,
+                                                  ReplicaParams{pollMs, batch, timeoutMs});
+            return;
+        }
+
         if (restoring)
         {
             bool stale;
@@ -127,6 +203,48 @@ namespace anechka
                              "since the last back-up\n";
             }
         }
+
+        for (const std::string& dir: watchDirs)
+        {
+            /**
+            * watched trees are crawled once on start, afterwards they are kept current by the watcher
+            */
+            if (!m_searchEngine->indexDir(dir) || !m_searchEngine->watchDir(dir))
+            {
+                std::cerr << "Failed to watch " << dir << '\n';
+            }
+        }
+    }
+
+    std::string Anechka::engineStatus() const
+    {
+        if (m_replica)
+        {
+            return "Read-only replica, writes are accepted by the primary only";
+        }
+        if (m_searchEngine->isExpandable())
+        {
+            return "nominal";
+        }
+        std::stringstream warning;
+        warning << "The cluster is overloaded, the current load factor: " << m_searchEngine->loadFactor()
+                << ". This means more collisions during further insertions and slower response times. "
+                   "Please adjust est_distinct_tokens and/or max_load_factor accordingly";
+        return warning.str();
+    }
+
+    bool Anechka::isReadable(const net::ResponsePtr& responsePtr) const
+    {
+        /**
+        * a replica answers reads once it holds a snapshot of the primary, until then clients are
+        * told to go elsewhere rather than served an empty index
+        */
+        if (!m_replica || m_replica->isServing())
+        {
+            return true;
+        }
+        responsePtr->setMetadata(net::ProtocolStatus::ProtocolError, "Replica has not synced with the primary yet");
+        return false;
     }
 
     net::ResponsePtr Anechka::RequestTxtFileIndexing(const net::RequestPtr& requestPtr)
@@ -138,22 +256,12 @@ namespace anechka
         std::string path = pathRequestPtr->getPath();
         utils::removeControlChars(path);
 
-        bool ok = m_searchEngine->indexTxtFile(std::move(path));
-        if (!m_searchEngine->isExpandable())
-        {
-            std::stringstream warning;
-            warning << "The cluster is overloaded, the current load factor: " << m_searchEngine->loadFactor()
-                    << ". This means more collisions during further insertions and slower response times. "
-                       "Please adjust est_distinct_tokens and/or max_load_factor accordingly";
-            responsePtr->getEnginestatus() = warning.str();
-        }
-        else
-        {
-            responsePtr->getEnginestatus() = "nominal";
-        }
+        bool ok = !m_replica && m_searchEngine->indexTxtFile(std::move(path));
+        responsePtr->getEnginestatus() = engineStatus();
 
         responsePtr->getOk() = ok;
         responsePtr->getIndexsize() = m_searchEngine->tokenCount();
+        responsePtr->getJobid() = 0;
         responsePtr->getTook() = std::to_string(timer.getInterval());
 
         return responsePtr;
@@ -161,27 +269,51 @@ namespace anechka
 
     net::ResponsePtr Anechka::RequestRecursiveDirIndexing(const net::RequestPtr& requestPtr)
     {
+        /**
+        * the directory is indexed in the background, the response only tells the job to follow
+        */
         utils::Timer timer{};
         auto pathRequestPtr = utils::downcast<net::Path::Path>(requestPtr);
         auto responsePtr = std::make_shared<net::InsertResponse::InsertResponse>();
 
         const std::string& path = pathRequestPtr->getPath();
-        bool ok = m_searchEngine->indexDir(path);
-        if (!m_searchEngine->isExpandable())
-        {
-            std::stringstream warning;
-            warning << "The cluster is overloaded, the current load factor: " << m_searchEngine->loadFactor()
-                    << ". This means more collisions during further insertions and slower response times. "
-                       "Please adjust est_distinct_tokens and/or max_load_factor accordingly";
-            responsePtr->getEnginestatus() = warning.str();
-        }
-        else
-        {
-            responsePtr->getEnginestatus() = "nominal";
-        }
+        uint64_t jobId = 0;
+        bool ok = !m_replica && m_searchEngine->startIndexing(path, jobId);
+        responsePtr->getEnginestatus() = engineStatus();
 
         responsePtr->getOk() = ok;
         responsePtr->getIndexsize() = m_searchEngine->tokenCount();
+        responsePtr->getJobid() = jobId;
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
+
+        return responsePtr;
+    }
+
+    net::ResponsePtr Anechka::RequestJobStatus(const net::RequestPtr& requestPtr)
+    {
+        utils::Timer timer{};
+        auto jobRequestPtr = utils::downcast<net::JobRequest::JobRequest>(requestPtr);
+        auto responsePtr = std::make_shared<net::JobStatusResponse::JobStatusResponse>();
+
+        core::IndexJobStatus status{};
+        status.id = jobRequestPtr->getJobid();
+        const bool found = m_searchEngine->jobStatus(jobRequestPtr->getJobid(), status);
+        describeJob(found, status, responsePtr);
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
+
+        return responsePtr;
+    }
+
+    net::ResponsePtr Anechka::RequestJobCancel(const net::RequestPtr& requestPtr)
+    {
+        utils::Timer timer{};
+        auto jobRequestPtr = utils::downcast<net::JobRequest::JobRequest>(requestPtr);
+        auto responsePtr = std::make_shared<net::JobStatusResponse::JobStatusResponse>();
+
+        core::IndexJobStatus status{};
+        status.id = jobRequestPtr->getJobid();
+        const bool found = m_searchEngine->cancelJob(jobRequestPtr->getJobid(), status);
+        describeJob(found, status, responsePtr);
         responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
 
         return responsePtr;
@@ -189,33 +321,49 @@ namespace anechka
 
     net::ResponsePtr Anechka::RequestTokenSearch(const net::RequestPtr& requestPtr)
     {
+        /**
+        * postings are listed in (DocId, position) order, the cursor is the last posting of the page
+        */
         utils::Timer timer{};
-        auto tokenRequestPtr = utils::downcast<net::BasicToken::BasicToken>(requestPtr);
+        auto tokenRequestPtr = utils::downcast<net::TokenSearchRequest::TokenSearchRequest>(requestPtr);
         auto responsePtr = std::make_shared<net::SearchResponse::SearchResponse>();
+        responsePtr->getPartial() = false;
+        if (!isReadable(responsePtr))
+        {
+            return responsePtr;
+        }
 
-        const std::string& token = tokenRequestPtr->getToken();
+        std::optional<core::Posting> after;
+        if (!tokenRequestPtr->getCursor().empty())
+        {
+            uint64_t docId;
+            uint64_t pos;
+            if (!core::paging::decode(tokenRequestPtr->getCursor(), docId, pos))
+            {
+                responsePtr->setMetadata(net::ProtocolStatus::ProtocolError, "Invalid cursor");
+                return responsePtr;
+            }
+            after = core::Posting(docId, pos);
+        }
+        const size_t limit = core::paging::limit(tokenRequestPtr->getLimit(), TokenSearchLimit, m_maxSearchLimit);
 
         bool found = false;
-        auto tokenPtr = m_searchEngine->search(token, found);
+        auto tokenPtr = m_searchEngine->search(tokenRequestPtr->getToken(), found);
+        std::vector<std::string>& final = responsePtr->getResponse();
         if (found)
         {
-            std::vector<std::string> final;
-            size_t threshold = 50;
-            for (auto&&[path, pos]: tokenPtr->iterate())
+            // one posting beyond the page tells whether there is a next one
+            std::vector<core::Posting> page = tokenPtr->page(after, limit + 1, false);
+            if (page.size() > limit)
+            {
+                page.resize(limit);
+                responsePtr->getNextcursor() = core::paging::encode(page.back().first, page.back().second);
+            }
+            for (const auto& [docId, pos]: page)
             {
-                if (threshold == 0)
-                {
-                    break;
-                }
-                Json docEntry{{"path", path}, {"pos", pos}};
+                Json docEntry{{"path", m_searchEngine->docPath(docId)}, {"pos", core::position::offset(pos)}};
                 final.push_back(docEntry.dump(2));
-                threshold--;
             }
-            responsePtr->getResponse() = final;
-        }
-        else
-        {
-            responsePtr->getResponse() = {};
         }
         responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
 
@@ -231,27 +379,88 @@ namespace anechka
         bool found = true;
         const std::string& token = tokenRequestPtr->getToken();
 
-        m_searchEngine->erase(token);
-        m_searchEngine->search(token, found);
+        if (!m_replica)
+        {
+            m_searchEngine->erase(token);
+            m_searchEngine->search(token, found);
+        }
         responsePtr->getOk() = !found;
         responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
 
         return responsePtr;
     }
 
+    net::ResponsePtr Anechka::RequestDocumentDeletion(const net::RequestPtr& requestPtr)
+    {
+        utils::Timer timer{};
+        auto pathRequestPtr = utils::downcast<net::Path::Path>(requestPtr);
+        auto responsePtr = std::make_shared<net::EraseResponse::EraseResponse>();
+
+        std::string path = pathRequestPtr->getPath();
+        utils::removeControlChars(path);
+
+        responsePtr->getOk() = !m_replica && m_searchEngine->deleteDocument(path);
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
+
+        return responsePtr;
+    }
+
+    net::ResponsePtr Anechka::RequestDocumentReindex(const net::RequestPtr& requestPtr)
+    {
+        utils::Timer timer{};
+        auto pathRequestPtr = utils::downcast<net::Path::Path>(requestPtr);
+        auto responsePtr = std::make_shared<net::InsertResponse::InsertResponse>();
+
+        std::string path = pathRequestPtr->getPath();
+        utils::removeControlChars(path);
+
+        responsePtr->getOk() = !m_replica && m_searchEngine->reindexDocument(std::move(path));
+        responsePtr->getEnginestatus() = engineStatus();
+        responsePtr->getIndexsize() = m_searchEngine->tokenCount();
+        responsePtr->getJobid() = 0;
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
+
+        return responsePtr;
+    }
+
     net::ResponsePtr Anechka::RequestTokenSearchWithContext(const net::RequestPtr& requestPtr)
     {
+        /**
+        * documents are listed in DocId order, only the documents of the requested page are read
+        */
         utils::Timer timer{};
-        auto tokenRequestPtr = utils::downcast<net::BasicToken::BasicToken>(requestPtr);
+        auto tokenRequestPtr = utils::downcast<net::TokenSearchRequest::TokenSearchRequest>(requestPtr);
         auto responsePtr = std::make_shared<net::ContextSearchResponse::ContextSearchResponse>();
+        responsePtr->getPartial() = false;
+        if (!isReadable(responsePtr))
+        {
+            return responsePtr;
+        }
 
         const std::string& token = tokenRequestPtr->getToken();
+        const std::string& cursor = tokenRequestPtr->getCursor();
+        const size_t limit = core::paging::limit(tokenRequestPtr->getLimit(), TokenSearchLimit, m_maxSearchLimit);
+        std::optional<core::Posting> after;
+        if (!cursor.empty())
+        {
+            uint64_t docId;
+            uint64_t unused;
+            if (!core::paging::decode(cursor, docId, unused))
+            {
+                responsePtr->setMetadata(net::ProtocolStatus::ProtocolError, "Invalid cursor");
+                return responsePtr;
+            }
+            after = core::Posting(docId, std::numeric_limits<size_t>::max());
+        }
 
+        const std::string cacheKey = pageKey(token, limit, cursor);
         bool foundCache = false;
-        auto entry = m_searchEngine->searchCache(token, core::CacheType::ContextSearch, foundCache);
+        auto entry = m_searchEngine->searchCache(cacheKey, core::CacheType::ContextSearch, foundCache);
         if (foundCache)
         {
-            responsePtr->getResponses() = Json::parse(entry).get<std::vector<std::string>>();
+            const Json cached = Json::parse(entry);
+            responsePtr->getResponses() = cached.at("responses").get<std::vector<std::string>>();
+            responsePtr->getNextcursor() = cached.at("nextCursor").get<std::string>();
             responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
             return responsePtr;
         }
@@ -264,83 +473,300 @@ namespace anechka
         }
 
         std::vector<std::string>& index = responsePtr->getResponses();
-        std::unordered_multimap<std::string, std::string> contexts;
-        for (auto&&[path, i]: tokenPtr->iterate())
+        std::vector<core::Posting> page = tokenPtr->page(after, limit + 1, true);
+        size_t docs = 0;
+        for (auto begin = page.begin(); begin != page.end();)
         {
+            const core::DocId docId = begin->first;
+            auto end = std::find_if(begin, page.end(), [docId](const core::Posting& posting) {
+                return posting.first != docId;
+            });
+            if (++docs > limit)
+            {
+                responsePtr->getNextcursor() = core::paging::encode(std::prev(begin)->first, 0);
+                break;
+            }
+
+            const std::string path = m_searchEngine->docPath(docId);
             std::unique_ptr<const MMapASCII> mmap;
             try
             {
-                mmap = std::make_unique<const MMapASCII>(std::string{path});
+                mmap = std::make_unique<const MMapASCII>(path);
             }
             catch (const std::exception& err)
             {
+                begin = end;
                 continue;
             }
 
-            contexts.emplace(path, escape(contextualize(mmap, i)));
-        }
-
-        size_t threshold = 50;
-        for (auto iter = contexts.begin(); iter != contexts.end();)
-        {
-            if (threshold == 0)
-            {
-                break;
-            }
             Json jcontexts;
-            auto end = contexts.equal_range(iter->first).second;
-
-            std::string key = iter->first;
-            for (; iter != end; ++iter)
+            for (; begin != end; ++begin)
             {
-                jcontexts.push_back(iter->second);
+                jcontexts.push_back(escape(contextualize(mmap, core::position::offset(begin->second))));
             }
 
             Json final;
-            final["path"] = std::move(key);
+            final["path"] = path;
             final["contexts"] = std::move(jcontexts.dump(2));
-
             index.push_back(final.dump(2));
-            threshold--;
         }
         responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
-        m_searchEngine->cache(token, Json(index).dump(), core::CacheType::ContextSearch);
+        const Json cached{{"responses", index}, {"nextCursor", responsePtr->getNextcursor()}};
+        m_searchEngine->cache(cacheKey, cached.dump(), core::CacheType::ContextSearch);
 
         return responsePtr;
     }
 
+    static void serializeRanks(core::ranking::RankedDocs&& ranked, std::vector<std::string>&& cursors, size_t limit,
+                               const net::SearchQueryResponse::ResponsePtr& responsePtr)
+    {
+        /**
+        * ranked holds up to one document beyond the page, which tells whether there is a next one
+        */
+        responsePtr->getNextcursor() = ranked.size() > limit ? cursors[limit - 1] : "";
+        ranked.resize(std::min(ranked.size(), limit));
+        cursors.resize(ranked.size());
+
+        std::vector<std::string>& final = responsePtr->getRankeddocs();
+        final.reserve(ranked.size());
+        for (const auto& docRes: ranked)
+        {
+            Json docEntry{{"path", docRes.first}, {"rank", docRes.second}};
+            final.push_back(docEntry.dump(2));
+        }
+        responsePtr->getCursors() = std::move(cursors);
+    }
+
+    bool Anechka::parsePage(uint64_t limit, const std::string& cursor, core::ranking::Page& page) const
+    {
+        /**
+        * the page is extended by one document to find out whether another page follows
+        */
+        page.limit = core::paging::limit(limit, QuerySearchLimit, m_maxSearchLimit) + 1;
+        if (cursor.empty())
+        {
+            page.after.reset();
+            return true;
+        }
+        core::ranking::ScoredDoc after;
+        if (!core::ranking::decodeCursor(cursor, after))
+        {
+            return false;
+        }
+        page.after = after;
+        return true;
+    }
+
     net::ResponsePtr Anechka::RequestQuerySearch(const net::RequestPtr& requestPtr)
     {
         utils::Timer timer{};
         auto queryRequestPtr = utils::downcast<net::SearchQueryRequest::SearchQueryRequest>(requestPtr);
         auto responsePtr = std::make_shared<net::SearchQueryResponse::SearchQueryResponse>();
+        responsePtr->getPartial() = false;
+        if (!isReadable(responsePtr))
+        {
+            return responsePtr;
+        }
 
         const std::string& query = queryRequestPtr->getQuery();
+        const std::string& cursor = queryRequestPtr->getCursor();
+        core::ranking::Page page;
+        if (!parsePage(queryRequestPtr->getLimit(), cursor, page))
+        {
+            responsePtr->setMetadata(net::ProtocolStatus::ProtocolError, "Invalid cursor");
+            return responsePtr;
+        }
 
+        const bool isRanked = queryRequestPtr->getRanked();
+        const std::string cacheKey = pageKey(query, page.limit, cursor) + (isRanked ? "" : "\nunranked");
         bool foundCache = false;
-        auto cachedRank = m_searchEngine->searchCache(query, core::CacheType::QuerySearch, foundCache);
+        auto cachedRank = m_searchEngine->searchCache(cacheKey, core::CacheType::QuerySearch, foundCache);
         if (foundCache)
         {
-            responsePtr->getRankeddocs() = Json::parse(cachedRank).get<std::vector<std::string>>();
+            const Json cached = Json::parse(cachedRank);
+            responsePtr->getRankeddocs() = cached.at("rankedDocs").get<std::vector<std::string>>();
+            responsePtr->getCursors() = cached.at("cursors").get<std::vector<std::string>>();
+            responsePtr->getNextcursor() = cached.at("nextCursor").get<std::string>();
             responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
 
             return responsePtr;
         }
 
-        core::tfidf::RankedDocs ranked = m_searchEngine->searchQuery(queryRequestPtr->getQuery());
+        std::vector<std::string> cursors;
+        core::ranking::RankedDocs ranked = isRanked ? m_searchEngine->searchQuery(query, page, cursors)
+                                                    : m_searchEngine->filterQuery(query, page, cursors);
+        serializeRanks(std::move(ranked), std::move(cursors), page.limit - 1, responsePtr);
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
 
-        std::vector<std::string> final;
-        final.reserve(ranked.size());
-        for (const auto& docRes: ranked)
+        const Json cached{{"rankedDocs", responsePtr->getRankeddocs()}, {"cursors", responsePtr->getCursors()},
+                          {"nextCursor", responsePtr->getNextcursor()}};
+        m_searchEngine->cache(cacheKey, cached.dump(), core::CacheType::QuerySearch);
+
+        return responsePtr;
+    }
+
+    net::ResponsePtr Anechka::RequestQueryStats(const net::RequestPtr& requestPtr)
+    {
+        utils::Timer timer{};
+        auto queryRequestPtr = utils::downcast<net::SearchQueryRequest::SearchQueryRequest>(requestPtr);
+        auto responsePtr = std::make_shared<net::QueryStatsResponse::QueryStatsResponse>();
+        if (!isReadable(responsePtr))
         {
-            Json docEntry{{"path", docRes.first}, {"rank", docRes.second}};
-            final.push_back(docEntry.dump(2));
+            return responsePtr;
+        }
+
+        core::ranking::QueryStats stats = m_searchEngine->queryStats(queryRequestPtr->getQuery());
+        responsePtr->getTokens() = std::move(stats.tokens);
+        responsePtr->getDocfreqs() = {stats.docFreqs.begin(), stats.docFreqs.end()};
+        responsePtr->getDoccount() = stats.docCount;
+        responsePtr->getTotaltokens() = stats.totalTokens;
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
+
+        return responsePtr;
+    }
+
+    net::ResponsePtr Anechka::RequestGlobalQuerySearch(const net::RequestPtr& requestPtr)
+    {
+        /**
+        * results depend on the statistics sent along with the query, so they bypass the query cache
+        */
+        utils::Timer timer{};
+        auto queryRequestPtr = utils::downcast<net::GlobalQueryRequest::GlobalQueryRequest>(requestPtr);
+        auto responsePtr = std::make_shared<net::SearchQueryResponse::SearchQueryResponse>();
+        responsePtr->getPartial() = false;
+        if (!isReadable(responsePtr))
+        {
+            return responsePtr;
+        }
+
+        core::ranking::Page page;
+        if (!parsePage(queryRequestPtr->getLimit(), queryRequestPtr->getCursor(), page))
+        {
+            responsePtr->setMetadata(net::ProtocolStatus::ProtocolError, "Invalid cursor");
+            return responsePtr;
+        }
+
+        core::ranking::QueryStats globalStats;
+        globalStats.tokens = queryRequestPtr->getTokens();
+        globalStats.docFreqs = {queryRequestPtr->getDocfreqs().begin(), queryRequestPtr->getDocfreqs().end()};
+        globalStats.docCount = queryRequestPtr->getDoccount();
+        globalStats.totalTokens = queryRequestPtr->getTotaltokens();
+
+        std::vector<std::string> cursors;
+        core::ranking::RankedDocs ranked =
+            queryRequestPtr->getRanked()
+                ? m_searchEngine->searchQuery(queryRequestPtr->getQuery(), globalStats, page, cursors)
+                : m_searchEngine->filterQuery(queryRequestPtr->getQuery(), page, cursors);
+        serializeRanks(std::move(ranked), std::move(cursors), page.limit - 1, responsePtr);
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
+
+        return responsePtr;
+    }
+
+    net::ResponsePtr Anechka::RequestTermExpansion(const net::RequestPtr& requestPtr)
+    {
+        /**
+        * expansions are served off the term dictionaries of the shards and are not cached
+        */
+        utils::Timer timer{};
+        auto expansionRequestPtr = utils::downcast<net::TermExpansionRequest::TermExpansionRequest>(requestPtr);
+        auto responsePtr = std::make_shared<net::TermExpansionResponse::TermExpansionResponse>();
+        responsePtr->getTruncated() = false;
+        responsePtr->getPartial() = false;
+        if (!isReadable(responsePtr))
+        {
+            return responsePtr;
         }
 
-        responsePtr->getRankeddocs() = final;
+        const size_t limit = core::paging::limit(expansionRequestPtr->getLimit(), TermExpansionLimit,
+                                                 m_maxSearchLimit);
+        bool truncated = false;
+        if (expansionRequestPtr->getMaxedits() > 0)
+        {
+            for (auto& match: m_searchEngine->fuzzyTerms(expansionRequestPtr->getPattern(),
+                                                         expansionRequestPtr->getMaxedits(), limit, truncated))
+            {
+                responsePtr->getTerms().push_back(std::move(match.term));
+                responsePtr->getDocfreqs().push_back(match.docFreq);
+                responsePtr->getDistances().push_back(match.distance);
+            }
+        }
+        else
+        {
+            responsePtr->getTerms() = m_searchEngine->expandTerms(expansionRequestPtr->getPattern(), limit, truncated);
+            for (const auto& term: responsePtr->getTerms())
+            {
+                responsePtr->getDocfreqs().push_back(m_searchEngine->docFreq(term));
+                responsePtr->getDistances().push_back(0);
+            }
+        }
+        responsePtr->getTruncated() = truncated;
         responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
 
-        m_searchEngine->cache(query, {Json(final).dump()}, core::CacheType::QuerySearch);
+        return responsePtr;
+    }
+
+    net::ResponsePtr Anechka::RequestMutations(const net::RequestPtr& requestPtr)
+    {
+        utils::Timer timer{};
+        auto replicationRequestPtr = utils::downcast<net::ReplicationRequest::ReplicationRequest>(requestPtr);
+        auto responsePtr = std::make_shared<net::MutationsResponse::MutationsResponse>();
+
+        if (!m_searchEngine->isLogging())
+        {
+            responsePtr->setMetadata(net::ProtocolStatus::ProtocolError, "Replication log is disabled");
+            return responsePtr;
+        }
+
+        bool truncated = false;
+        responsePtr->getMutations() = m_searchEngine->mutationsSince(replicationRequestPtr->getFromseq(),
+                                                                     replicationRequestPtr->getLimit(), truncated);
+        responsePtr->getTruncated() = truncated;
+        responsePtr->getLastseq() = m_searchEngine->replicationSeq();
+        responsePtr->getEpoch() = m_searchEngine->replicationEpoch();
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
+
+        return responsePtr;
+    }
+
+    net::ResponsePtr Anechka::RequestSnapshot(const net::RequestPtr&)
+    {
+        /**
+        * the sequence number is read first, the snapshot covers every mutation up to it and possibly some
+        * of the following ones, which are then applied twice by the replica
+        */
+        utils::Timer timer{};
+        auto responsePtr = std::make_shared<net::SnapshotResponse::SnapshotResponse>();
+
+        responsePtr->getSeq() = m_searchEngine->replicationSeq();
+        responsePtr->getEpoch() = m_searchEngine->replicationEpoch();
+        responsePtr->getSnapshot() = m_searchEngine->snapshot().dump();
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
+
+        return responsePtr;
+    }
+
+    net::ResponsePtr Anechka::RequestReplicationStatus(const net::RequestPtr&)
+    {
+        utils::Timer timer{};
+        auto responsePtr = std::make_shared<net::ReplicationStatusResponse::ReplicationStatusResponse>();
+
+        if (m_replica)
+        {
+            const ReplicaStatus status = m_replica->status();
+            responsePtr->getRole() = "replica";
+            responsePtr->getAppliedseq() = status.appliedSeq;
+            responsePtr->getPrimaryseq() = status.primarySeq;
+            responsePtr->getLagms() = status.lagMs;
+        }
+        else
+        {
+            responsePtr->getRole() = "primary";
+            responsePtr->getAppliedseq() = m_searchEngine->replicationSeq();
+            responsePtr->getPrimaryseq() = m_searchEngine->replicationSeq();
+            responsePtr->getLagms() = 0;
+        }
+        responsePtr->getTook() = std::to_string(timer.getInterval()) + "ms";
 
         return responsePtr;
     }
@@ -3,6 +3,7 @@
 #include "../network/gen/gen_messages.h"
 #include "../network/gen/gen_server_stub.h"
 #include "../engine/engine.h"
+#include "replica.h"
 
 namespace anechka
 {
@@ -15,17 +16,35 @@ namespace anechka
         Anechka& operator=(const Anechka& other) = delete;
         net::ResponsePtr RequestTxtFileIndexing(const net::RequestPtr& requestPtr) override;
         net::ResponsePtr RequestRecursiveDirIndexing(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestJobStatus(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestJobCancel(const net::RequestPtr& requestPtr) override;
         net::ResponsePtr RequestTokenSearch(const net::RequestPtr& requestPtr) override;
         net::ResponsePtr RequestTokenSearchWithContext(const net::RequestPtr& requestPtr) override;
         net::ResponsePtr RequestTokenDeletion(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestDocumentDeletion(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestDocumentReindex(const net::RequestPtr& requestPtr) override;
         net::ResponsePtr RequestQuerySearch(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestQueryStats(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestGlobalQuerySearch(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestTermExpansion(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestMutations(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestSnapshot(const net::RequestPtr& requestPtr) override;
+        net::ResponsePtr RequestReplicationStatus(const net::RequestPtr& requestPtr) override;
 
     private:
         void config(const std::string& configPath);
+        std::string engineStatus() const;
+        bool isReadable(const net::ResponsePtr& responsePtr) const;
+        bool parsePage(uint64_t limit, const std::string& cursor, core::ranking::Page& page) const;
 
     private:
         bool m_persistent{false};
         std::string m_dumpPath{"../dump/dump.bson"};
+        size_t m_maxSearchLimit{1000};
         core::SearchEnginePtr m_searchEngine;
+        /**
+        * set when the server replicates another one, writes are then rejected
+        */
+        ReplicaPtr m_replica;
     };
 }
\ No newline at end of file
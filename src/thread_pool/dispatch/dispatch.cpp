@@ -31,7 +31,14 @@ namespace core
     void QueueDispatch::pushTaskToLeastBusy(Task&& task)
     {
         QueuePtr queue = extractLeastBusy();
-        queue->push(std::move(task));
+        if (task.getPriority() == TaskPriority::Background)
+        {
+            queue->pushBackground(std::move(task));
+        }
+        else
+        {
+            queue->push(std::move(task));
+        }
         insertQueue(queue);
     }
 
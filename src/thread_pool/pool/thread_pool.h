@@ -22,14 +22,15 @@ namespace core
         ThreadPool& operator=(const ThreadPool& other) noexcept = delete;
 
         template<typename Invocable>
-        WaitableFuture submitTask(Invocable&& invocable, bool isWaiting = false)
+        WaitableFuture submitTask(Invocable&& invocable, bool isWaiting = false,
+                                  TaskPriority priority = TaskPriority::Normal)
         {
             if (m_shutDown || !m_isInitialized)
             {
                 return {};
             }
             size_t thisId = std::hash<std::thread::id>{}(std::this_thread::get_id());
-            Task task(CallBack(std::forward<Invocable>(invocable), thisId));
+            Task task(CallBack(std::forward<Invocable>(invocable), thisId), priority);
             WaitableFuture future{std::move(task.getFuture()), isWaiting};
             m_jobCount++;
             m_primaryDispatch.pushTaskToLeastBusy(std::move(task));
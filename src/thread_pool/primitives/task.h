@@ -5,14 +5,21 @@
 
 namespace core
 {
+    enum class TaskPriority : int8_t
+    {
+        Normal = 0,
+        Background = 1,
+    };
+
     template<typename T>
     class PackagedTask
     {
     public:
         PackagedTask() = default;
-        explicit PackagedTask(CallBack&& callback)
+        explicit PackagedTask(CallBack&& callback, TaskPriority priority = TaskPriority::Normal)
         {
             m_id = callback.getSenderId();
+            m_priority = priority;
             std::packaged_task<T()> task(std::move(callback));
             m_task = std::move(task);
         }
@@ -37,8 +44,14 @@ namespace core
             return m_task.valid();
         }
 
+        TaskPriority getPriority() const
+        {
+            return m_priority;
+        }
+
     private:
         size_t m_id{0};
+        TaskPriority m_priority{TaskPriority::Normal};
         std::packaged_task<T()> m_task;
     };
 }
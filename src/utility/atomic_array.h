@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace utils
+{
+    template<typename T>
+    class AtomicArray
+    {
+        /**
+        * Growable array of atomic values addressed by a 32-bit index, the counterpart of AtomicBitmap.
+        * Values live in lazily allocated chunks and read as T{} until stored, loads take no lock.
+        * Chunks are never released before the array itself is destroyed.
+        */
+        using Value = std::atomic<T>;
+
+        static constexpr size_t ChunkSize = size_t{1} << 18;
+        static constexpr size_t MaxChunks = (size_t{1} << 32) / ChunkSize;
+
+    public:
+        AtomicArray()
+            : m_chunks(std::make_unique<std::atomic<Value*>[]>(MaxChunks))
+        {
+        }
+
+        ~AtomicArray()
+        {
+            for (size_t i = 0; i < MaxChunks; i++)
+            {
+                delete[] m_chunks[i].load(std::memory_order_relaxed);
+            }
+        }
+
+        AtomicArray(const AtomicArray& other) = delete;
+        AtomicArray& operator=(const AtomicArray& other) = delete;
+
+        T load(size_t i) const noexcept
+        {
+            const Value* chunk = m_chunks[i / ChunkSize].load(std::memory_order_acquire);
+            return chunk ? chunk[i % ChunkSize].load(std::memory_order_acquire) : T{};
+        }
+
+        void store(size_t i, T value)
+        {
+            getChunk(i / ChunkSize)[i % ChunkSize].store(value, std::memory_order_release);
+        }
+
+    private:
+        Value* getChunk(size_t chunkId)
+        {
+            Value* chunk = m_chunks[chunkId].load(std::memory_order_acquire);
+            if (chunk)
+            {
+                return chunk;
+            }
+            Value* fresh = new Value[ChunkSize]();
+            if (m_chunks[chunkId].compare_exchange_strong(chunk, fresh, std::memory_order_acq_rel))
+            {
+                return fresh;
+            }
+            delete[] fresh;
+            return chunk;
+        }
+
+    private:
+        std::unique_ptr<std::atomic<Value*>[]> m_chunks;
+    };
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace utils
+{
+    class AtomicBitmap
+    {
+        /**
+        * Growable bitmap with lock-free reads and writes. Bits are grouped in lazily allocated chunks
+        * so that the bitmap can address the whole 32-bit range without reserving it upfront.
+        * Chunks are never released before the bitmap itself is destroyed.
+        */
+        using Word = std::atomic<uint64_t>;
+
+        static constexpr size_t WordBits = 64;
+        static constexpr size_t ChunkBits = size_t{1} << 18;
+        static constexpr size_t ChunkWords = ChunkBits / WordBits;
+        static constexpr size_t MaxChunks = (size_t{1} << 32) / ChunkBits;
+
+    public:
+        AtomicBitmap()
+            : m_chunks(std::make_unique<std::atomic<Word*>[]>(MaxChunks))
+        {
+        }
+
+        ~AtomicBitmap()
+        {
+            for (size_t i = 0; i < MaxChunks; i++)
+            {
+                delete[] m_chunks[i].load(std::memory_order_relaxed);
+            }
+        }
+
+        AtomicBitmap(const AtomicBitmap& other) = delete;
+        AtomicBitmap& operator=(const AtomicBitmap& other) = delete;
+
+        bool test(size_t i) const noexcept
+        {
+            const Word* chunk = m_chunks[i / ChunkBits].load(std::memory_order_acquire);
+            if (!chunk)
+            {
+                return false;
+            }
+            const uint64_t word = chunk[(i % ChunkBits) / WordBits].load(std::memory_order_acquire);
+            return word & (uint64_t{1} << (i % WordBits));
+        }
+
+        bool set(size_t i)
+        {
+            /**
+            * returns true if the bit was not set before
+            */
+            const uint64_t mask = uint64_t{1} << (i % WordBits);
+            Word& word = getChunk(i / ChunkBits)[(i % ChunkBits) / WordBits];
+            return !(word.fetch_or(mask, std::memory_order_acq_rel) & mask);
+        }
+
+        bool reset(size_t i)
+        {
+            /**
+            * returns true if the bit was set before
+            */
+            Word* chunk = m_chunks[i / ChunkBits].load(std::memory_order_acquire);
+            if (!chunk)
+            {
+                return false;
+            }
+            const uint64_t mask = uint64_t{1} << (i % WordBits);
+            Word& word = chunk[(i % ChunkBits) / WordBits];
+            return word.fetch_and(~mask, std::memory_order_acq_rel) & mask;
+        }
+
+    private:
+        Word* getChunk(size_t chunkId)
+        {
+            Word* chunk = m_chunks[chunkId].load(std::memory_order_acquire);
+            if (chunk)
+            {
+                return chunk;
+            }
+            Word* fresh = new Word[ChunkWords]();
+            if (m_chunks[chunkId].compare_exchange_strong(chunk, fresh, std::memory_order_acq_rel))
+            {
+                return fresh;
+            }
+            delete[] fresh;
+            return chunk;
+        }
+
+    private:
+        std::unique_ptr<std::atomic<Word*>[]> m_chunks;
+    };
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+namespace core
+{
+    template<typename T>
+    class BoundedQueue
+    {
+        /**
+        * A FIFO queue between two stages of a pipeline. push blocks while the queue holds capacity entries,
+        * which holds the producers back to the pace of the consumers, pop blocks while it is empty.
+        * Once closed, pushing fails and popping fails as soon as the queue has been drained
+        */
+    public:
+        explicit BoundedQueue(size_t capacity)
+            : m_capacity(capacity > 0 ? capacity : 1)
+        {
+        }
+
+        BoundedQueue(const BoundedQueue& other) = delete;
+        BoundedQueue& operator=(const BoundedQueue& other) = delete;
+
+        bool push(T&& value)
+        {
+            std::unique_lock<std::mutex> lock(m_mtx);
+            m_notFull.wait(lock, [this] {
+                return m_entries.size() < m_capacity || m_isClosed;
+            });
+            if (m_isClosed)
+            {
+                return false;
+            }
+            m_entries.push_back(std::move(value));
+            m_peak = std::max(m_peak, m_entries.size());
+            m_notEmpty.notify_one();
+            return true;
+        }
+
+        bool pop(T& value)
+        {
+            std::unique_lock<std::mutex> lock(m_mtx);
+            m_notEmpty.wait(lock, [this] {
+                return !m_entries.empty() || m_isClosed;
+            });
+            if (m_entries.empty())
+            {
+                return false;
+            }
+            value = std::move(m_entries.front());
+            m_entries.pop_front();
+            m_notFull.notify_one();
+            return true;
+        }
+
+        /**
+        * pops without waiting, false when the queue is empty
+        */
+        bool tryPop(T& value)
+        {
+            std::lock_guard<std::mutex> lock(m_mtx);
+            if (m_entries.empty())
+            {
+                return false;
+            }
+            value = std::move(m_entries.front());
+            m_entries.pop_front();
+            m_notFull.notify_one();
+            return true;
+        }
+
+        void close()
+        {
+            std::lock_guard<std::mutex> lock(m_mtx);
+            m_isClosed = true;
+            m_notFull.notify_all();
+            m_notEmpty.notify_all();
+        }
+
+        size_t size() const
+        {
+            std::lock_guard<std::mutex> lock(m_mtx);
+            return m_entries.size();
+        }
+
+        size_t capacity() const
+        {
+            return m_capacity;
+        }
+
+        /**
+        * the most entries the queue has held at once
+        */
+        size_t peak() const
+        {
+            std::lock_guard<std::mutex> lock(m_mtx);
+            return m_peak;
+        }
+
+    private:
+        const size_t m_capacity;
+        mutable std::mutex m_mtx;
+        std::condition_variable m_notFull;
+        std::condition_variable m_notEmpty;
+        std::deque<T> m_entries;
+        size_t m_peak{0};
+        bool m_isClosed{false};
+    };
+}
@@ -0,0 +1,259 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace utils
+{
+    class Epoch
+    {
+        /**
+        * Epoch-based reclamation for objects published through plain atomic pointers. A reader pins the
+        * current epoch for as long as it uses what it has loaded. A writer that unpublishes an object
+        * retires it, and the object is destroyed once no reader pinned at or before the epoch of its
+        * retirement is left.
+        *
+        * Pinning stores the epoch into a slot owned by the calling thread and fences, so readers write no
+        * shared memory and contend neither with each other nor with writers. Threads take a slot on first
+        * use and give it back on exit, threads beyond MaxSlots share an overflow counter, which holds back
+        * all reclamation while any of them is pinned. Retired objects are collected whenever another one
+        * is retired, writers never wait for readers
+        */
+        static constexpr uint64_t Idle = std::numeric_limits<uint64_t>::max();
+
+    public:
+        static constexpr size_t MaxSlots = 1024;
+
+        class Guard
+        {
+            /**
+            * keeps the epoch pinned until destroyed and must be destroyed by the thread that took it.
+            * Guards of a thread nest, the outermost one decides the pinned epoch
+            */
+        public:
+            Guard() = default;
+
+            Guard(Guard&& other) noexcept
+                : m_epoch(std::exchange(other.m_epoch, nullptr))
+            {
+            }
+
+            Guard& operator=(Guard&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    release();
+                    m_epoch = std::exchange(other.m_epoch, nullptr);
+                }
+                return *this;
+            }
+
+            ~Guard()
+            {
+                release();
+            }
+
+            explicit operator bool() const
+            {
+                return m_epoch != nullptr;
+            }
+
+        private:
+            friend class Epoch;
+
+            explicit Guard(Epoch* epoch)
+                : m_epoch(epoch)
+            {
+            }
+
+            void release()
+            {
+                if (m_epoch)
+                {
+                    m_epoch->unpin();
+                    m_epoch = nullptr;
+                }
+            }
+
+        private:
+            Epoch* m_epoch{nullptr};
+        };
+
+        static Epoch& global()
+        {
+            static Epoch epoch;
+            return epoch;
+        }
+
+        Epoch(const Epoch& other) = delete;
+        Epoch& operator=(const Epoch& other) = delete;
+
+        ~Epoch()
+        {
+            for (const Retired& retired: m_retired)
+            {
+                retired.deleter(retired.object);
+            }
+        }
+
+        Guard pin()
+        {
+            Slot* slot = threadSlot();
+            if (!slot)
+            {
+                m_overflow.fetch_add(1, std::memory_order_seq_cst);
+                return Guard(this);
+            }
+            if (slot->depth++ == 0)
+            {
+                slot->epoch.store(m_epoch.load(std::memory_order_acquire), std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+            return Guard(this);
+        }
+
+        template<typename T>
+        void retire(const T* object)
+        {
+            /**
+            * object must be unreachable for readers that pin from now on, it is deleted once the readers
+            * pinned so far are gone
+            */
+            if (!object)
+            {
+                return;
+            }
+            std::vector<Retired> reclaimed;
+            {
+                std::lock_guard<std::mutex> lock(m_mtx);
+                const uint64_t epoch = m_epoch.fetch_add(1, std::memory_order_seq_cst);
+                m_retired.push_back({epoch, object, [](const void* retired) {
+                    delete static_cast<const T*>(retired);
+                }});
+                reclaimed = collect();
+            }
+            for (const Retired& retired: reclaimed)
+            {
+                retired.deleter(retired.object);
+            }
+        }
+
+    private:
+        struct alignas(64) Slot
+        {
+            std::atomic<uint64_t> epoch{Idle};
+            std::atomic<bool> isTaken{false};
+            /**
+            * guards of the owning thread alive, touched by that thread only
+            */
+            size_t depth{0};
+        };
+
+        struct Retired
+        {
+            uint64_t epoch;
+            const void* object;
+            void (*deleter)(const void*);
+        };
+
+        class Registration
+        {
+            /**
+            * the slot of a thread, given back when the thread exits
+            */
+        public:
+            explicit Registration(Epoch& epoch)
+            {
+                for (Slot& slot: epoch.m_slots)
+                {
+                    bool isTaken = false;
+                    if (slot.isTaken.compare_exchange_strong(isTaken, true, std::memory_order_acquire))
+                    {
+                        m_slot = &slot;
+                        return;
+                    }
+                }
+            }
+
+            ~Registration()
+            {
+                if (m_slot)
+                {
+                    m_slot->depth = 0;
+                    m_slot->epoch.store(Idle, std::memory_order_release);
+                    m_slot->isTaken.store(false, std::memory_order_release);
+                }
+            }
+
+            Registration(const Registration& other) = delete;
+            Registration& operator=(const Registration& other) = delete;
+
+            Slot* slot() const
+            {
+                return m_slot;
+            }
+
+        private:
+            Slot* m_slot{nullptr};
+        };
+
+        Epoch() = default;
+
+        Slot* threadSlot()
+        {
+            thread_local Registration registration(*this);
+            return registration.slot();
+        }
+
+        void unpin()
+        {
+            Slot* slot = threadSlot();
+            if (!slot)
+            {
+                m_overflow.fetch_sub(1, std::memory_order_release);
+                return;
+            }
+            if (--slot->depth == 0)
+            {
+                slot->epoch.store(Idle, std::memory_order_release);
+            }
+        }
+
+        std::vector<Retired> collect()
+        {
+            /**
+            * Pairs with the fence of pin: a reader whose slot is not seen pinned here loads the pointers
+            * published in place of the retired objects
+            */
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (m_overflow.load(std::memory_order_acquire) > 0)
+            {
+                return {};
+            }
+            uint64_t oldest = Idle;
+            for (const Slot& slot: m_slots)
+            {
+                oldest = std::min(oldest, slot.epoch.load(std::memory_order_acquire));
+            }
+            const auto reclaimable = std::stable_partition(m_retired.begin(), m_retired.end(),
+                                                           [oldest](const Retired& retired) {
+                return retired.epoch >= oldest;
+            });
+            std::vector<Retired> reclaimed(reclaimable, m_retired.end());
+            m_retired.erase(reclaimable, m_retired.end());
+            return reclaimed;
+        }
+
+    private:
+        std::atomic<uint64_t> m_epoch{0};
+        std::atomic<size_t> m_overflow{0};
+        Slot m_slots[MaxSlots];
+        std::mutex m_mtx;
+        std::vector<Retired> m_retired;
+    };
+}
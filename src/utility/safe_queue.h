@@ -23,12 +23,23 @@ namespace core
             m_cv.notify_one();
         }
 
+        void pushBackground(T&& task)
+        {
+            /**
+            * Background entries are only handed out by pop once the primary lane is empty
+            */
+            std::unique_lock lock(m_mtx);
+            m_backgroundTasks.emplace(std::move(task));
+            m_size++;
+            m_cv.notify_one();
+        }
+
         bool pop(T& value)
         {
             {
                 std::unique_lock lock(m_mtx);
                 m_cv.wait(lock, [&] {
-                    return !m_tasks.empty() || m_abort;
+                    return m_size > 0 || m_abort;
                 });
 
                 if (m_abort)
@@ -36,8 +47,9 @@ namespace core
                     return false;
                 }
 
-                value = std::move(m_tasks.front());
-                m_tasks.pop();
+                std::queue<T>& lane = m_tasks.empty() ? m_backgroundTasks : m_tasks;
+                value = std::move(lane.front());
+                lane.pop();
                 m_size--;
             }
             return true;
@@ -72,6 +84,7 @@ namespace core
         std::atomic<bool> m_abort{false};
         std::condition_variable_any m_cv;
         std::queue<T> m_tasks;
+        std::queue<T> m_backgroundTasks;
         mutable std::shared_mutex m_mtx;
     };
 
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace utils
+{
+    class SharedSpinMutex
+    {
+        /**
+        * Reader-writer lock in a single word, for the many small objects that are locked only briefly and
+        * could not afford a std::shared_mutex each. A waiting writer keeps new readers out, so a steady
+        * stream of readers does not starve it. Waiters yield instead of sleeping.
+        * Meets the requirements of std::unique_lock and std::shared_lock
+        */
+        static constexpr uint32_t Writer = uint32_t{1} << 31;
+        static constexpr uint32_t Pending = uint32_t{1} << 30;
+        static constexpr uint32_t Readers = Pending - 1;
+
+    public:
+        SharedSpinMutex() = default;
+        SharedSpinMutex(const SharedSpinMutex& other) = delete;
+        SharedSpinMutex& operator=(const SharedSpinMutex& other) = delete;
+
+        void lock() noexcept
+        {
+            uint32_t state = m_state.load(std::memory_order_relaxed);
+            while (true)
+            {
+                if ((state & (Writer | Readers)) == 0)
+                {
+                    if (m_state.compare_exchange_weak(state, Writer, std::memory_order_acquire,
+                                                      std::memory_order_relaxed))
+                    {
+                        return;
+                    }
+                    continue;
+                }
+                if (!(state & Pending))
+                {
+                    m_state.fetch_or(Pending, std::memory_order_relaxed);
+                }
+                std::this_thread::yield();
+                state = m_state.load(std::memory_order_relaxed);
+            }
+        }
+
+        void unlock() noexcept
+        {
+            m_state.fetch_and(~Writer, std::memory_order_release);
+        }
+
+        void lock_shared() noexcept
+        {
+            uint32_t state = m_state.load(std::memory_order_relaxed);
+            while (true)
+            {
+                if ((state & (Writer | Pending)) == 0)
+                {
+                    if (m_state.compare_exchange_weak(state, state + 1, std::memory_order_acquire,
+                                                      std::memory_order_relaxed))
+                    {
+                        return;
+                    }
+                    continue;
+                }
+                std::this_thread::yield();
+                state = m_state.load(std::memory_order_relaxed);
+            }
+        }
+
+        void unlock_shared() noexcept
+        {
+            m_state.fetch_sub(1, std::memory_order_release);
+        }
+
+    private:
+        std::atomic<uint32_t> m_state{0};
+    };
+}
@@ -72,7 +72,10 @@ TEST(Anechka, ContextSearchTest)
     std::this_thread::sleep_for(std::chrono::seconds(1));
 
     auto clientStubPtr = std::make_unique<anechka::ClientStub>();
-    clientStubPtr->RequestRecursiveDirIndexing(path);
+    // indexing runs in the background, the job is followed until it is over
+    auto indexing = clientStubPtr->RequestRecursiveDirIndexing(path);
+    ASSERT_TRUE(indexing->getOk());
+    clientStubPtr->AwaitJob(indexing->getJobid());
 
     std::vector<std::thread> clientThreads;
     std::atomic<int64_t> resSize = -1;
@@ -116,7 +119,10 @@ TEST(Anechka, Comprehensive)
     std::this_thread::sleep_for(std::chrono::seconds(3));
 
     auto clientStubPtr = std::make_unique<anechka::ClientStub>();
-    clientStubPtr->RequestRecursiveDirIndexing(path);
+    // indexing runs in the background, the job is followed until it is over
+    auto indexing = clientStubPtr->RequestRecursiveDirIndexing(path);
+    ASSERT_TRUE(indexing->getOk());
+    clientStubPtr->AwaitJob(indexing->getJobid());
 
     std::vector<std::string> corpus {
         "The", "more", "I", "read", "acquire", "certain", "that", "know", "nothing",
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include "../src/engine/dir_watcher.h"
+
+TEST(DirWatcher, Coalescing)
+{
+    const std::filesystem::path root = std::filesystem::temp_directory_path() / "anechka_watch_test";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root);
+
+    std::mutex mtx;
+    std::unordered_map<std::string, std::pair<core::WatchEvent, size_t>> seen;
+    core::DirWatcher watcher([&](const std::string& path, core::WatchEvent event) {
+        std::unique_lock<std::mutex> lock(mtx);
+        auto& entry = seen[std::filesystem::path(path).filename().string()];
+        entry.first = event;
+        entry.second++;
+    }, 200);
+
+    ASSERT_TRUE(watcher.watch(root.string()));
+    EXPECT_FALSE(watcher.watch((root / "idontexist").string()));
+
+    for (size_t i = 0; i < 5; i++)
+    {
+        std::ofstream f(root / "first.txt", std::ios::app);
+        f << "The more I read, the more I acquire ";
+    }
+    {
+        std::ofstream f(root / "second.txt");
+        f << "doomed";
+    }
+    std::filesystem::remove(root / "second.txt");
+
+    std::filesystem::create_directories(root / "nested");
+    {
+        std::ofstream f(root / "nested" / "third.txt");
+        f << "nested";
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+
+    std::unique_lock<std::mutex> lock(mtx);
+    ASSERT_TRUE(seen.count("first.txt"));
+    EXPECT_EQ(seen["first.txt"].first, core::WatchEvent::Upsert);
+    EXPECT_EQ(seen["first.txt"].second, 1);
+
+    ASSERT_TRUE(seen.count("second.txt"));
+    EXPECT_EQ(seen["second.txt"].first, core::WatchEvent::Remove);
+    EXPECT_EQ(seen["second.txt"].second, 1);
+
+    ASSERT_TRUE(seen.count("third.txt"));
+    EXPECT_EQ(seen["third.txt"].first, core::WatchEvent::Upsert);
+    EXPECT_EQ(watcher.watchCount(), 2);
+
+    std::filesystem::remove_all(root);
+}
+
+TEST(DirWatcher, MovedDirectories)
+{
+    const std::filesystem::path base = std::filesystem::temp_directory_path() / "anechka_watch_move_test";
+    const std::filesystem::path root = base / "root";
+    std::filesystem::remove_all(base);
+    std::filesystem::create_directories(root / "out" / "deeper");
+    std::filesystem::create_directories(root / "renamed");
+    for (const auto& path: {root / "out" / "a.txt", root / "out" / "deeper" / "b.txt", root / "renamed" / "c.txt"})
+    {
+        std::ofstream f(path);
+        f << "moved";
+    }
+
+    std::mutex mtx;
+    std::unordered_map<std::string, core::WatchEvent> seen;
+    core::DirWatcher watcher([&](const std::string& path, core::WatchEvent event) {
+        std::unique_lock<std::mutex> lock(mtx);
+        seen[std::filesystem::relative(path, base).string()] = event;
+    }, 100);
+    ASSERT_TRUE(watcher.watch(root.string()));
+    EXPECT_EQ(watcher.watchCount(), 4);
+
+    // a directory moved out of the tree takes its files along, one moved within the tree is reported at both paths
+    std::filesystem::rename(root / "out", base / "out");
+    std::filesystem::rename(root / "renamed", root / "moved");
+    std::this_thread::sleep_for(std::chrono::milliseconds(600));
+
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        EXPECT_EQ(seen.size(), 4);
+        EXPECT_EQ(seen["root/out/a.txt"], core::WatchEvent::Remove);
+        EXPECT_EQ(seen["root/out/deeper/b.txt"], core::WatchEvent::Remove);
+        EXPECT_EQ(seen["root/renamed/c.txt"], core::WatchEvent::Remove);
+        EXPECT_EQ(seen["root/moved/c.txt"], core::WatchEvent::Upsert);
+        EXPECT_EQ(watcher.watchCount(), 2);
+        seen.clear();
+    }
+
+    // files in a moved-out directory are no longer watched, the root itself going away drops the rest
+    {
+        std::ofstream f(base / "out" / "a.txt", std::ios::app);
+        f << " away";
+    }
+    std::filesystem::rename(root, base / "gone");
+    std::this_thread::sleep_for(std::chrono::milliseconds(600));
+
+    std::unique_lock<std::mutex> lock(mtx);
+    EXPECT_EQ(seen.size(), 1);
+    EXPECT_EQ(seen["root/moved/c.txt"], core::WatchEvent::Remove);
+    EXPECT_EQ(watcher.watchCount(), 0);
+
+    std::filesystem::remove_all(base);
+}
@@ -75,4 +75,46 @@ TEST(DocTrace, Async)
             thread.join();
         }
     }
-}
\ No newline at end of file
+}
+
+TEST(DocTrace, Tombstones)
+{
+    core::DocTrace docTrace{10};
+    const core::DocId first = docTrace.addOrIncrement("first.txt", {3});
+    docTrace.increment(first);
+
+    bool isNew;
+    EXPECT_EQ(docTrace.addOrGet("first.txt", {3}, isNew), first);
+    EXPECT_FALSE(isNew);
+
+    EXPECT_TRUE(docTrace.remove("first.txt"));
+    EXPECT_FALSE(docTrace.remove("first.txt"));
+    EXPECT_FALSE(docTrace.isAlive(first));
+    EXPECT_EQ(docTrace.size(), 0);
+    EXPECT_EQ(docTrace.getTombstoneCount(), 1);
+    EXPECT_EQ(docTrace.getTombstoneTokenCount(), 3);
+
+    // the tombstone keeps its statistics until its postings are retracted
+    EXPECT_EQ(docTrace.getTokenCount(first), 3);
+    EXPECT_EQ(docTrace.getPath(first), "first.txt");
+
+    const core::DocId second = docTrace.addOrGet("first.txt", {5}, isNew);
+    EXPECT_TRUE(isNew);
+    EXPECT_NE(first, second);
+    EXPECT_TRUE(docTrace.isAlive(second));
+
+    docTrace.decrement(first);
+    docTrace.decrement(first);
+    EXPECT_EQ(docTrace.getPath(first), "");
+    EXPECT_EQ(docTrace.getTombstoneCount(), 0);
+    EXPECT_EQ(docTrace.getTombstoneTokenCount(), 0);
+    EXPECT_EQ(docTrace.getTokenCount("first.txt"), 5);
+    EXPECT_EQ(docTrace.size(), 1);
+
+    // only registered documents count towards the corpus length
+    docTrace.addOrIncrement("second.txt", {7});
+    EXPECT_EQ(docTrace.getTotalTokenCount(), 12);
+    EXPECT_FLOAT_EQ(docTrace.getAvgTokenCount(), 6.0f);
+    docTrace.remove("second.txt");
+    EXPECT_EQ(docTrace.getTotalTokenCount(), 5);
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include "../src/mmap/mmap.h"
+#include "../src/mmap/uring_reader.h"
+#include <fstream>
 
 TEST(MMapTest, FileException)
 {
@@ -28,4 +30,64 @@ TEST(MMapTest, BasicOps)
 
     EXPECT_EQ(content, "The more I read, the more I acquire, the more certain I am that I know nothing.");
     EXPECT_EQ(content.size(), 79);
+}
+
+TEST(MMapTest, EmptyFile)
+{
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "anechka_empty_test.txt";
+    std::ofstream(path).close();
+    {
+        const MMapASCII mmap(path);
+        EXPECT_EQ(mmap.size(), 0);
+        EXPECT_TRUE(mmap.view().empty());
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(MMapTest, UringReader)
+{
+    std::unique_ptr<UringReader> reader;
+    try
+    {
+        reader = std::make_unique<UringReader>(4);
+    }
+    catch (const std::exception& err)
+    {
+        GTEST_SKIP() << err.what();
+    }
+
+    const std::filesystem::path root = std::filesystem::temp_directory_path() / "anechka_uring_test";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root);
+    const std::string large(UringReader::BufferSize, 'a');
+    std::ofstream(root / "large.txt") << large;
+    std::ofstream(root / "empty.txt").close();
+    const std::vector<std::string> paths{"../test/data/sample.txt", (root / "missing.txt").string(),
+                                         (root / "large.txt").string(), (root / "empty.txt").string()};
+
+    /**
+    * files that cannot be read or fill a buffer are left to the caller, released buffers are reused
+    */
+    for (size_t round = 0; round < 3; round++)
+    {
+        std::vector<ReadBufferPtr> buffers;
+        reader->read(paths, buffers);
+        ASSERT_EQ(buffers.size(), paths.size());
+        ASSERT_TRUE(buffers[0]);
+        EXPECT_EQ(buffers[0]->view(), "The more I read, the more I acquire, the more certain I am that I know nothing.");
+        EXPECT_FALSE(buffers[1]);
+        EXPECT_FALSE(buffers[2]);
+        ASSERT_TRUE(buffers[3]);
+        EXPECT_TRUE(buffers[3]->view().empty());
+    }
+
+    /**
+    * buffers outlive the reader that filled them
+    */
+    std::vector<ReadBufferPtr> buffers;
+    reader->read({paths[0]}, buffers);
+    reader.reset();
+    ASSERT_TRUE(buffers[0]);
+    EXPECT_EQ(buffers[0]->view().size(), 79);
+    std::filesystem::remove_all(root);
 }
\ No newline at end of file
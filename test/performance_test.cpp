@@ -1,7 +1,10 @@
 #include "../src/client/client.h"
 #include "../src/server/server.h"
+#include "../src/engine/shard.h"
 #include "timer.h"
 #include <gtest/gtest.h>
+#include <numeric>
+#include <random>
 #include <thread>
 
 
@@ -18,7 +21,9 @@ TEST(Anechka, Performance)
     std::thread clientThread = std::thread([&path] {
         auto clientPtr = std::make_unique<anechka::ClientStub>();
         utils::Timer dirIndexingTimer{};
-        clientPtr->RequestRecursiveDirIndexing(path);
+        auto indexing = clientPtr->RequestRecursiveDirIndexing(path);
+        EXPECT_TRUE(indexing->getOk());
+        clientPtr->AwaitJob(indexing->getJobid());
         size_t indexInterval = dirIndexingTimer.getInterval();
         std::cerr << "Indexing time: " << indexInterval << "ms" << std::endl;
 
@@ -39,3 +44,70 @@ TEST(Anechka, Performance)
 
     anechkaPtr->shutDown();
 }
+
+TEST(Anechka, SearchScaling)
+{
+    // queries take no lock and write no shared memory, so their throughput grows with the reader threads
+    const size_t docCount = 20000;
+    const size_t termCount = 1000;
+    core::Shard shard(0.75, termCount, docCount, core::SegmentPolicy{size_t{1} << 16, 10, 0.1});
+    std::vector<std::string> terms;
+    for (size_t i = 0; i < termCount; i++)
+    {
+        terms.push_back("term" + std::to_string(i));
+    }
+    std::mt19937 rng(42);
+    std::geometric_distribution<size_t> pick(0.01);
+    for (size_t d = 0; d < docCount; d++)
+    {
+        std::vector<core::TokenView> tokens;
+        for (size_t pos = 0; pos < 50; pos++)
+        {
+            tokens.emplace_back(terms[pick(rng) % termCount], pos);
+        }
+        shard.insertDocument("doc" + std::to_string(d) + ".txt", {tokens.size()}, tokens);
+        while (shard.needsMaintenance() && shard.maintain())
+        {
+        }
+    }
+
+    const core::ranking::Bm25 bm25{1.2f, 0.75f, 50.0f};
+    auto throughput = [&shard, &terms, &bm25](size_t threadCount) {
+        std::atomic<bool> isDone{false};
+        std::vector<size_t> counts(threadCount);
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < threadCount; t++)
+        {
+            threads.emplace_back([&shard, &terms, &bm25, &isDone, &counts, t] {
+                size_t count = 0;
+                bool exists;
+                for (size_t i = t; !isDone; i++)
+                {
+                    const std::string& first = terms[i % 100];
+                    const std::string& second = terms[(i * 7 + 3) % 100];
+                    shard.search(first, exists)->page(std::nullopt, 20, false);
+                    shard.topDocs({first, second}, {1.0f, 1.5f}, bm25, {});
+                    count++;
+                }
+                counts[t] = count;
+            });
+        }
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+        isDone = true;
+        for (auto& thread: threads)
+        {
+            thread.join();
+        }
+        // every round runs two queries over one second
+        return std::accumulate(counts.begin(), counts.end(), size_t{0}) * 2;
+    };
+
+    const size_t cores = std::max(1u, std::thread::hardware_concurrency());
+    const size_t single = throughput(1);
+    std::cerr << "Search throughput with 1 thread: " << single << " queries/s" << std::endl;
+    for (size_t threadCount = 2; threadCount <= cores; threadCount *= 2)
+    {
+        const size_t total = throughput(threadCount);
+        std::cerr << "Search throughput with " << threadCount << " threads: " << total << " queries/s" << std::endl;
+    }
+}
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include "../src/engine/query.h"
+#include <random>
+
+using core::query::Node;
+
+TEST(QueryTest, Parse)
+{
+    core::query::Query query = core::query::parse("Apple banana", true);
+    EXPECT_TRUE(query.isBagOfWords);
+    EXPECT_EQ(query.tokens, (std::vector<std::string>{"apple", "banana"}));
+    EXPECT_EQ(query.root.type, Node::Type::Or);
+    EXPECT_EQ(query.root.children.size(), 2);
+
+    // NOT binds tightest, then AND, explicit or implied, then OR
+    query = core::query::parse("a b OR NOT c AND \"d e\"~3", false);
+    EXPECT_FALSE(query.isBagOfWords);
+    EXPECT_EQ(query.tokens, (std::vector<std::string>{"a", "b", "c", "d", "e"}));
+    const Node& root = query.root;
+    ASSERT_EQ(root.type, Node::Type::Or);
+    ASSERT_EQ(root.children.size(), 2);
+    EXPECT_EQ(root.children[0].type, Node::Type::And);
+    EXPECT_EQ(root.children[0].children.size(), 2);
+    const Node& right = root.children[1];
+    ASSERT_EQ(right.type, Node::Type::And);
+    ASSERT_EQ(right.children.size(), 2);
+    EXPECT_EQ(right.children[0].type, Node::Type::Not);
+    const Node& phrase = right.children[1];
+    EXPECT_EQ(phrase.type, Node::Type::Phrase);
+    EXPECT_EQ(phrase.begin, 3);
+    EXPECT_EQ(phrase.end, 5);
+    EXPECT_EQ(phrase.slop, 3);
+
+    // operators are upper case, lowercasing applies to operands only
+    query = core::query::parse("a and b", true);
+    EXPECT_TRUE(query.isBagOfWords);
+    EXPECT_EQ(query.tokens.size(), 3);
+    query = core::query::parse("A AND B", true);
+    EXPECT_EQ(query.tokens, (std::vector<std::string>{"a", "b"}));
+    EXPECT_EQ(query.root.type, Node::Type::And);
+
+    // dangling operators and parentheses are dropped
+    query = core::query::parse("(a OR AND b NOT", false);
+    ASSERT_EQ(query.root.type, Node::Type::Or);
+    EXPECT_EQ(query.root.children.size(), 2);
+    query = core::query::parse("a ) b", false);
+    EXPECT_EQ(query.root.type, Node::Type::And);
+    EXPECT_EQ(query.root.children.size(), 2);
+
+    EXPECT_EQ(core::query::requiredTokens(core::query::parse("a (b OR c) \"d e\" NOT f", false)),
+              (std::vector<size_t>{0, 3, 4}));
+}
+
+TEST(QueryTest, SetOperations)
+{
+    /**
+    * every strategy of the set operations has to agree with the standard algorithms
+    */
+    std::mt19937 gen(7);
+    auto sample = [&gen](size_t size, core::DocId range) {
+        std::uniform_int_distribution<core::DocId> dist(0, range);
+        std::vector<core::DocId> ids;
+        for (size_t i = 0; i < size; i++)
+        {
+            ids.push_back(dist(gen));
+        }
+        std::sort(ids.begin(), ids.end());
+        ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+        return ids;
+    };
+
+    const std::vector<std::pair<size_t, size_t>> sizes = {{0, 10}, {3, 5}, {100, 120}, {1000, 1000}, {7, 5000},
+                                                          {50, 20000}, {4000, 4}};
+    for (const auto& [firstSize, secondSize]: sizes)
+    {
+        const auto first = sample(firstSize, 30000);
+        const auto second = sample(secondSize, 30000);
+
+        std::vector<core::DocId> expected;
+        std::set_intersection(first.begin(), first.end(), second.begin(), second.end(),
+                              std::back_inserter(expected));
+        std::vector<core::DocId> out;
+        core::query::intersect(first.data(), first.size(), second.data(), second.size(), out);
+        EXPECT_EQ(out, expected) << firstSize << " " << secondSize;
+
+        expected.clear();
+        std::set_union(first.begin(), first.end(), second.begin(), second.end(), std::back_inserter(expected));
+        out.clear();
+        core::query::unite(first.data(), first.size(), second.data(), second.size(), out);
+        EXPECT_EQ(out, expected);
+
+        expected.clear();
+        std::set_difference(first.begin(), first.end(), second.begin(), second.end(),
+                            std::back_inserter(expected));
+        out.clear();
+        core::query::subtract(first.data(), first.size(), second.data(), second.size(), out);
+        EXPECT_EQ(out, expected);
+    }
+
+    // dense inputs put every match into the vectorized loop
+    std::vector<core::DocId> evens;
+    std::vector<core::DocId> odds;
+    std::vector<core::DocId> all;
+    for (core::DocId id = 0; id < 1000; id++)
+    {
+        all.push_back(id);
+        (id % 2 == 0 ? evens : odds).push_back(id);
+    }
+    std::vector<core::DocId> out;
+    core::query::intersect(all.data(), all.size(), evens.data(), evens.size(), out);
+    EXPECT_EQ(out, evens);
+    out.clear();
+    core::query::intersect(all.data(), all.size(), all.data(), all.size(), out);
+    EXPECT_EQ(out, all);
+    out.clear();
+    core::query::subtract(all.data(), all.size(), evens.data(), evens.size(), out);
+    EXPECT_EQ(out, odds);
+    out.clear();
+    core::query::subtract(all.data(), all.size(), all.data(), all.size(), out);
+    EXPECT_TRUE(out.empty());
+    out.clear();
+    core::query::unite(evens.data(), evens.size(), odds.data(), odds.size(), out);
+    EXPECT_EQ(out, all);
+}
+
+TEST(QueryTest, Wildcards)
+{
+    auto expand = [](const std::string& pattern) {
+        return pattern == "ap*" ? std::vector<std::string>{"apple", "apply"} : std::vector<std::string>{};
+    };
+
+    // a bag of words stays one, expansions join its tokens
+    core::query::Query query = core::query::parse("Ap* pie", true, expand);
+    EXPECT_TRUE(query.isBagOfWords);
+    EXPECT_EQ(query.tokens, (std::vector<std::string>{"apple", "apply", "pie"}));
+    EXPECT_EQ(query.root.children.size(), 3);
+
+    query = core::query::parse("ap* AND pie", false, expand);
+    ASSERT_EQ(query.root.type, Node::Type::And);
+    ASSERT_EQ(query.root.children.size(), 2);
+    EXPECT_EQ(query.root.children[0].type, Node::Type::Or);
+    EXPECT_EQ(query.root.children[0].children.size(), 2);
+
+    // patterns without matches are kept as tokens matching nothing, quoted ones are not expanded
+    query = core::query::parse("kiwi* AND pie", false, expand);
+    EXPECT_EQ(query.tokens, (std::vector<std::string>{"kiwi*", "pie"}));
+    EXPECT_EQ(query.root.children[0].type, Node::Type::Term);
+    query = core::query::parse("\"ap* pie\"", false, expand);
+    EXPECT_EQ(query.tokens, (std::vector<std::string>{"ap", "pie"}));
+
+    // without an expander wildcards separate tokens
+    EXPECT_EQ(core::query::parse("ap* pie", false).tokens, (std::vector<std::string>{"ap", "pie"}));
+
+    std::vector<std::pair<std::string, size_t>> lookups;
+    auto fuzzyExpand = [&lookups](const std::string& token, size_t maxEdits) {
+        lookups.emplace_back(token, maxEdits);
+        return token == "aple" ? std::vector<std::string>{"apple", "maple"} : std::vector<std::string>{};
+    };
+    query = core::query::parse("Aple~1 AND pie~ NOT cake~x", true, nullptr, fuzzyExpand);
+    EXPECT_EQ(lookups, (std::vector<std::pair<std::string, size_t>>{{"aple", 1}, {"pie", 2}}));
+    EXPECT_EQ(query.tokens, (std::vector<std::string>{"apple", "maple", "pie~", "cake", "x"}));
+    ASSERT_EQ(query.root.type, Node::Type::And);
+    EXPECT_EQ(query.root.children[0].type, Node::Type::Or);
+}
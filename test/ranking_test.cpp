@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+#include "../src/engine/ranking.h"
+
+TEST(RankingTest, BlockMaxWand)
+{
+    /**
+    * pruned evaluation has to yield the exhaustive top list
+    */
+    static constexpr core::DocId DocCount = 2000;
+    core::DocTrace docTrace(DocCount);
+    std::vector<std::vector<core::Posting>> postings(3);
+    for (core::DocId docId = 0; docId < DocCount; docId++)
+    {
+        bool isNew;
+        docTrace.addOrGet(std::to_string(docId), core::DocStat{10 + docId * 7 % 50}, isNew);
+        for (size_t t = 0; t < postings.size(); t++)
+        {
+            if ((docId + t) % (t * 3 + 1) == 0)
+            {
+                for (size_t pos = 0; pos < 1 + (docId * 31 + t) % 4; pos++)
+                {
+                    postings[t].emplace_back(docId, pos);
+                }
+            }
+        }
+    }
+    docTrace.remove("7");
+
+    core::Segment::Builder builder(&docTrace);
+    const std::vector<std::string> terms{"a", "b", "c"};
+    for (size_t t = 0; t < terms.size(); t++)
+    {
+        builder.add(terms[t], postings[t]);
+    }
+    const core::SegmentPtr segment = builder.build();
+
+    const core::ranking::Bm25 bm25{1.2f, 0.75f, 35.0f};
+    const std::vector<float> idfs{0.2f, 1.5f, 2.5f};
+    std::vector<core::ranking::TermCursor> cursors;
+    for (size_t t = 0; t < terms.size(); t++)
+    {
+        uint32_t termIdx;
+        ASSERT_TRUE(segment->find(terms[t], termIdx));
+        core::Segment::Cursor cursor(*segment, termIdx);
+        cursors.push_back({cursor, idfs[t], bm25.bound(idfs[t], cursor.termMax())});
+    }
+    core::ranking::TopDocs pruned(10);
+    core::ranking::blockMaxWand(cursors, bm25, docTrace, pruned);
+
+    std::vector<float> scores(DocCount, 0.0f);
+    for (size_t t = 0; t < terms.size(); t++)
+    {
+        uint32_t termIdx;
+        segment->find(terms[t], termIdx);
+        segment->forEachDoc(termIdx, [&](core::DocId docId, size_t termFreq) {
+            scores[docId] += bm25.score(idfs[t], termFreq, docTrace.getTokenCount(docId));
+        });
+    }
+    core::ranking::TopDocs exhaustive(10);
+    for (core::DocId docId = 0; docId < DocCount; docId++)
+    {
+        if (scores[docId] > 0 && docTrace.isAlive(docId))
+        {
+            exhaustive.push(docId, scores[docId]);
+        }
+    }
+
+    const auto expected = exhaustive.sorted();
+    const auto actual = pruned.sorted();
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_EQ(actual[i].first, expected[i].first);
+        EXPECT_FLOAT_EQ(actual[i].second, expected[i].second);
+    }
+}
+
+TEST(RankingTest, TopDocs)
+{
+    core::ranking::TopDocs top(3);
+    EXPECT_EQ(top.threshold(), -std::numeric_limits<float>::infinity());
+    top.push(4, 1.0f);
+    top.push(2, 3.0f);
+    top.push(9, 2.0f);
+    EXPECT_EQ(top.threshold(), 1.0f);
+    top.push(7, 0.5f);
+    top.push(8, 2.0f);
+    top.push(1, 2.0f);
+    EXPECT_EQ(top.sorted(), (core::ranking::ScoredDocs{{2, 3.0f}, {1, 2.0f}, {8, 2.0f}}));
+
+    // the next page starts right after the last document of the previous one
+    core::ranking::ScoredDoc last;
+    ASSERT_TRUE(core::ranking::decodeCursor(core::ranking::encodeCursor({8, 2.0f}), last));
+    core::ranking::TopDocs next(3, last);
+    for (auto&& [docId, score]: core::ranking::ScoredDocs{{4, 1.0f}, {2, 3.0f}, {9, 2.0f}, {7, 0.5f}, {8, 2.0f},
+                                                          {1, 2.0f}})
+    {
+        next.push(docId, score);
+    }
+    EXPECT_EQ(next.sorted(), (core::ranking::ScoredDocs{{9, 2.0f}, {4, 1.0f}, {7, 0.5f}}));
+    EXPECT_FALSE(core::ranking::decodeCursor("3f800000", last));
+    EXPECT_FALSE(core::ranking::decodeCursor("3f800000.1x", last));
+}
+
+TEST(RankingTest, Accumulator)
+{
+    std::vector<std::pair<size_t, float>> scores;
+    {
+        core::ranking::Accumulator::Lease accumulator;
+        accumulator->add(5, 1.0f);
+        accumulator->add(0, 2.0f);
+        accumulator->add(5, 0.5f);
+        accumulator->forEach([&scores](size_t slot, float score) {
+            scores.emplace_back(slot, score);
+        });
+    }
+    EXPECT_EQ(scores, (std::vector<std::pair<size_t, float>>{{5, 1.5f}, {0, 2.0f}}));
+
+    /**
+    * the released accumulator is reused cleared, a nested lease gets one of its own
+    */
+    core::ranking::Accumulator::Lease reused;
+    core::ranking::Accumulator::Lease nested;
+    EXPECT_NE(&*reused, &*nested);
+    size_t touched = 0;
+    reused->forEach([&touched](size_t, float) {
+        touched++;
+    });
+    EXPECT_EQ(touched, 0);
+    reused->add(5, 1.0f);
+    nested->add(5, 2.0f);
+    reused->forEach([](size_t, float score) {
+        EXPECT_EQ(score, 1.0f);
+    });
+}
+
+TEST(RankingTest, PhraseFreq)
+{
+    auto positions = [](std::initializer_list<size_t> ordinals) {
+        std::vector<size_t> res;
+        for (size_t ordinal: ordinals)
+        {
+            res.push_back(core::position::pack(ordinal * 4, ordinal));
+        }
+        return res;
+    };
+    const std::vector<size_t> first = positions({0, 5, 9});
+    const std::vector<size_t> second = positions({1, 7, 10});
+    auto freq = [](const std::vector<std::vector<size_t>>& terms, size_t slop) {
+        std::vector<core::ranking::PositionRange> ranges;
+        for (const auto& term: terms)
+        {
+            ranges.emplace_back(term.data(), term.data() + term.size());
+        }
+        return core::ranking::phraseFreq(ranges, slop);
+    };
+
+    EXPECT_EQ(freq({first, second}, 0), 2);
+    EXPECT_EQ(freq({first, second}, 1), 3);
+    EXPECT_EQ(freq({second, first}, 0), 0);
+    EXPECT_EQ(freq({second, first}, 3), 2);
+    EXPECT_EQ(freq({first}, 0), 3);
+
+    // a repeated term has to occur at consecutive positions
+    const std::vector<size_t> repeated = positions({3, 4, 5, 8});
+    EXPECT_EQ(freq({repeated, repeated}, 0), 2);
+    EXPECT_EQ(freq({repeated, repeated, repeated}, 0), 1);
+}
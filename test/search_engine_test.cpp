@@ -1,5 +1,77 @@
 #include <gtest/gtest.h>
 #include "../src/engine/engine.h"
+#include "../src/engine/routing.h"
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <thread>
+
+/**
+* a directory of text files under the temp directory, removed along with its files once the test is over
+*/
+class TempCorpus
+{
+public:
+    explicit TempCorpus(const std::string& name)
+        : m_root(std::filesystem::temp_directory_path() / ("anechka_" + name + "_test"))
+    {
+        std::filesystem::remove_all(m_root);
+        std::filesystem::create_directories(m_root);
+    }
+
+    ~TempCorpus()
+    {
+        std::error_code err;
+        std::filesystem::remove_all(m_root, err);
+    }
+
+    TempCorpus(const TempCorpus& other) = delete;
+    TempCorpus& operator=(const TempCorpus& other) = delete;
+
+    const std::filesystem::path& root() const
+    {
+        return m_root;
+    }
+
+    std::string path(const std::filesystem::path& name) const
+    {
+        return (m_root / name).string();
+    }
+
+    /**
+    * writes text to the file at name, relative to the root, and returns its path
+    */
+    std::string write(const std::filesystem::path& name, const std::string& text) const
+    {
+        const std::filesystem::path path = m_root / name;
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream f(path);
+        f << text;
+        return path.string();
+    }
+
+    /**
+    * writes texts[i] to i.txt and indexes it with every engine, false once any of them fails
+    */
+    bool index(const std::vector<std::string>& texts, const std::vector<core::SearchEngine*>& engines) const
+    {
+        for (size_t i = 0; i < texts.size(); i++)
+        {
+            const std::string path = write(std::to_string(i) + ".txt", texts[i]);
+            for (core::SearchEngine* engine: engines)
+            {
+                if (!engine->indexTxtFile(std::string{path}))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+private:
+    const std::filesystem::path m_root;
+};
 
 TEST(SearchEngineTest, Basic)
 {
@@ -41,3 +113,630 @@ TEST(SearchEngineTest, Basic)
     // I don't compare contents here because tokens may be in a different order in the dumps
     EXPECT_EQ(engine->serialize().dump().size(), restoredEngine->serialize().dump().size());
 }
+
+TEST(SearchEngineTest, DocumentReindex)
+{
+    const TempCorpus corpus("reindex");
+    const std::filesystem::path path = corpus.write("reindex.txt", "old news");
+
+    auto engine = std::make_unique<core::SearchEngine>(core::SearchEngineParams{25, 1, 8, 0.75, true});
+    ASSERT_TRUE(engine->indexTxtFile(path.string()));
+    EXPECT_EQ(engine->docCount(), 1);
+    EXPECT_EQ(engine->searchQuery("news").size(), 1);
+
+    corpus.write("reindex.txt", "fresh content");
+    std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + std::chrono::seconds(1));
+
+    // re-indexing a modified file retires the previous version
+    ASSERT_TRUE(engine->indexTxtFile(path.string()));
+    EXPECT_EQ(engine->docCount(), 1);
+    EXPECT_TRUE(engine->searchQuery("news").empty());
+    EXPECT_EQ(engine->searchQuery("fresh").size(), 1);
+
+    EXPECT_TRUE(engine->deleteDocument(path.string()));
+    EXPECT_FALSE(engine->deleteDocument(path.string()));
+    EXPECT_EQ(engine->docCount(), 0);
+    EXPECT_TRUE(engine->searchQuery("fresh").empty());
+
+    ASSERT_TRUE(engine->reindexDocument(path.string()));
+    auto ranked = engine->searchQuery("fresh");
+    ASSERT_EQ(ranked.size(), 1);
+    EXPECT_EQ(ranked.front().first, path.string());
+}
+
+TEST(SearchEngineTest, Shards)
+{
+    const TempCorpus corpus("shard");
+
+    core::SearchEngineParams params{25, 10, 4, 0.75, true};
+    auto single = std::make_unique<core::SearchEngine>(params);
+    params.shards = 4;
+    auto sharded = std::make_unique<core::SearchEngine>(params);
+
+    const std::vector<std::string> texts = {"red apple", "green apple pie", "red wine", "apple juice and red grapes",
+                                            "pie crust", "grape juice"};
+    ASSERT_TRUE(corpus.index(texts, {single.get(), sharded.get()}));
+    EXPECT_EQ(sharded->docCount(), texts.size());
+
+    bool found;
+    EXPECT_EQ(sharded->search("apple", found)->size(), 3);
+    EXPECT_TRUE(found);
+
+    // idf is computed over the whole corpus, so partitioning does not change the ranking
+    for (const std::string query: {"apple", "red apple", "juice pie"})
+    {
+        std::map<std::string, float> expected;
+        for (auto&& [path, rank]: single->searchQuery(query))
+        {
+            expected[path] = rank;
+        }
+        std::map<std::string, float> actual;
+        for (auto&& [path, rank]: sharded->searchQuery(query))
+        {
+            actual[path] = rank;
+        }
+        ASSERT_EQ(expected.size(), actual.size());
+        for (auto&& [path, rank]: expected)
+        {
+            EXPECT_FLOAT_EQ(actual[path], rank);
+        }
+    }
+
+    const std::string deleted = corpus.path("0.txt");
+    EXPECT_TRUE(sharded->deleteDocument(deleted));
+    EXPECT_EQ(sharded->search("apple", found)->size(), 2);
+    EXPECT_EQ(sharded->docCount(), texts.size() - 1);
+}
+
+TEST(SearchEngineTest, Routing)
+{
+    // backends and their shards hash paths with different seeds, so every shard of every backend gets documents
+    for (size_t backends: {2, 3, 4})
+    {
+        for (size_t shards: {2, 4, 6, 8})
+        {
+            std::vector<std::vector<size_t>> counts(backends, std::vector<size_t>(shards));
+            for (size_t i = 0; i < 4000; i++)
+            {
+                const std::string path = "/corpus/doc" + std::to_string(i) + ".txt";
+                counts[core::routing::backend(path, backends)][core::routing::shard(path, shards)]++;
+            }
+            for (size_t b = 0; b < backends; b++)
+            {
+                for (size_t s = 0; s < shards; s++)
+                {
+                    EXPECT_GT(counts[b][s], 0) << backends << " backends, " << shards << " shards";
+                }
+            }
+        }
+    }
+}
+
+TEST(SearchEngineTest, Replication)
+{
+    const TempCorpus corpus("replication");
+    const std::string first = corpus.write("first.txt", "red apple");
+    const std::string second = corpus.write("second.txt", "green apple pie");
+
+    core::SearchEngineParams params{25, 10, 4, 0.75, true};
+    auto replica = std::make_unique<core::SearchEngine>(params);
+    params.replicationLogBytes = 1 << 20;
+    params.shards = 2;
+    auto primary = std::make_unique<core::SearchEngine>(params);
+    EXPECT_FALSE(replica->isLogging());
+    EXPECT_TRUE(primary->isLogging());
+
+    ASSERT_TRUE(primary->indexTxtFile(std::string{first}));
+    const uint64_t seq = primary->replicationSeq();
+    EXPECT_EQ(seq, 1);
+    ASSERT_TRUE(replica->sync(primary->snapshot()));
+    EXPECT_EQ(replica->docCount(), 1);
+
+    ASSERT_TRUE(primary->indexTxtFile(std::string{second}));
+    EXPECT_TRUE(primary->deleteDocument(first));
+    primary->erase("pie");
+
+    bool truncated;
+    const auto mutations = primary->mutationsSince(seq, 100, truncated);
+    EXPECT_FALSE(truncated);
+    ASSERT_EQ(mutations.size(), 3);
+    EXPECT_EQ(primary->replicationSeq(), seq + 3);
+
+    // mutations are idempotent, replaying them after a snapshot that already covers some is harmless
+    for (size_t i = 0; i < 2; i++)
+    {
+        for (const auto& mutation: mutations)
+        {
+            EXPECT_TRUE(replica->applyMutation(mutation));
+        }
+    }
+    EXPECT_FALSE(replica->applyMutation("{\"op\": \"unknown\"}"));
+
+    bool found;
+    EXPECT_EQ(replica->docCount(), 1);
+    EXPECT_EQ(replica->search("apple", found)->size(), 1);
+    EXPECT_FALSE(replica->search("red", found)->size());
+    replica->search("pie", found);
+    EXPECT_FALSE(found);
+    EXPECT_EQ(replica->searchQuery("green apple"), primary->searchQuery("green apple"));
+
+    // the snapshot replaces whatever the replica holds
+    replica->indexTxtFile(std::string{first});
+    ASSERT_TRUE(replica->sync(primary->snapshot()));
+    EXPECT_EQ(replica->docCount(), 1);
+    EXPECT_EQ(replica->serialize(), primary->serialize());
+
+    // mutations carry the text of a document rather than its tokens, bytes that are not UTF-8 included
+    const std::string latin = corpus.write("latin.txt", "Caf\xe9 au LAIT");
+    ASSERT_TRUE(primary->indexTxtFile(std::string{latin}));
+    const auto latest = primary->mutationsSince(primary->replicationSeq() - 1, 1, truncated);
+    ASSERT_EQ(latest.size(), 1);
+    EXPECT_TRUE(Json::parse(latest[0]).contains("bytes"));
+    ASSERT_TRUE(replica->applyMutation(latest[0]));
+    EXPECT_EQ(replica->serialize(), primary->serialize());
+
+    // the log keeps the most recent mutations within its capacity
+    core::ReplicationLog log(8);
+    log.append("aaaa");
+    log.append("bbbb");
+    log.append("cccc");
+    EXPECT_EQ(log.lastSeq(), 3);
+    log.since(0, 10, truncated);
+    EXPECT_TRUE(truncated);
+    EXPECT_EQ(log.since(1, 10, truncated), (std::vector<std::string>{"bbbb", "cccc"}));
+    EXPECT_FALSE(truncated);
+    EXPECT_EQ(log.since(2, 1, truncated), (std::vector<std::string>{"cccc"}));
+    EXPECT_TRUE(log.since(3, 10, truncated).empty());
+    EXPECT_FALSE(truncated);
+}
+
+TEST(SearchEngineTest, Bm25)
+{
+    const TempCorpus corpus("bm25");
+
+    core::SearchEngineParams params{25, 10, 4, 0.75, true};
+    params.shards = 2;
+    auto engine = std::make_unique<core::SearchEngine>(params);
+
+    const std::vector<std::string> texts = {"apple pie", "apple apple apple pie", "banana split",
+                                            "apple banana cherry grape lemon lime mango melon"};
+    ASSERT_TRUE(corpus.index(texts, {engine.get()}));
+
+    const core::ranking::QueryStats stats = engine->queryStats("Apple kiwi");
+    EXPECT_EQ(stats.tokens, (std::vector<std::string>{"apple", "kiwi"}));
+    EXPECT_EQ(stats.docFreqs, (std::vector<size_t>{3, 0}));
+    EXPECT_EQ(stats.docCount, 4);
+    EXPECT_EQ(stats.totalTokens, 16);
+
+    // term frequency saturates, shorter documents win among equal frequencies
+    auto ranked = engine->searchQuery("apple");
+    ASSERT_EQ(ranked.size(), 3);
+    EXPECT_EQ(ranked[0].first, corpus.path("1.txt"));
+    EXPECT_EQ(ranked[1].first, corpus.path("0.txt"));
+    EXPECT_EQ(ranked[2].first, corpus.path("3.txt"));
+    EXPECT_LT(ranked[0].second, 3 * ranked[1].second);
+
+    // idf stays positive for terms most documents contain
+    EXPECT_GT(ranked[2].second, 0.0f);
+
+    // deleted documents count as long as their postings do, document frequencies never exceed docCount
+    EXPECT_TRUE(engine->deleteDocument(corpus.path("1.txt")));
+    const core::ranking::QueryStats deleted = engine->queryStats("pie");
+    EXPECT_EQ(deleted.docFreqs, (std::vector<size_t>{2}));
+    EXPECT_EQ(deleted.docCount, 4);
+    EXPECT_EQ(deleted.totalTokens, 16);
+    ranked = engine->searchQuery("pie");
+    ASSERT_EQ(ranked.size(), 1);
+    EXPECT_EQ(ranked[0].first, corpus.path("0.txt"));
+    EXPECT_GT(ranked[0].second, 0.0f);
+
+    // a token held by deleted documents only is not found
+    bool found = false;
+    EXPECT_TRUE(engine->deleteDocument(corpus.path("2.txt")));
+    EXPECT_EQ(engine->search("split", found)->serialize(), Json(nullptr));
+    EXPECT_FALSE(found);
+    EXPECT_TRUE(engine->search("banana", found)->serialize().is_array());
+    EXPECT_TRUE(found);
+}
+
+TEST(SearchEngineTest, Pagination)
+{
+    const TempCorpus corpus("pagination");
+
+    core::SearchEngineParams params{25, 10, 4, 0.75, true};
+    params.shards = 3;
+    auto engine = std::make_unique<core::SearchEngine>(params);
+    std::vector<std::string> texts;
+    for (size_t i = 0; i < 12; i++)
+    {
+        texts.push_back("apple" + std::string(i % 4, ' ') + " filler" + (i % 3 ? " apple" : ""));
+    }
+    ASSERT_TRUE(corpus.index(texts, {engine.get()}));
+
+    core::ranking::Page page;
+    page.limit = 100;
+    std::vector<std::string> cursors;
+    const core::ranking::RankedDocs all = engine->searchQuery("apple", page, cursors);
+    ASSERT_EQ(all.size(), 12);
+    ASSERT_EQ(cursors.size(), all.size());
+
+    // ties are broken by document, so pages neither repeat nor skip documents
+    core::ranking::RankedDocs paged;
+    page.limit = 5;
+    for (;;)
+    {
+        auto ranked = engine->searchQuery("apple", page, cursors);
+        if (ranked.empty())
+        {
+            break;
+        }
+        ASSERT_EQ(cursors.size(), ranked.size());
+        paged.insert(paged.end(), ranked.begin(), ranked.end());
+        core::ranking::ScoredDoc after;
+        ASSERT_TRUE(core::ranking::decodeCursor(cursors.back(), after));
+        page.after = after;
+    }
+    EXPECT_EQ(paged, all);
+}
+
+TEST(SearchEngineTest, Phrases)
+{
+    const TempCorpus corpus("phrase");
+
+    core::SearchEngineParams params{25, 10, 4, 0.75, true};
+    params.shards = 2;
+    params.segmentBufferPostings = 8;
+    auto engine = std::make_unique<core::SearchEngine>(params);
+
+    const std::vector<std::string> texts = {"Not my cup of tea at all", "my cup of coffee is not tea",
+                                            "tea, cup of mine", "a cup of strong tea", "tea tea tea"};
+    ASSERT_TRUE(corpus.index(texts, {engine.get()}));
+
+    auto matches = [&engine](const std::string& query) {
+        std::vector<std::string> docs;
+        for (auto&& [path, rank]: engine->searchQuery(query))
+        {
+            EXPECT_GT(rank, 0.0f);
+            docs.push_back(std::filesystem::path(path).stem().string());
+        }
+        std::sort(docs.begin(), docs.end());
+        return docs;
+    };
+    using Docs = std::vector<std::string>;
+
+    EXPECT_EQ(matches("\"not my cup of tea\""), Docs{"0"});
+    EXPECT_EQ(matches("\"cup of tea\""), Docs{"0"});
+    EXPECT_EQ(matches("\"tea cup\""), Docs{"2"});
+    EXPECT_EQ(matches("\"tea tea\""), Docs{"4"});
+    EXPECT_TRUE(matches("\"of of\"").empty());
+    EXPECT_TRUE(matches("\"cup of kiwi\"").empty());
+
+    // slop allows tokens in between, the order still matters
+    EXPECT_EQ(matches("\"cup tea\"~1"), Docs{"0"});
+    EXPECT_EQ(matches("\"cup tea\"~2"), (Docs{"0", "3"}));
+    EXPECT_EQ(matches("\"tea cup\"~5"), Docs{"2"});
+
+    // tokens outside of quotes are required along with the phrase
+    EXPECT_EQ(matches("\"cup of\" not"), (Docs{"0", "1"}));
+    EXPECT_EQ(matches("\"cup of\" tea"), (Docs{"0", "1", "2", "3"}));
+    EXPECT_EQ(matches("cup of tea").size(), 5);
+}
+
+TEST(SearchEngineTest, Boolean)
+{
+    const TempCorpus corpus("boolean");
+
+    core::SearchEngineParams params{25, 10, 4, 0.75, true};
+    params.shards = 2;
+    params.segmentBufferPostings = 8;
+    auto engine = std::make_unique<core::SearchEngine>(params);
+
+    const std::vector<std::string> texts = {"apple banana cherry", "apple banana", "banana cherry",
+                                            "cherry pie with apple", "plain bread", "apple pie"};
+    ASSERT_TRUE(corpus.index(texts, {engine.get()}));
+
+    auto stems = [](const core::ranking::RankedDocs& ranked) {
+        std::vector<std::string> docs;
+        for (auto&& [path, rank]: ranked)
+        {
+            docs.push_back(std::filesystem::path(path).stem().string());
+        }
+        return docs;
+    };
+    auto matches = [&engine, &stems](const std::string& query) {
+        std::vector<std::string> docs = stems(engine->searchQuery(query));
+        std::sort(docs.begin(), docs.end());
+        return docs;
+    };
+    using Docs = std::vector<std::string>;
+
+    EXPECT_EQ(matches("apple AND banana"), (Docs{"0", "1"}));
+    EXPECT_EQ(matches("apple banana").size(), 5);
+    EXPECT_EQ(matches("apple OR bread"), (Docs{"0", "1", "3", "4", "5"}));
+    EXPECT_EQ(matches("apple NOT banana"), (Docs{"3", "5"}));
+    EXPECT_EQ(matches("NOT apple"), (Docs{"2", "4"}));
+    EXPECT_EQ(matches("(apple OR cherry) AND NOT (banana OR pie)"), Docs{});
+    EXPECT_EQ(matches("(apple OR cherry) NOT banana"), (Docs{"3", "5"}));
+    EXPECT_EQ(matches("cherry AND (\"apple pie\" OR banana)"), (Docs{"0", "2"}));
+    EXPECT_EQ(matches("bread OR \"pie with\" NOT cherry"), Docs{"4"});
+    EXPECT_EQ(matches("kiwi OR bread"), Docs{"4"});
+    EXPECT_TRUE(matches("kiwi AND bread").empty());
+    EXPECT_TRUE(matches("()").empty());
+
+    // lenient parsing drops dangling operators and parentheses
+    EXPECT_EQ(matches("apple AND banana AND"), (Docs{"0", "1"}));
+    EXPECT_EQ(matches("(apple OR bread"), (Docs{"0", "1", "3", "4", "5"}));
+
+    // unranked matches score 0, come in a stable order and page like ranked ones
+    core::ranking::Page page;
+    page.limit = 100;
+    std::vector<std::string> cursors;
+    const core::ranking::RankedDocs all = engine->filterQuery("apple OR cherry", page, cursors);
+    ASSERT_EQ(all.size(), 5);
+    for (const auto& [path, rank]: all)
+    {
+        EXPECT_EQ(rank, 0.0f);
+    }
+
+    core::ranking::RankedDocs paged;
+    page.limit = 2;
+    for (;;)
+    {
+        auto filtered = engine->filterQuery("apple OR cherry", page, cursors);
+        if (filtered.empty())
+        {
+            break;
+        }
+        paged.insert(paged.end(), filtered.begin(), filtered.end());
+        core::ranking::ScoredDoc after;
+        ASSERT_TRUE(core::ranking::decodeCursor(cursors.back(), after));
+        page.after = after;
+    }
+    EXPECT_EQ(paged, all);
+}
+
+TEST(SearchEngineTest, Wildcards)
+{
+    const TempCorpus corpus("wildcard");
+
+    core::SearchEngineParams params{25, 10, 4, 0.75, true};
+    params.shards = 3;
+    params.segmentBufferPostings = 8;
+    params.maxExpansions = 2;
+    auto engine = std::make_unique<core::SearchEngine>(params);
+
+    const std::vector<std::string> texts = {"Apple pie", "application form", "apply now", "banana bread",
+                                            "band of bandits", "cat and bat"};
+    ASSERT_TRUE(corpus.index(texts, {engine.get()}));
+
+    using Terms = std::vector<std::string>;
+    bool truncated = true;
+    EXPECT_EQ(engine->expandTerms("APPL*", 10, truncated), (Terms{"apple", "application", "apply"}));
+    EXPECT_FALSE(truncated);
+    EXPECT_EQ(engine->expandTerms("appl*", 2, truncated), (Terms{"apple", "application"}));
+    EXPECT_TRUE(truncated);
+    EXPECT_EQ(engine->expandTerms("?at", 10, truncated), (Terms{"bat", "cat"}));
+    EXPECT_EQ(engine->termRange("band", "bat", 10, truncated), (Terms{"band", "bandits"}));
+    EXPECT_EQ(engine->docFreq("apple"), 1);
+
+    auto matches = [&engine](const std::string& query) {
+        std::vector<std::string> docs;
+        for (auto&& [path, rank]: engine->searchQuery(query))
+        {
+            docs.push_back(std::filesystem::path(path).stem().string());
+        }
+        std::sort(docs.begin(), docs.end());
+        return docs;
+    };
+    using Docs = std::vector<std::string>;
+
+    // expansions are capped by maxExpansions
+    EXPECT_EQ(matches("appl*"), (Docs{"0", "1"}));
+    EXPECT_EQ(matches("ban* AND bread"), Docs{"3"});
+    EXPECT_EQ(matches("band* NOT ?at"), Docs{"4"});
+    EXPECT_TRUE(matches("kiwi* AND bread").empty());
+
+    // misspellings expand to the closest tokens, the more frequent first
+    std::vector<core::TermMatch> fuzzy = engine->fuzzyTerms("Bandanna", 2, 10, truncated);
+    ASSERT_EQ(fuzzy.size(), 1);
+    EXPECT_EQ(fuzzy[0].term, "banana");
+    EXPECT_EQ(fuzzy[0].distance, 2);
+    fuzzy = engine->fuzzyTerms("bat", 2, 10, truncated);
+    ASSERT_EQ(fuzzy.size(), 3);
+    EXPECT_EQ(fuzzy[0].term, "bat");
+    EXPECT_EQ(fuzzy[0].distance, 0);
+    EXPECT_EQ(fuzzy[1].term, "cat");
+    EXPECT_EQ(fuzzy[2].term, "band");
+    EXPECT_FALSE(truncated);
+    EXPECT_EQ(engine->fuzzyTerms("bat", 2, 2, truncated).size(), 2);
+    EXPECT_TRUE(truncated);
+    EXPECT_EQ(matches("aple~1"), Docs{"0"});
+    EXPECT_EQ(matches("brad~ OR catt~1"), (Docs{"3", "4", "5"}));
+    EXPECT_TRUE(matches("aple").empty());
+
+    // erased tokens leave the dictionary
+    engine->erase("apple");
+    EXPECT_EQ(engine->expandTerms("appl*", 10, truncated), (Terms{"application", "apply"}));
+    EXPECT_TRUE(engine->deleteDocument(corpus.path("2.txt")));
+    engine->erase("apply");
+    EXPECT_EQ(engine->expandTerms("appl*", 10, truncated), Terms{"application"});
+}
+
+TEST(SearchEngineTest, IndexJobs)
+{
+    const TempCorpus corpus("job");
+    const std::filesystem::path& root = corpus.root();
+    uint64_t bytes = 0;
+    for (size_t i = 0; i < 40; i++)
+    {
+        const std::string text = "document number " + std::to_string(i) + " of the job";
+        corpus.write(std::filesystem::path(i % 2 ? "nested" : "") / (std::to_string(i) + ".txt"), text);
+        bytes += text.size();
+    }
+    corpus.write("skipped.md", "not indexed");
+    // a dangling link fails to be read
+    std::filesystem::create_symlink(root / "missing.txt", root / "nested" / "broken.txt");
+
+    core::SearchEngineParams params{25, 10, 4, 0.75, true};
+    params.maxInFlightFiles = 2;
+    auto engine = std::make_unique<core::SearchEngine>(params);
+
+    const auto waitFor = [&engine](uint64_t jobId) {
+        core::IndexJobStatus status{};
+        while (engine->jobStatus(jobId, status) &&
+               (status.state == core::JobState::Queued || status.state == core::JobState::Running ||
+                status.state == core::JobState::Cancelling))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return status;
+    };
+
+    uint64_t jobId = 0;
+    EXPECT_FALSE(engine->startIndexing(corpus.path("missing"), jobId));
+    ASSERT_TRUE(engine->startIndexing(root.string(), jobId));
+    EXPECT_GT(jobId, 0);
+
+    const core::IndexJobStatus status = waitFor(jobId);
+    EXPECT_EQ(status.id, jobId);
+    EXPECT_EQ(status.state, core::JobState::Done);
+    EXPECT_EQ(status.filesDiscovered, 41);
+    EXPECT_EQ(status.filesIndexed, 40);
+    EXPECT_EQ(status.filesFailed, 1);
+    EXPECT_EQ(status.bytesProcessed, bytes);
+    EXPECT_EQ(engine->docCount(), 40);
+
+    // every file passes through the stages of the pipeline in order
+    ASSERT_EQ(status.stages.size(), 4);
+    const std::vector<std::string> stages = {"crawl", "read", "tokenize", "merge"};
+    const std::vector<size_t> processed = {41, 41, 40, 40};
+    for (size_t i = 0; i < stages.size(); i++)
+    {
+        EXPECT_EQ(status.stages[i].name, stages[i]);
+        EXPECT_EQ(status.stages[i].processed, processed[i]);
+        EXPECT_EQ(status.stages[i].queued, 0);
+        EXPECT_LE(status.stages[i].peakQueued, status.stages[i].capacity);
+    }
+    EXPECT_EQ(status.stages[1].capacity, 2);
+    EXPECT_EQ(status.stages[3].workers, params.shards);
+    EXPECT_EQ(engine->docFreq("document"), 40);
+
+    // a cancelled job does not index anything it has not started yet
+    engine->deleteDocument(corpus.path("0.txt"));
+    uint64_t cancelledId = 0;
+    ASSERT_TRUE(engine->startIndexing(root.string(), cancelledId));
+    EXPECT_NE(cancelledId, jobId);
+    core::IndexJobStatus cancelled{};
+    ASSERT_TRUE(engine->cancelJob(cancelledId, cancelled));
+    cancelled = waitFor(cancelledId);
+    EXPECT_EQ(cancelled.state, core::JobState::Cancelled);
+    EXPECT_LE(cancelled.filesIndexed + cancelled.filesFailed, cancelled.filesDiscovered);
+
+    core::IndexJobStatus unknown{};
+    EXPECT_FALSE(engine->jobStatus(cancelledId + 1, unknown));
+    EXPECT_FALSE(engine->cancelJob(cancelledId + 1, unknown));
+
+    // cancelling a job that is over changes nothing
+    core::IndexJobStatus done{};
+    ASSERT_TRUE(engine->cancelJob(jobId, done));
+    EXPECT_EQ(done.state, core::JobState::Done);
+
+    // jobs run one at a time, a later one stays queued until the earlier one is over
+    uint64_t firstId = 0;
+    uint64_t secondId = 0;
+    ASSERT_TRUE(engine->startIndexing(root.string(), firstId));
+    ASSERT_TRUE(engine->startIndexing(root.string(), secondId));
+    core::IndexJobStatus first{};
+    core::IndexJobStatus second{};
+    do
+    {
+        ASSERT_TRUE(engine->jobStatus(secondId, second));
+        ASSERT_TRUE(engine->jobStatus(firstId, first));
+        if (second.state != core::JobState::Queued)
+        {
+            EXPECT_EQ(first.state, core::JobState::Done);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    } while (second.state != core::JobState::Done);
+
+    // indexDir waits for its job to finish
+    EXPECT_TRUE(engine->indexDir(root.string()));
+    EXPECT_EQ(engine->docCount(), 40);
+}
+
+TEST(SearchEngineTest, StreamedDocuments)
+{
+    /**
+    * a document streamed a window at a time is indexed the same as one tokenized whole
+    */
+    const TempCorpus corpus("streamed");
+    std::string text;
+    for (size_t i = 0; text.size() < 3 * core::TokenStream::WindowSize / 2; i++)
+    {
+        text += "Line " + std::to_string(i) + ": not my cup of tea, " + (i % 3 ? "coffee" : "tea") + " is\n";
+    }
+    const std::filesystem::path path = corpus.write("streamed.txt", text);
+
+    core::SearchEngineParams params{25, 10, 4, 0.75, true};
+    params.shards = 2;
+    auto whole = std::make_unique<core::SearchEngine>(params);
+    auto replica = std::make_unique<core::SearchEngine>(params);
+    params.streamThreshold = 1;
+    params.replicationLogBytes = 1 << 26;
+    auto streamed = std::make_unique<core::SearchEngine>(params);
+    ASSERT_TRUE(whole->indexTxtFile(path.string()));
+    ASSERT_TRUE(streamed->indexTxtFile(path.string()));
+
+    EXPECT_EQ(streamed->docCount(), 1);
+    EXPECT_EQ(streamed->tokenCount(), whole->tokenCount());
+    for (const std::string query: {"tea", "\"cup of tea\"", "\"tea coffee\"~6", "\"coffee is line\""})
+    {
+        const auto expected = whole->searchQuery(query);
+        const auto actual = streamed->searchQuery(query);
+        ASSERT_EQ(actual.size(), expected.size()) << query;
+        for (size_t i = 0; i < actual.size(); i++)
+        {
+            EXPECT_EQ(actual[i].first, expected[i].first);
+            EXPECT_FLOAT_EQ(actual[i].second, expected[i].second);
+        }
+    }
+    EXPECT_EQ(streamed->searchQuery("\"cup of tea\"").size(), 1);
+
+    // the tokens of a streamed document are logged for replicas all the same
+    bool truncated;
+    const auto mutations = streamed->mutationsSince(0, 10, truncated);
+    ASSERT_EQ(mutations.size(), 1);
+    ASSERT_TRUE(replica->applyMutation(mutations[0]));
+    EXPECT_EQ(replica->searchQuery("\"tea coffee\"~6"), whole->searchQuery("\"tea coffee\"~6"));
+}
+
+TEST(SearchEngineTest, Utf8Documents)
+{
+    /**
+    * case folding and NFC make the spellings of a word one term, in documents and queries alike
+    */
+    const TempCorpus corpus("utf8");
+    const std::filesystem::path path = corpus.write("utf8.txt", "Cafe\u0301 au lait. CAFÉ crème, Журнал — 日本\n");
+
+    core::SearchEngineParams params{25, 10, 4, 0.75, true};
+    params.nfcTokens = true;
+    auto engine = std::make_unique<core::SearchEngine>(params);
+    ASSERT_TRUE(engine->indexTxtFile(path.string()));
+
+    bool found = false;
+    // both spellings of café in the document
+    EXPECT_EQ(engine->search("café", found)->size(), 2);
+    EXPECT_TRUE(found);
+    engine->search("CAFÉ", found);
+    EXPECT_TRUE(found);
+    engine->search("журнал", found);
+    EXPECT_TRUE(found);
+    engine->search("日", found);
+    EXPECT_TRUE(found);
+    engine->search("日本", found);
+    EXPECT_FALSE(found);
+
+    EXPECT_EQ(engine->searchQuery("\"CAFÉ au lait\"").size(), 1);
+    EXPECT_EQ(engine->searchQuery("ЖУРНАЛ AND crème").size(), 1);
+    EXPECT_EQ(engine->searchQuery("日本").size(), 1);
+}
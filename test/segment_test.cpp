@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include "../src/engine/segment.h"
+
+TEST(SegmentTest, Basic)
+{
+    core::Segment::Builder builder;
+    builder.add("apple", {{0, 4}, {0, 10}, {3, 1}});
+    builder.add("orange", {{2, 7}});
+    builder.add("pear", {});
+    EXPECT_EQ(builder.postingCount(), 4);
+
+    const core::SegmentPtr segment = builder.build();
+    EXPECT_EQ(segment->termCount(), 2);
+    EXPECT_EQ(segment->postingCount(), 4);
+    EXPECT_EQ(segment->docs(), (std::vector<core::DocId>{0, 2, 3}));
+
+    uint32_t termIdx;
+    EXPECT_FALSE(segment->find("pear", termIdx));
+    ASSERT_TRUE(segment->find("apple", termIdx));
+    EXPECT_EQ(segment->term(termIdx), "apple");
+    EXPECT_EQ(segment->postingCount(termIdx), 3);
+    EXPECT_EQ(segment->docCount(termIdx), 2);
+
+    std::vector<core::Posting> postings;
+    segment->forEach(termIdx, [&postings](core::DocId docId, size_t pos) {
+        postings.emplace_back(docId, pos);
+        return true;
+    });
+    EXPECT_EQ(postings, (std::vector<core::Posting>{{0, 4}, {0, 10}, {3, 1}}));
+
+    size_t visited = 0;
+    EXPECT_FALSE(segment->forEach(termIdx, [&visited](core::DocId, size_t) {
+        return ++visited < 2;
+    }));
+    EXPECT_EQ(visited, 2);
+
+    EXPECT_TRUE(segment->eraseTerm("orange"));
+    EXPECT_FALSE(segment->eraseTerm("orange"));
+    EXPECT_FALSE(segment->find("orange", termIdx));
+    EXPECT_TRUE(segment->find("apple", termIdx));
+}
+
+TEST(SegmentTest, Cursor)
+{
+    core::Segment::Builder builder;
+    std::vector<core::Posting> postings;
+    for (core::DocId docId = 0; docId < 3 * core::Segment::BlockSize; docId++)
+    {
+        for (size_t pos = 0; pos <= (docId == 100 ? 5 : docId % 3); pos++)
+        {
+            postings.emplace_back(docId * 2, pos);
+        }
+    }
+    builder.add("apple", postings);
+    const core::SegmentPtr segment = builder.build();
+
+    uint32_t termIdx;
+    ASSERT_TRUE(segment->find("apple", termIdx));
+    core::Segment::Cursor cursor(*segment, termIdx);
+    EXPECT_EQ(cursor.termMax().maxTermFreq, 6);
+    EXPECT_EQ(cursor.termMax().lastDoc, 2 * (3 * core::Segment::BlockSize - 1));
+    ASSERT_TRUE(cursor.isValid());
+    EXPECT_EQ(cursor.doc(), 0);
+    EXPECT_EQ(cursor.termFreq(), 1);
+    EXPECT_EQ(cursor.block().maxTermFreq, 3);
+
+    cursor.next();
+    EXPECT_EQ(cursor.doc(), 2);
+    EXPECT_EQ(cursor.termFreq(), 2);
+
+    cursor.shallowNextGEQ(199);
+    EXPECT_EQ(cursor.doc(), 2);
+    EXPECT_EQ(cursor.block().maxTermFreq, 6);
+    cursor.nextGEQ(199);
+    EXPECT_EQ(cursor.doc(), 200);
+    EXPECT_EQ(cursor.termFreq(), 6);
+
+    cursor.nextGEQ(200);
+    EXPECT_EQ(cursor.doc(), 200);
+    cursor.nextGEQ(2 * 3 * core::Segment::BlockSize);
+    EXPECT_FALSE(cursor.isValid());
+    EXPECT_EQ(cursor.block().maxTermFreq, 0);
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "../src/engine/shard.h"
+#include <thread>
 
 TEST(ShardTest, Basic)
 {
@@ -23,6 +24,11 @@ TEST(ShardTest, Basic)
 
     EXPECT_TRUE(exists);
     EXPECT_EQ(record->size(), 4);
+    // positions inserted out of order span lanes, the cursor merges them
+    core::PostingList::Cursor cursor(*record);
+    ASSERT_TRUE(cursor.isValid());
+    ASSERT_EQ(cursor.termFreq(), 3);
+    EXPECT_EQ(std::vector<size_t>(cursor.positions(), cursor.positions() + 3), (std::vector<size_t>{98, 99, 145}));
 
     EXPECT_EQ(shard->tokenCount(), 3);
 
@@ -35,4 +41,220 @@ TEST(ShardTest, Basic)
     EXPECT_FALSE(shard->exists("orange"));
     EXPECT_EQ(nullRecord->serialize(), Json(nullptr));
     EXPECT_EQ(shard->tokenCount(), 2);
-}
\ No newline at end of file
+}
+
+TEST(ShardTest, DocumentDeletion)
+{
+    auto shard = std::make_shared<core::Shard>(0.75, 10, 10);
+
+    shard->insert("apple", "first.txt", {3}, 0);
+    shard->insert("orange", "first.txt", {3}, 6);
+    shard->insert("apple", "second.txt", {1}, 0);
+
+    core::DocStat docStat{};
+    ASSERT_TRUE(shard->findDocument("first.txt", docStat));
+    EXPECT_EQ(docStat.tokenCount, 3);
+
+    EXPECT_TRUE(shard->eraseDocument("first.txt"));
+    EXPECT_FALSE(shard->eraseDocument("first.txt"));
+    EXPECT_FALSE(shard->findDocument("first.txt", docStat));
+    EXPECT_EQ(shard->docCount(), 1);
+    EXPECT_EQ(shard->tombstoneCount(), 1);
+
+    bool exists;
+    EXPECT_EQ(shard->search("apple", exists)->size(), 1);
+    EXPECT_TRUE(exists);
+
+    EXPECT_EQ(shard->compact(), 2);
+    EXPECT_EQ(shard->tombstoneCount(), 0);
+    EXPECT_EQ(shard->search("apple", exists)->size(), 1);
+    EXPECT_FALSE(shard->exists("orange"));
+    EXPECT_EQ(shard->tokenCount(), 1);
+}
+
+TEST(ShardTest, Segments)
+{
+    auto shard = std::make_shared<core::Shard>(0.75, 10, 10, core::SegmentPolicy{4, 2, 0.5});
+
+    EXPECT_TRUE(shard->insertDocument("first.txt", {4}, {{"apple", 0}, {"pear", 6}, {"apple", 11}, {"pear", 17}}));
+    EXPECT_FALSE(shard->insertDocument("first.txt", {3}, {{"apple", 0}}));
+    EXPECT_TRUE(shard->needsMaintenance());
+
+    // the buffer is full, it becomes the first segment
+    EXPECT_TRUE(shard->maintain());
+    EXPECT_EQ(shard->segmentCount(), 1);
+    EXPECT_TRUE(shard->insertDocument("second.txt", {2}, {{"apple", 0}, {"plum", 6}}));
+    EXPECT_TRUE(shard->seal());
+    EXPECT_EQ(shard->segmentCount(), 2);
+
+    // postings are gathered across segments and the buffer
+    shard->insert("apple", "third.txt", {1}, 0);
+    bool exists;
+    EXPECT_EQ(shard->search("apple", exists)->size(), 4);
+    EXPECT_EQ(shard->tokenCount(), 3);
+
+    // pages concatenate to the whole posting list in order
+    const auto postings = shard->search("apple", exists);
+    std::vector<core::Posting> all = postings->page(std::nullopt, 100, false);
+    ASSERT_EQ(all.size(), 4);
+    std::vector<core::Posting> paged;
+    for (auto page = postings->page(std::nullopt, 3, false); !page.empty();
+         page = postings->page(paged.back(), 3, false))
+    {
+        paged.insert(paged.end(), page.begin(), page.end());
+    }
+    EXPECT_EQ(paged, all);
+    // pages by document keep every position of their documents
+    EXPECT_EQ(postings->page(std::nullopt, 1, true), (std::vector<core::Posting>{all[0], all[1]}));
+
+    // the cursor merges segments and the buffer in DocId order and seeks across them
+    std::vector<core::DocId> docs;
+    for (core::PostingList::Cursor cursor(*postings); cursor.isValid(); cursor.next())
+    {
+        docs.push_back(cursor.doc());
+    }
+    ASSERT_EQ(docs, (std::vector<core::DocId>{all[0].first, all[2].first, all[3].first}));
+    core::PostingList::Cursor cursor(*postings);
+    cursor.nextGEQ(docs[1] + 1);
+    ASSERT_TRUE(cursor.isValid());
+    EXPECT_EQ(cursor.doc(), docs[2]);
+    EXPECT_EQ(cursor.termFreq(), 1);
+    EXPECT_EQ(cursor.positions()[0], all[3].second);
+    cursor.next();
+    EXPECT_FALSE(cursor.isValid());
+
+    // two segments of the same tier are merged into one
+    while (shard->maintain())
+    {
+    }
+    EXPECT_EQ(shard->segmentCount(), 1);
+    EXPECT_EQ(shard->search("apple", exists)->size(), 4);
+
+    // posting lists keep the buffers they read from alive, the arena of the buffer included
+    EXPECT_TRUE(shard->seal());
+    EXPECT_EQ(postings->page(std::nullopt, 100, false), all);
+
+    shard->erase("plum");
+    EXPECT_FALSE(shard->exists("plum"));
+    EXPECT_TRUE(shard->search("plum", exists)->empty());
+
+    // deleted documents are dropped by merges
+    EXPECT_TRUE(shard->eraseDocument("first.txt"));
+    EXPECT_EQ(shard->tombstoneCount(), 1);
+    EXPECT_EQ(shard->compact(), 4);
+    EXPECT_EQ(shard->tombstoneCount(), 0);
+    EXPECT_FALSE(shard->exists("pear"));
+    EXPECT_EQ(shard->search("apple", exists)->size(), 2);
+    EXPECT_EQ(shard->segmentCount(), 1);
+    EXPECT_EQ(shard->tokenCount(), 1);
+}
+
+TEST(ShardTest, ConcurrentReaders)
+{
+    // readers keep using the views they loaded while the writer seals and merges them away
+    auto shard = std::make_shared<core::Shard>(0.75, 100, 100, core::SegmentPolicy{64, 2, 0.5});
+    const size_t docCount = 500;
+    std::atomic<bool> isDone{false};
+    std::atomic<size_t> failures{0};
+    std::vector<std::thread> readers;
+    for (size_t r = 0; r < 4; r++)
+    {
+        readers.emplace_back([&shard, &isDone, &failures] {
+            size_t seen = 0;
+            while (!isDone)
+            {
+                // documents are only added, so every view holds at least the postings of the previous one
+                bool exists;
+                const auto postings = shard->search("apple", exists);
+                const size_t size = postings->size();
+                failures += size < seen || postings->page(std::nullopt, size, false).size() != size;
+                seen = size;
+                const auto top = shard->topDocs({"apple", "pear"}, {1.0f, 2.0f}, {1.2f, 0.75f, 4.0f}, {});
+                failures += top.size() > 20;
+            }
+        });
+    }
+    for (size_t i = 0; i < docCount; i++)
+    {
+        shard->insertDocument("doc" + std::to_string(i) + ".txt", {4}, {{"apple", 0}, {"pear", 6}, {"apple", 11}});
+        while (shard->needsMaintenance() && shard->maintain())
+        {
+        }
+    }
+    isDone = true;
+    for (auto& reader: readers)
+    {
+        reader.join();
+    }
+    EXPECT_EQ(failures, 0);
+    bool exists;
+    EXPECT_EQ(shard->search("apple", exists)->size(), 2 * docCount);
+    EXPECT_GT(shard->segmentCount(), 0);
+}
+
+TEST(ShardTest, TokenRecord)
+{
+    // rare tokens stay inline, the fifth posting of the lane moves it out of the record
+    core::TokenRecord record;
+    bool isNewDoc;
+    EXPECT_TRUE(record.addIfNotPresent({1, 10}, isNewDoc));
+    EXPECT_TRUE(isNewDoc);
+    EXPECT_TRUE(record.addIfNotPresent({1, 15}, isNewDoc));
+    EXPECT_FALSE(isNewDoc);
+    EXPECT_TRUE(record.addIfNotPresent({2, 20}, isNewDoc));
+    EXPECT_FALSE(record.addIfNotPresent({2, 20}, isNewDoc));
+    record.append(3, {1});
+    EXPECT_TRUE(record.isInline());
+    EXPECT_EQ(record.snapshot(), (std::vector<core::Posting>{{1, 10}, {1, 15}, {2, 20}, {3, 1}}));
+
+    // views taken before are not affected by writes, positions that do not follow the run of their document
+    // go to another lane instead of rewriting the one holding it
+    const std::vector<core::TokenRecord::LaneView> before = record.lanes();
+    EXPECT_TRUE(record.addIfNotPresent({2, 25}, isNewDoc));
+    EXPECT_FALSE(isNewDoc);
+    EXPECT_FALSE(record.addIfNotPresent({2, 25}, isNewDoc));
+    EXPECT_FALSE(record.isInline());
+    ASSERT_EQ(before.size(), 1);
+    EXPECT_EQ(before[0].size, 4);
+    EXPECT_EQ(before[0].positions[3], 1);
+    EXPECT_EQ(record.lanes().size(), 2);
+
+    // a new document goes to the first lane it follows, one preceding the last document of every lane opens
+    // a new lane, which is merged with the lane before it as it holds as many postings
+    record.append(4, {2, 5, 9});
+    EXPECT_EQ(record.lanes().size(), 2);
+    record.append(0, {7});
+    EXPECT_EQ(record.lanes().size(), 3);
+    EXPECT_EQ(record.snapshot(), (std::vector<core::Posting>{{0, 7}, {1, 10}, {1, 15}, {2, 20}, {2, 25}, {3, 1},
+                                                             {4, 2}, {4, 5}, {4, 9}}));
+
+    // lanes are walked in place, a document occurs in a lane once
+    core::TokenRecord::Cursor cursor(record.lanes()[1]);
+    cursor.nextGEQ(2);
+    ASSERT_TRUE(cursor.isValid());
+    EXPECT_EQ(cursor.doc(), 2);
+    EXPECT_EQ(cursor.termFreq(), 1);
+    EXPECT_EQ(cursor.positions()[0], 25);
+    cursor.nextGEQ(4);
+    EXPECT_EQ(cursor.termFreq(), 3);
+    cursor.next();
+    EXPECT_FALSE(cursor.isValid());
+
+    // positions arriving in descending order keep the lanes few
+    core::TokenRecord descending;
+    for (size_t pos = 1000; pos > 0; pos--)
+    {
+        descending.append(1, {pos});
+    }
+    EXPECT_EQ(descending.size(), 1000);
+    EXPECT_LE(descending.lanes().size(), 12);
+    std::vector<core::Posting> postings = descending.snapshot();
+    EXPECT_TRUE(std::is_sorted(postings.begin(), postings.end()));
+    EXPECT_EQ(postings.front(), core::Posting(1, 1));
+
+    // a document too large for the inline postings leaves the record at once
+    core::TokenRecord large;
+    large.append(7, {1, 2, 3, 4, 5});
+    EXPECT_FALSE(large.isInline());
+    EXPECT_EQ(large.size(), 5);
+}
@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+#include "../src/engine/term_dict.h"
+#include "../src/engine/interner.h"
+#include <random>
+#include <thread>
+
+using Terms = std::vector<std::string>;
+
+TEST(TermDictionaryTest, Wildcards)
+{
+    EXPECT_TRUE(core::wildcard::isPattern("appl*"));
+    EXPECT_TRUE(core::wildcard::isPattern("c?t"));
+    EXPECT_FALSE(core::wildcard::isPattern("apple"));
+    EXPECT_EQ(core::wildcard::literalPrefix("ap?l*"), "ap");
+    EXPECT_EQ(core::wildcard::literalPrefix("*"), "");
+
+    EXPECT_TRUE(core::wildcard::matches("appl*", "apple"));
+    EXPECT_TRUE(core::wildcard::matches("appl*", "appl"));
+    EXPECT_TRUE(core::wildcard::matches("*", ""));
+    EXPECT_TRUE(core::wildcard::matches("c?t", "cat"));
+    EXPECT_FALSE(core::wildcard::matches("c?t", "ct"));
+    EXPECT_TRUE(core::wildcard::matches("*a*a*", "banana"));
+    EXPECT_TRUE(core::wildcard::matches("b*n?", "banana"));
+    EXPECT_FALSE(core::wildcard::matches("b*n", "banana"));
+    EXPECT_TRUE(core::wildcard::matches("**a", "a"));
+    EXPECT_FALSE(core::wildcard::matches("apple", "apples"));
+}
+
+TEST(TermDictionaryTest, Expansion)
+{
+    core::TermDictionary dictionary;
+    for (const std::string term: {"pear", "apple", "application", "apply", "banana", "band", "bandana", "cat"})
+    {
+        dictionary.insert(term);
+    }
+    dictionary.insert("apple");
+    dictionary.erase("pear");
+    dictionary.erase("kiwi");
+    EXPECT_EQ(dictionary.size(), 7);
+    EXPECT_TRUE(dictionary.contains("band"));
+    EXPECT_FALSE(dictionary.contains("pear"));
+
+    bool truncated = true;
+    EXPECT_EQ(dictionary.match("appl*", 10, truncated), (Terms{"apple", "application", "apply"}));
+    EXPECT_FALSE(truncated);
+    EXPECT_EQ(dictionary.match("appl*", 2, truncated), (Terms{"apple", "application"}));
+    EXPECT_TRUE(truncated);
+    EXPECT_EQ(dictionary.match("appl*", 3, truncated).size(), 3);
+    EXPECT_FALSE(truncated);
+
+    EXPECT_EQ(dictionary.match("ban*a", 10, truncated), (Terms{"banana", "bandana"}));
+    EXPECT_EQ(dictionary.match("*an?", 10, truncated), (Terms{"banana", "band", "bandana"}));
+    EXPECT_EQ(dictionary.match("*nd", 10, truncated), (Terms{"band"}));
+    EXPECT_EQ(dictionary.match("cat", 10, truncated), Terms{"cat"});
+    EXPECT_TRUE(dictionary.match("kiwi*", 10, truncated).empty());
+
+    EXPECT_EQ(dictionary.range("apply", "band", 10, truncated), (Terms{"apply", "banana"}));
+    EXPECT_EQ(dictionary.range("b", "", 10, truncated), (Terms{"banana", "band", "bandana", "cat"}));
+    EXPECT_FALSE(truncated);
+    EXPECT_EQ(dictionary.range("", "", 1, truncated), Terms{"apple"});
+    EXPECT_TRUE(truncated);
+}
+
+static size_t levenshtein(const std::string& first, const std::string& second)
+{
+    std::vector<size_t> row(second.size() + 1);
+    for (size_t j = 0; j < row.size(); j++)
+    {
+        row[j] = j;
+    }
+    for (size_t i = 1; i <= first.size(); i++)
+    {
+        size_t diagonal = row[0];
+        row[0] = i;
+        for (size_t j = 1; j < row.size(); j++)
+        {
+            const size_t above = row[j];
+            row[j] = std::min({above + 1, row[j - 1] + 1, diagonal + (first[i - 1] != second[j - 1])});
+            diagonal = above;
+        }
+    }
+    return row.back();
+}
+
+TEST(TermDictionaryTest, Fuzzy)
+{
+    /**
+    * the pruned walk has to find exactly the terms within reach of an exhaustive comparison
+    */
+    std::mt19937 gen(11);
+    std::uniform_int_distribution<size_t> length(1, 7);
+    std::uniform_int_distribution<int> letter('a', 'e');
+    core::TermDictionary dictionary;
+    std::set<std::string> terms;
+    for (size_t i = 0; i < 3000; i++)
+    {
+        std::string term(length(gen), ' ');
+        for (char& ch: term)
+        {
+            ch = static_cast<char>(letter(gen));
+        }
+        dictionary.insert(term);
+        terms.insert(term);
+    }
+
+    for (const std::string query: {"abcde", "a", "eeee", "bad", "dcbaabc", "zzz", ""})
+    {
+        for (size_t maxEdits = 0; maxEdits <= 3; maxEdits++)
+        {
+            std::vector<core::TermMatch> expected;
+            for (const auto& term: terms)
+            {
+                const size_t distance = levenshtein(term, query);
+                if (distance <= std::min(maxEdits, core::fuzzy::MaxEdits))
+                {
+                    expected.push_back({term, distance});
+                }
+            }
+            const std::vector<core::TermMatch> matches = dictionary.fuzzyMatch(query, maxEdits);
+            ASSERT_EQ(matches.size(), expected.size()) << query << " " << maxEdits;
+            for (size_t i = 0; i < matches.size(); i++)
+            {
+                EXPECT_EQ(matches[i].term, expected[i].term);
+                EXPECT_EQ(matches[i].distance, expected[i].distance);
+            }
+        }
+    }
+}
+
+TEST(TermInternerTest, Interning)
+{
+    core::TermInterner terms;
+    const core::TermId apple = terms.intern("apple");
+    EXPECT_EQ(terms.intern(std::string("apple")), apple);
+    EXPECT_EQ(terms.term(apple), "apple");
+    core::TermId found;
+    EXPECT_TRUE(terms.find("apple", found));
+    EXPECT_EQ(found, apple);
+    EXPECT_FALSE(terms.find("pear", found));
+
+    // terms longer than an arena block get a block of their own
+    const std::string longTerm(100000, 'x');
+    EXPECT_EQ(terms.term(terms.intern(longTerm)), longTerm);
+
+    /**
+    * threads interning overlapping terms agree on their ids, tables grow along the way
+    */
+    const size_t termCount = 20000;
+    std::vector<std::vector<core::TermId>> ids(4, std::vector<core::TermId>(termCount));
+    std::vector<std::thread> threads;
+    // readers probe while tables grow, a term found is always found whole
+    std::atomic<bool> isDone{false};
+    std::atomic<size_t> mismatches{0};
+    for (size_t t = 0; t < 2; t++)
+    {
+        threads.emplace_back([&terms, &isDone, &mismatches, t, termCount] {
+            for (size_t i = t; !isDone; i = (i + 13) % termCount)
+            {
+                const std::string text = "term" + std::to_string(i);
+                core::TermId id;
+                if (terms.find(text, id) && terms.term(id) != text)
+                {
+                    mismatches++;
+                }
+            }
+        });
+    }
+    for (size_t t = 0; t < ids.size(); t++)
+    {
+        threads.emplace_back([&terms, &ids, t, termCount] {
+            for (size_t i = 0; i < termCount; i++)
+            {
+                const size_t term = (i * 7919 + t * 5003) % termCount;
+                ids[t][term] = terms.intern("term" + std::to_string(term));
+            }
+        });
+    }
+    for (size_t t = 2; t < threads.size(); t++)
+    {
+        threads[t].join();
+    }
+    isDone = true;
+    threads[0].join();
+    threads[1].join();
+    EXPECT_EQ(mismatches, 0);
+    EXPECT_EQ(terms.size(), termCount + 2);
+    std::set<core::TermId> distinct;
+    for (size_t i = 0; i < termCount; i++)
+    {
+        for (size_t t = 1; t < ids.size(); t++)
+        {
+            ASSERT_EQ(ids[t][i], ids[0][i]);
+        }
+        EXPECT_EQ(terms.term(ids[0][i]), "term" + std::to_string(i));
+        distinct.insert(ids[0][i]);
+    }
+    EXPECT_EQ(distinct.size(), termCount);
+}
@@ -0,0 +1,292 @@
+#include <gtest/gtest.h>
+#include "../src/engine/tokenizer.h"
+#include "../src/engine/unicode.h"
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+using Tokens = std::vector<std::pair<std::string, size_t>>;
+
+static Tokens referenceTokens(const std::string& text, bool toLowercase)
+{
+    /**
+    * byte at a time, the way texts were tokenized before classification was vectorized
+    */
+    Tokens res;
+    size_t i = 0;
+    while (i < text.size())
+    {
+        if (!core::detail::isTokenByte(text[i]))
+        {
+            i++;
+            continue;
+        }
+        std::string token;
+        for (; i < text.size() && core::detail::isTokenByte(text[i]); i++)
+        {
+            token += toLowercase ? static_cast<char>(std::tolower(static_cast<unsigned char>(text[i]))) : text[i];
+        }
+        res.emplace_back(std::move(token), core::position::pack(i, res.size()));
+    }
+    return res;
+}
+
+static Tokens tokens(const std::string& text, bool toLowercase)
+{
+    const core::TokenizedText tokenized(text, toLowercase);
+    Tokens res;
+    for (const auto& [token, pos]: tokenized.tokens())
+    {
+        res.emplace_back(token, pos);
+    }
+    return res;
+}
+
+TEST(TokenizerTest, Basic)
+{
+    EXPECT_TRUE(tokens("", true).empty());
+    EXPECT_TRUE(tokens(" 12, -- ", true).empty());
+    EXPECT_EQ(tokens("It's 5 O'Clock", true),
+              (Tokens{{"it's", core::position::pack(4, 0)}, {"o'clock", core::position::pack(14, 1)}}));
+    EXPECT_EQ(tokens("It's 5 O'Clock", false)[1].first, "O'Clock");
+
+    // tokens straddling the 64 byte blocks the bitmap is built of
+    const std::string text = std::string(60, ' ') + "Straddling" + std::string(58, '.') + "Z";
+    EXPECT_EQ(tokens(text, true), (Tokens{{"straddling", core::position::pack(70, 0)},
+                                          {"z", core::position::pack(129, 1)}}));
+}
+
+TEST(TokenizerTest, MatchesReference)
+{
+    /**
+    * random texts of every length around block boundaries, high bytes included, and letter-heavy ones
+    * with runs longer than a block. Texts with high bytes take the UTF-8 path, their bytes are checked
+    * against the classifier directly
+    */
+    std::mt19937 gen(17);
+    std::uniform_int_distribution<int> anyByte(-128, 127);
+    const std::string alphabet = "aAzZ@[`{' \n.";
+    std::uniform_int_distribution<size_t> pick(0, alphabet.size() - 1);
+    for (size_t size = 0; size < 300; size++)
+    {
+        std::string noise;
+        std::string letters;
+        for (size_t i = 0; i < size; i++)
+        {
+            noise += static_cast<char>(anyByte(gen));
+            letters += i % 97 == 96 ? ' ' : alphabet[pick(gen) % 4];
+        }
+        if (size > 0)
+        {
+            letters[size / 2] = alphabet[pick(gen)];
+        }
+        std::string asciiNoise = noise;
+        for (char& ch: asciiNoise)
+        {
+            ch &= 0x7F;
+        }
+        for (const std::string& text: {asciiNoise, letters})
+        {
+            for (bool toLowercase: {false, true})
+            {
+                ASSERT_EQ(tokens(text, toLowercase), referenceTokens(text, toLowercase)) << size;
+            }
+        }
+
+        std::vector<uint64_t> mask((size + 63) / 64);
+        std::string lowered(size, ' ');
+        core::detail::classify(noise.data(), size, lowered.data(), mask.data());
+        for (size_t i = 0; i < size; i++)
+        {
+            ASSERT_EQ(mask[i / 64] >> (i % 64) & 1, core::detail::isTokenByte(noise[i])) << size;
+            ASSERT_EQ(lowered[i], noise[i] >= 'A' && noise[i] <= 'Z' ? noise[i] | 0x20 : noise[i]) << size;
+        }
+    }
+}
+
+static Tokens streamedTokens(const std::string& path, bool toLowercase, size_t windowSize)
+{
+    core::TokenStream stream(path, toLowercase, false, windowSize);
+    Tokens res;
+    while (stream.next())
+    {
+        for (const auto& [token, pos]: stream.tokens())
+        {
+            res.emplace_back(token, pos);
+        }
+    }
+    EXPECT_FALSE(stream.isFailed());
+    EXPECT_EQ(stream.size(), res.size());
+    return res;
+}
+
+TEST(TokenizerTest, Stream)
+{
+    /**
+    * words no longer than the smallest window, so every token straddling a window is carried over whole
+    */
+    std::mt19937 gen(23);
+    const std::string alphabet = "aAzZ' \n.,";
+    std::uniform_int_distribution<size_t> letter(0, 4);
+    std::uniform_int_distribution<size_t> separator(5, alphabet.size() - 1);
+    std::uniform_int_distribution<size_t> length(1, 12);
+    std::string text;
+    while (text.size() < 20000)
+    {
+        for (size_t i = length(gen); i > 0; i--)
+        {
+            text += alphabet[letter(gen)];
+        }
+        text += alphabet[separator(gen)];
+    }
+
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "anechka_stream_test.txt";
+    {
+        std::ofstream f(path);
+        f << text;
+    }
+    for (size_t windowSize: {13, 64, 100, 4096, 1 << 20})
+    {
+        for (bool toLowercase: {false, true})
+        {
+            ASSERT_EQ(streamedTokens(path.string(), toLowercase, windowSize), tokens(text, toLowercase)) << windowSize;
+        }
+    }
+
+    // a token filling a whole window is split
+    {
+        std::ofstream f(path);
+        f << "ab " << std::string(20, 'x');
+    }
+    EXPECT_EQ(streamedTokens(path.string(), false, 8),
+              (Tokens{{"ab", core::position::pack(2, 0)},
+                      {"xxxxxxxx", core::position::pack(11, 1)},
+                      {"xxxxxxxx", core::position::pack(19, 2)},
+                      {"xxxx", core::position::pack(23, 3)}}));
+
+    // a window of continuation bytes only is cut whole rather than backed off past its start
+    {
+        std::ofstream f(path);
+        f << "\x80\x80\x80\x80\x80";
+    }
+    {
+        core::TokenStream stream(path.string(), false, false, 2);
+        std::string streamed;
+        while (stream.next())
+        {
+            streamed += stream.text();
+        }
+        EXPECT_EQ(streamed, std::string(5, '\x80'));
+    }
+
+    std::ofstream(path).close();
+    EXPECT_TRUE(streamedTokens(path.string(), true, 8).empty());
+    std::filesystem::remove(path);
+    EXPECT_THROW(core::TokenStream(path.string(), true, false), std::invalid_argument);
+}
+
+TEST(TokenizerTest, Utf8)
+{
+    using Strings = std::vector<std::string>;
+    const auto texts = [](const std::string& text, bool toLowercase, bool toNfc = false) {
+        const core::TokenizedText tokenized(text, toLowercase, toNfc);
+        Strings res;
+        for (const auto& [token, _]: tokenized.tokens())
+        {
+            res.emplace_back(token);
+        }
+        return res;
+    };
+
+    EXPECT_EQ(texts("Ça coûte cher", true), (Strings{"ça", "coûte", "cher"}));
+    EXPECT_EQ(texts("Привет, МИР!", true), (Strings{"привет", "мир"}));
+    EXPECT_EQ(texts("ΣΊΣΥΦΟΣ", true), (Strings{"σίσυφοσ"}));
+    EXPECT_EQ(texts("Straße", false), (Strings{"Straße"}));
+    // digits and invalid sequences separate tokens, an overlong slash included
+    EXPECT_EQ(texts("Ünïcode2024x ab\xff" "cd \xc0\xaf" "ef", true), (Strings{"ünïcode", "x", "ab", "cd", "ef"}));
+    // every ideograph is a token of its own, katakana make up runs
+    EXPECT_EQ(texts("東京タワーへ行く", false), (Strings{"東", "京", "タワー", "へ", "行", "く"}));
+    // the typographic apostrophe is folded into '
+    EXPECT_EQ(texts("It’s", true), (Strings{"it's"}));
+    EXPECT_EQ(texts("It’s", false), (Strings{"It’s"}));
+
+    // combining marks stay with the letter they follow and are composed with it in NFC
+    const std::string decomposed = "ÉCOLE";
+    EXPECT_EQ(texts(" ́" + decomposed, false), (Strings{decomposed}));
+    EXPECT_EQ(texts(decomposed, true), (Strings{"école"}));
+    EXPECT_EQ(texts(decomposed, true, true), (Strings{"école"}));
+    EXPECT_EQ(texts("ậ 각", false, true), (Strings{"ậ", "각"}));
+    EXPECT_EQ(texts("Å", false, true), (Strings{"Å"}));
+
+    // positions are byte offsets
+    const core::TokenizedText tokenized("é a", true);
+    ASSERT_EQ(tokenized.size(), 2);
+    EXPECT_EQ(tokenized.tokens()[0].second, core::position::pack(2, 0));
+    EXPECT_EQ(tokenized.tokens()[1].second, core::position::pack(4, 1));
+
+    // the UTF-8 path tokenizes ASCII the way the ASCII one does
+    std::mt19937 gen(29);
+    std::uniform_int_distribution<int> anyByte(0, 127);
+    for (size_t size = 0; size < 200; size++)
+    {
+        std::string text;
+        for (size_t i = 0; i < size; i++)
+        {
+            text += static_cast<char>(anyByte(gen));
+        }
+        for (bool toLowercase: {false, true})
+        {
+            Tokens mixed = tokens(text + " é", toLowercase);
+            ASSERT_FALSE(mixed.empty());
+            mixed.pop_back();
+            ASSERT_EQ(mixed, tokens(text, toLowercase)) << size;
+        }
+
+        EXPECT_TRUE(core::detail::isAscii(text.data(), size));
+        for (size_t i = 0; i < size; i++)
+        {
+            std::string high = text;
+            high[i] = static_cast<char>(0x80 | high[i]);
+            ASSERT_FALSE(core::detail::isAscii(high.data(), size)) << size << " " << i;
+        }
+    }
+
+    std::string folded = "ÀÉÎ Kelvin K";
+    core::unicode::foldCase(folded);
+    EXPECT_EQ(folded, "àéî kelvin k");
+}
+
+TEST(TokenizerTest, Utf8Stream)
+{
+    /**
+    * multibyte code points straddle windows as tokens do
+    */
+    std::mt19937 gen(31);
+    const std::vector<std::string> alphabet = {"a", "É", "ж", "中", "タ", "́", "'", " ", ".", "\n", "—"};
+    std::uniform_int_distribution<size_t> letter(0, 6);
+    std::uniform_int_distribution<size_t> separator(7, alphabet.size() - 1);
+    std::uniform_int_distribution<size_t> length(1, 12);
+    std::string text;
+    while (text.size() < 20000)
+    {
+        for (size_t i = length(gen); i > 0; i--)
+        {
+            text += alphabet[letter(gen)];
+        }
+        text += alphabet[separator(gen)];
+    }
+
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "anechka_utf8_stream_test.txt";
+    {
+        std::ofstream f(path);
+        f << text;
+    }
+    for (size_t windowSize: {64, 100, 4096})
+    {
+        for (bool toLowercase: {false, true})
+        {
+            ASSERT_EQ(streamedTokens(path.string(), toLowercase, windowSize), tokens(text, toLowercase)) << windowSize;
+        }
+    }
+    std::filesystem::remove(path);
+}